@@ -8,20 +8,112 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <optional>
+#include <ostream>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 #include "brookesia/gui_interface/handles.hpp"
 #include "brookesia/gui_interface/macro_configs.h"
 
 namespace esp_brookesia::gui {
 
+// Packed 0xRRGGBB color, formatted as "#rrggbb" by the string API.
+struct DataColor {
+    uint32_t rgb = 0;
+
+    bool operator==(const DataColor &) const = default;
+};
+
+enum class DataValueType {
+    String,
+    Bool,
+    Int,
+    Float,
+    Color,
+};
+
+// Typed store value. Producers that push numbers, flags or colors store them as is, so neither side pays for a
+// text round trip. String values keep the historical behavior of the store.
+struct DataValue : std::variant<std::string, bool, int32_t, float, DataColor> {
+    using Base = std::variant<std::string, bool, int32_t, float, DataColor>;
+
+    DataValue() = default;
+
+    DataValue(std::string value)
+        : Base(std::move(value))
+    {
+    }
+
+    DataValue(const char *value)
+        : Base(std::string(value))
+    {
+    }
+
+    // Only an exact bool selects this overload, so integers that must convert explicitly cannot decay to bool
+    template<typename T>
+    requires std::is_same_v<T, bool>
+    DataValue(T value)
+        : Base(value)
+    {
+    }
+
+    DataValue(DataColor value)
+        : Base(value)
+    {
+    }
+
+    // Every integer and floating type collapses to int32_t and float. Integer types that do not fit in int32_t,
+    // such as uint32_t and 64-bit types, only convert explicitly since the value is truncated.
+    template<typename T>
+    requires (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+    explicit(
+        std::cmp_less(std::numeric_limits<T>::min(), std::numeric_limits<int32_t>::min()) ||
+        std::cmp_greater(std::numeric_limits<T>::max(), std::numeric_limits<int32_t>::max())
+    )
+    DataValue(T value)
+        : Base(static_cast<int32_t>(value))
+    {
+    }
+
+    template<typename T>
+    requires std::is_floating_point_v<T>
+    DataValue(T value)
+        : Base(static_cast<float>(value))
+    {
+    }
+
+    DataValueType type() const
+    {
+        return static_cast<DataValueType>(index());
+    }
+
+    // Text form used by the string API: "true"/"false", decimal numbers and "#rrggbb" colors
+    std::string to_string() const;
+
+    // Typed reads also accept the text form, so values written through the string API stay readable. `to_int()`
+    // rounds floats and rejects those that are not finite or fall outside int32_t.
+    std::optional<bool> to_bool() const;
+    std::optional<int32_t> to_int() const;
+    std::optional<float> to_float() const;
+    std::optional<DataColor> to_color() const;
+
+    friend std::ostream &operator<<(std::ostream &os, const DataValue &value)
+    {
+        return os << value.to_string();
+    }
+};
+
 class IDataStore {
 public:
     using SubscriptionId = uint64_t;
     using Listener = std::function<void(std::string_view key, std::string_view value)>;
+    using ValueListener = std::function<void(std::string_view key, const DataValue &value)>;
 
     IDataStore() = default;
     IDataStore(const IDataStore &) = delete;
@@ -47,6 +139,38 @@ public:
         Listener listener) = 0;
     virtual void unsubscribe(SubscriptionId id) = 0;
 
+    // Typed API. The defaults go through the string API so existing stores keep working unchanged; stores that
+    // keep typed values override them.
+    virtual std::optional<DataValue> get_value(std::string_view key) const;
+    virtual std::optional<DataValue> get_value(
+        DocumentId document_id,
+        std::string_view absolute_path,
+        std::string_view key) const;
+    virtual void set_value(std::string_view key, DataValue value);
+    virtual void set_value(
+        DocumentId document_id,
+        std::string_view absolute_path,
+        std::string_view key,
+        DataValue value);
+    virtual SubscriptionId subscribe_value(std::string_view key, ValueListener listener);
+    virtual SubscriptionId subscribe_value(
+        DocumentId document_id,
+        std::string_view absolute_path,
+        std::string_view key,
+        ValueListener listener);
+
+    void set_bool(DocumentId document_id, std::string_view absolute_path, std::string_view key, bool value);
+    void set_int(DocumentId document_id, std::string_view absolute_path, std::string_view key, int32_t value);
+    void set_float(DocumentId document_id, std::string_view absolute_path, std::string_view key, float value);
+    void set_color(DocumentId document_id, std::string_view absolute_path, std::string_view key, DataColor value);
+    std::optional<bool> get_bool(DocumentId document_id, std::string_view absolute_path, std::string_view key) const;
+    std::optional<int32_t> get_int(DocumentId document_id, std::string_view absolute_path, std::string_view key) const;
+    std::optional<float> get_float(DocumentId document_id, std::string_view absolute_path, std::string_view key) const;
+    std::optional<DataColor> get_color(
+        DocumentId document_id,
+        std::string_view absolute_path,
+        std::string_view key) const;
+
     // Drop every value and signal scoped to `document_id`. Called by Runtime when a
     // document is unloaded so the store does not accumulate stale per-document state.
     // Default implementation is a no-op for backends that do not cache per-document data.
@@ -90,6 +214,23 @@ public:
         std::string_view key,
         Listener listener) override;
     void unsubscribe(SubscriptionId id) override;
+    std::optional<DataValue> get_value(std::string_view key) const override;
+    std::optional<DataValue> get_value(
+        DocumentId document_id,
+        std::string_view absolute_path,
+        std::string_view key) const override;
+    void set_value(std::string_view key, DataValue value) override;
+    void set_value(
+        DocumentId document_id,
+        std::string_view absolute_path,
+        std::string_view key,
+        DataValue value) override;
+    SubscriptionId subscribe_value(std::string_view key, ValueListener listener) override;
+    SubscriptionId subscribe_value(
+        DocumentId document_id,
+        std::string_view absolute_path,
+        std::string_view key,
+        ValueListener listener) override;
     void forget_document(DocumentId document_id) override;
 
     std::size_t debug_connection_count() const override;
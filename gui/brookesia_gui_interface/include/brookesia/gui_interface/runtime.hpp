@@ -14,6 +14,7 @@
 #include <cstdint>
 
 #include "brookesia/gui_interface/backend.hpp"
+#include "brookesia/gui_interface/data_store.hpp"
 #include "brookesia/gui_interface/document.hpp"
 #include "brookesia/gui_interface/event.hpp"
 #include "brookesia/gui_interface/macro_configs.h"
@@ -35,6 +36,24 @@ struct BindingValueUpdate {
 };
 BROOKESIA_DESCRIBE_STRUCT(BindingValueUpdate, (), (absolute_path, key, value))
 
+// Same as BindingValueUpdate, but numbers, flags and colors reach the bound widgets without a text round trip
+struct TypedBindingValueUpdate {
+    std::string absolute_path;
+    std::string key;
+    DataValue value;
+};
+
+struct BindingBatchStats {
+    uint64_t queued_updates = 0;   ///< Binding updates queued while batching is enabled
+    uint64_t merged_updates = 0;   ///< Queued updates that replaced a pending value of the same node binding
+    uint64_t merged_nodes = 0;     ///< Applied bindings folded into a node already dirty in the same batch
+    uint64_t reapplied_nodes = 0;  ///< Nodes pushed to the backend after a batch
+    uint64_t commits = 0;          ///< Non-empty batches committed
+};
+BROOKESIA_DESCRIBE_STRUCT(
+    BindingBatchStats, (), (queued_updates, merged_updates, merged_nodes, reapplied_nodes, commits)
+)
+
 struct RuntimeTaskConfig {
     std::shared_ptr<lib_utils::TaskScheduler> task_scheduler;
     lib_utils::TaskScheduler::Group gui_group;
@@ -55,6 +74,7 @@ public:
     using BindingValueHandler =
         std::function<void(std::string_view absolute_path, std::string_view key, std::string_view value)>;
     using AnimationCompletedHandler = std::function<void()>;
+    using BindingBatchPendingHandler = std::function<void(DocumentId id)>;
 
     explicit Runtime(std::unique_ptr<IBackend> backend);
     Runtime(std::unique_ptr<IBackend> backend, RuntimeTaskConfig task_config);
@@ -105,6 +125,16 @@ public:
     void process_backend();
     void set_view_debug_enabled(bool enabled);
     bool is_view_debug_enabled() const;
+    // While enabled, binding updates only reach the data store; widgets pick them up on the next commit,
+    // which process_backend() performs once per frame. View accessors, animations and scrolls commit the
+    // document first, so they never act on stale props. Disabling commits whatever is pending.
+    void set_binding_batching_enabled(bool enabled);
+    bool is_binding_batching_enabled() const;
+    // Called when a document's batch goes from empty to pending, so the owner can schedule the next commit
+    void set_binding_batch_pending_handler(BindingBatchPendingHandler handler);
+    void commit_binding_updates();
+    void commit_binding_updates(DocumentId id);
+    BindingBatchStats get_binding_batch_stats() const;
     std::expected<void, std::string> enable_live_preview(DocumentId id, const LivePreviewOptions &options = {});
     bool disable_live_preview(DocumentId id);
     void poll_live_preview();
@@ -181,6 +211,16 @@ public:
         std::string_view key,
         std::string value) const;
     void set_binding_values(DocumentId id, const std::vector<BindingValueUpdate> &updates) const;
+    void set_typed_binding_value(
+        DocumentId id,
+        std::string_view absolute_path,
+        std::string_view key,
+        DataValue value) const;
+    void set_typed_binding_values(DocumentId id, const std::vector<TypedBindingValueUpdate> &updates) const;
+    std::optional<DataValue> get_typed_binding_value(
+        DocumentId id,
+        std::string_view absolute_path,
+        std::string_view key) const;
     std::optional<std::string> get_binding_value(
         DocumentId id,
         std::string_view absolute_path,
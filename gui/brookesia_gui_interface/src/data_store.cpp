@@ -10,6 +10,10 @@
 #endif
 #include "private/utils.hpp"
 
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <utility>
 
@@ -28,14 +32,241 @@ std::string make_scoped_store_key(DocumentId document_id, std::string_view absol
            "|key:" + std::string(key);
 }
 
+template<typename T>
+std::optional<T> parse_number(std::string_view text)
+{
+    T result {};
+    const auto end = text.data() + text.size();
+    const auto [ptr, error_code] = std::from_chars(text.data(), end, result);
+    if (text.empty() || error_code != std::errc() || ptr != end) {
+        return std::nullopt;
+    }
+    return result;
+}
+
 } // namespace
 
+std::string DataValue::to_string() const
+{
+    switch (type()) {
+    case DataValueType::String:
+        return std::get<std::string>(*this);
+    case DataValueType::Bool:
+        return std::get<bool>(*this) ? "true" : "false";
+    case DataValueType::Int:
+        return std::to_string(std::get<int32_t>(*this));
+    case DataValueType::Float: {
+        std::array<char, 32> buffer {};
+        const auto [ptr, error_code] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), std::get<float>(*this));
+        return error_code == std::errc() ? std::string(buffer.data(), ptr) : std::string();
+    }
+    case DataValueType::Color: {
+        std::array<char, 7> buffer {'#', '0', '0', '0', '0', '0', '0'};
+        const uint32_t rgb = std::get<DataColor>(*this).rgb & 0xFFFFFFU;
+        for (size_t i = 0; i < 6; i++) {
+            buffer[6 - i] = "0123456789abcdef"[(rgb >> (i * 4)) & 0xFU];
+        }
+        return std::string(buffer.data(), buffer.size());
+    }
+    }
+    return {};
+}
+
+std::optional<bool> DataValue::to_bool() const
+{
+    if (const auto *value = std::get_if<bool>(this)) {
+        return *value;
+    }
+    if (const auto *text = std::get_if<std::string>(this)) {
+        if (*text == "true") {
+            return true;
+        }
+        if (*text == "false") {
+            return false;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<int32_t> DataValue::to_int() const
+{
+    if (const auto *value = std::get_if<int32_t>(this)) {
+        return *value;
+    }
+    if (const auto *value = std::get_if<float>(this)) {
+        // Round in double so the int32_t bounds are exact; std::lround() overflows where long is 32-bit
+        if (!std::isfinite(*value)) {
+            return std::nullopt;
+        }
+        const double rounded = std::round(static_cast<double>(*value));
+        if ((rounded < static_cast<double>(std::numeric_limits<int32_t>::min())) ||
+                (rounded > static_cast<double>(std::numeric_limits<int32_t>::max()))) {
+            return std::nullopt;
+        }
+        return static_cast<int32_t>(rounded);
+    }
+    if (const auto *text = std::get_if<std::string>(this)) {
+        return parse_number<int32_t>(*text);
+    }
+    return std::nullopt;
+}
+
+std::optional<float> DataValue::to_float() const
+{
+    if (const auto *value = std::get_if<float>(this)) {
+        return *value;
+    }
+    if (const auto *value = std::get_if<int32_t>(this)) {
+        return static_cast<float>(*value);
+    }
+    if (const auto *text = std::get_if<std::string>(this)) {
+        return parse_number<float>(*text);
+    }
+    return std::nullopt;
+}
+
+std::optional<DataColor> DataValue::to_color() const
+{
+    if (const auto *value = std::get_if<DataColor>(this)) {
+        return *value;
+    }
+    if (const auto *text = std::get_if<std::string>(this)) {
+        if (text->size() != 7 || text->front() != '#') {
+            return std::nullopt;
+        }
+        uint32_t rgb = 0;
+        const auto end = text->data() + text->size();
+        const auto [ptr, error_code] = std::from_chars(text->data() + 1, end, rgb, 16);
+        if (error_code != std::errc() || ptr != end) {
+            return std::nullopt;
+        }
+        return DataColor{.rgb = rgb};
+    }
+    return std::nullopt;
+}
+
+std::optional<DataValue> IDataStore::get_value(std::string_view key) const
+{
+    auto value = get_string(key);
+    if (!value.has_value()) {
+        return std::nullopt;
+    }
+    return DataValue(std::move(*value));
+}
+
+std::optional<DataValue> IDataStore::get_value(
+    DocumentId document_id,
+    std::string_view absolute_path,
+    std::string_view key) const
+{
+    auto value = get_string(document_id, absolute_path, key);
+    if (!value.has_value()) {
+        return std::nullopt;
+    }
+    return DataValue(std::move(*value));
+}
+
+void IDataStore::set_value(std::string_view key, DataValue value)
+{
+    set_string(key, value.to_string());
+}
+
+void IDataStore::set_value(
+    DocumentId document_id,
+    std::string_view absolute_path,
+    std::string_view key,
+    DataValue value)
+{
+    set_string(document_id, absolute_path, key, value.to_string());
+}
+
+IDataStore::SubscriptionId IDataStore::subscribe_value(std::string_view key, ValueListener listener)
+{
+    return subscribe(key, [listener = std::move(listener)](std::string_view changed_key, std::string_view value) {
+        listener(changed_key, DataValue(std::string(value)));
+    });
+}
+
+IDataStore::SubscriptionId IDataStore::subscribe_value(
+    DocumentId document_id,
+    std::string_view absolute_path,
+    std::string_view key,
+    ValueListener listener)
+{
+    return subscribe(
+               document_id, absolute_path, key,
+    [listener = std::move(listener)](std::string_view changed_key, std::string_view value) {
+        listener(changed_key, DataValue(std::string(value)));
+    }
+           );
+}
+
+void IDataStore::set_bool(DocumentId document_id, std::string_view absolute_path, std::string_view key, bool value)
+{
+    set_value(document_id, absolute_path, key, DataValue(value));
+}
+
+void IDataStore::set_int(DocumentId document_id, std::string_view absolute_path, std::string_view key, int32_t value)
+{
+    set_value(document_id, absolute_path, key, DataValue(value));
+}
+
+void IDataStore::set_float(DocumentId document_id, std::string_view absolute_path, std::string_view key, float value)
+{
+    set_value(document_id, absolute_path, key, DataValue(value));
+}
+
+void IDataStore::set_color(
+    DocumentId document_id,
+    std::string_view absolute_path,
+    std::string_view key,
+    DataColor value)
+{
+    set_value(document_id, absolute_path, key, DataValue(value));
+}
+
+std::optional<bool> IDataStore::get_bool(
+    DocumentId document_id,
+    std::string_view absolute_path,
+    std::string_view key) const
+{
+    auto value = get_value(document_id, absolute_path, key);
+    return value.has_value() ? value->to_bool() : std::nullopt;
+}
+
+std::optional<int32_t> IDataStore::get_int(
+    DocumentId document_id,
+    std::string_view absolute_path,
+    std::string_view key) const
+{
+    auto value = get_value(document_id, absolute_path, key);
+    return value.has_value() ? value->to_int() : std::nullopt;
+}
+
+std::optional<float> IDataStore::get_float(
+    DocumentId document_id,
+    std::string_view absolute_path,
+    std::string_view key) const
+{
+    auto value = get_value(document_id, absolute_path, key);
+    return value.has_value() ? value->to_float() : std::nullopt;
+}
+
+std::optional<DataColor> IDataStore::get_color(
+    DocumentId document_id,
+    std::string_view absolute_path,
+    std::string_view key) const
+{
+    auto value = get_value(document_id, absolute_path, key);
+    return value.has_value() ? value->to_color() : std::nullopt;
+}
+
 class MemoryDataStore::Impl {
 public:
-    using Signal = esp_brookesia::lib_utils::signal<void(std::string_view, std::string_view)>;
+    using Signal = esp_brookesia::lib_utils::signal<void(std::string_view, const DataValue &)>;
 
     mutable boost::mutex mutex;
-    boost::unordered_flat_map<std::string, std::string> values;
+    boost::unordered_flat_map<std::string, DataValue> values;
     boost::unordered_flat_map<std::string, std::shared_ptr<Signal>> signals;
     boost::unordered_flat_map<SubscriptionId, esp_brookesia::lib_utils::connection> connections;
     SubscriptionId next_subscription_id = 1;
@@ -55,12 +286,14 @@ std::optional<std::string> MemoryDataStore::get_string(std::string_view key) con
 
     BROOKESIA_LOGD("Params: key(%1%)", key);
 
-    boost::lock_guard lock(impl_->mutex);
-    auto it = impl_->values.find(std::string(key));
-    if (it == impl_->values.end()) {
+    auto value = get_value(key);
+    if (!value.has_value()) {
         return std::nullopt;
     }
-    return it->second;
+    if (auto *text = std::get_if<std::string>(&*value)) {
+        return std::move(*text);
+    }
+    return value->to_string();
 }
 
 std::optional<std::string> MemoryDataStore::get_string(
@@ -81,23 +314,7 @@ void MemoryDataStore::set_string(std::string_view key, std::string value)
 
     BROOKESIA_LOGD("Params: key(%1%), value(%2%)", key, value);
 
-    const std::string key_string(key);
-    std::string stored_value;
-    std::shared_ptr<Impl::Signal> signal;
-    {
-        boost::lock_guard lock(impl_->mutex);
-        impl_->values[key_string] = std::move(value);
-        stored_value = impl_->values.at(key_string);
-
-        auto signal_it = impl_->signals.find(key_string);
-        if (signal_it != impl_->signals.end()) {
-            signal = signal_it->second;
-        }
-    }
-
-    if (signal != nullptr) {
-        (*signal)(key_string, stored_value);
-    }
+    set_value(key, DataValue(std::move(value)));
 }
 
 void MemoryDataStore::set_string(
@@ -124,14 +341,14 @@ IDataStore::SubscriptionId MemoryDataStore::subscribe(std::string_view key, List
 
     BROOKESIA_LOGD("Params: key(%1%)", key);
 
-    boost::lock_guard lock(impl_->mutex);
-    const SubscriptionId id = impl_->next_subscription_id++;
-    auto &signal = impl_->signals[std::string(key)];
-    if (signal == nullptr) {
-        signal = std::make_shared<Impl::Signal>();
-    }
-    impl_->connections.emplace(id, signal->connect(listener));
-    return id;
+    // Listeners of the string API only pay for formatting when a typed value is stored
+    return subscribe_value(key, [listener = std::move(listener)](std::string_view changed_key, const DataValue & value) {
+        if (const auto *text = std::get_if<std::string>(&value)) {
+            listener(changed_key, *text);
+            return;
+        }
+        listener(changed_key, value.to_string());
+    });
 }
 
 IDataStore::SubscriptionId MemoryDataStore::subscribe(
@@ -163,6 +380,105 @@ void MemoryDataStore::unsubscribe(SubscriptionId id)
     impl_->connections.erase(it);
 }
 
+std::optional<DataValue> MemoryDataStore::get_value(std::string_view key) const
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    BROOKESIA_LOGD("Params: key(%1%)", key);
+
+    boost::lock_guard lock(impl_->mutex);
+    auto it = impl_->values.find(std::string(key));
+    if (it == impl_->values.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::optional<DataValue> MemoryDataStore::get_value(
+    DocumentId document_id,
+    std::string_view absolute_path,
+    std::string_view key) const
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    BROOKESIA_LOGD("Params: document_id(%1%), absolute_path(%2%), key(%3%)", document_id, absolute_path, key);
+
+    return get_value(make_scoped_store_key(document_id, absolute_path, key));
+}
+
+void MemoryDataStore::set_value(std::string_view key, DataValue value)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    BROOKESIA_LOGD("Params: key(%1%), value(%2%)", key, value);
+
+    const std::string key_string(key);
+    DataValue stored_value;
+    std::shared_ptr<Impl::Signal> signal;
+    {
+        boost::lock_guard lock(impl_->mutex);
+        auto &slot = impl_->values[key_string];
+        slot = std::move(value);
+
+        auto signal_it = impl_->signals.find(key_string);
+        if (signal_it != impl_->signals.end()) {
+            signal = signal_it->second;
+            stored_value = slot;
+        }
+    }
+
+    if (signal != nullptr) {
+        (*signal)(key_string, stored_value);
+    }
+}
+
+void MemoryDataStore::set_value(
+    DocumentId document_id,
+    std::string_view absolute_path,
+    std::string_view key,
+    DataValue value)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    BROOKESIA_LOGD(
+        "Params: document_id(%1%), absolute_path(%2%), key(%3%), value(%4%)",
+        document_id,
+        absolute_path,
+        key,
+        value);
+
+    set_value(make_scoped_store_key(document_id, absolute_path, key), std::move(value));
+}
+
+IDataStore::SubscriptionId MemoryDataStore::subscribe_value(std::string_view key, ValueListener listener)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    BROOKESIA_LOGD("Params: key(%1%)", key);
+
+    boost::lock_guard lock(impl_->mutex);
+    const SubscriptionId id = impl_->next_subscription_id++;
+    auto &signal = impl_->signals[std::string(key)];
+    if (signal == nullptr) {
+        signal = std::make_shared<Impl::Signal>();
+    }
+    impl_->connections.emplace(id, signal->connect(std::move(listener)));
+    return id;
+}
+
+IDataStore::SubscriptionId MemoryDataStore::subscribe_value(
+    DocumentId document_id,
+    std::string_view absolute_path,
+    std::string_view key,
+    ValueListener listener)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    BROOKESIA_LOGD("Params: document_id(%1%), absolute_path(%2%), key(%3%)", document_id, absolute_path, key);
+
+    return subscribe_value(make_scoped_store_key(document_id, absolute_path, key), std::move(listener));
+}
+
 void MemoryDataStore::forget_document(DocumentId document_id)
 {
     BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
@@ -34,6 +34,7 @@
 #include <unordered_map>
 #include <system_error>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "brookesia/lib_utils/signal.hpp"
@@ -122,6 +123,24 @@ static std::string build_fast_action_route_key(
     return key;
 }
 
+static std::string build_binding_route_key(std::string_view absolute_path, std::string_view key)
+{
+    std::string route_key;
+    route_key.reserve(absolute_path.size() + key.size() + 1);
+    route_key.append(absolute_path);
+    route_key.push_back('\x1f');
+    route_key.append(key);
+    return route_key;
+}
+
+static std::string build_pending_binding_key(uint64_t uid, std::string_view binding_path)
+{
+    std::string pending_key = std::to_string(uid);
+    pending_key.push_back('\x1f');
+    pending_key.append(binding_path);
+    return pending_key;
+}
+
 static std::string path_to_string(const Path &path)
 {
     std::ostringstream oss;
@@ -358,6 +377,117 @@ static std::expected<int32_t, std::string> parse_scaled_from_store_string(
     return *integer_value;
 }
 
+// Shares the float rounding and int32_t range check of `DataValue::to_int()`
+static std::expected<int32_t, std::string> read_int_binding_value(const DataValue &value)
+{
+    auto integer = value.to_int();
+    if (!integer) {
+        return std::unexpected("expected integer");
+    }
+    return *integer;
+}
+
+static std::expected<bool, std::string> read_bool_binding_value(const DataValue &value)
+{
+    if (const auto *text = std::get_if<std::string>(&value); text != nullptr) {
+        return parse_bool_from_store_string(*text);
+    }
+    if (const auto *flag = std::get_if<bool>(&value); flag != nullptr) {
+        return *flag;
+    }
+    return std::unexpected("expected 'true' or 'false'");
+}
+
+// Typed numbers carry no unit and are taken as px, like a bare integer string
+static std::expected<int32_t, std::string> read_scaled_binding_value(
+    const DataValue &value,
+    std::string_view field_name,
+    std::string_view unit,
+    float scale)
+{
+    if (const auto *text = std::get_if<std::string>(&value); text != nullptr) {
+        return parse_scaled_from_store_string(*text, field_name, unit, scale);
+    }
+    auto integer_value = read_int_binding_value(value);
+    if (!integer_value) {
+        return std::unexpected(
+                   "field '" + std::string(field_name) + "' must use " + std::string(unit) +
+                   " units or an integer px value"
+               );
+    }
+    return *integer_value;
+}
+
+// Targets whose `apply_binding_value` branch only goes through the `read_*_binding_value()` helpers above.
+// Missing a target here is harmless, it just formats typed values back to text before parsing them.
+static bool binding_target_reads_typed_value(BindingTarget target)
+{
+    switch (target) {
+    case BindingTarget::CommonPropsHidden:
+    case BindingTarget::CommonPropsDisabled:
+    case BindingTarget::CommonPropsClickable:
+    case BindingTarget::CommonPropsScrollable:
+    case BindingTarget::CommonPropsPressLock:
+    case BindingTarget::CommonPropsAngle:
+    case BindingTarget::CommonPropsZoom:
+    case BindingTarget::ImagePropsRecolorOpacity:
+    case BindingTarget::ImagePropsAngle:
+    case BindingTarget::ImagePropsOffsetX:
+    case BindingTarget::ImagePropsOffsetY:
+    case BindingTarget::ImagePropsZoom:
+    case BindingTarget::FrameViewPropsAutoRegisterOutput:
+    case BindingTarget::TextInputPropsPassword:
+    case BindingTarget::TextInputPropsMultiline:
+    case BindingTarget::TextInputPropsMaxLength:
+    case BindingTarget::RangePropsValue:
+    case BindingTarget::RangePropsMin:
+    case BindingTarget::RangePropsMax:
+    case BindingTarget::RangePropsStep:
+    case BindingTarget::TogglePropsChecked:
+    case BindingTarget::DropdownPropsSelectedIndex:
+    case BindingTarget::TablePropsRows:
+    case BindingTarget::TablePropsColumns:
+    case BindingTarget::KeyboardPropsPopovers:
+    case BindingTarget::StyleBgMainStop:
+    case BindingTarget::StyleBgGradientStop:
+    case BindingTarget::StyleBgGradientOpacity:
+    case BindingTarget::StyleOpacity:
+    case BindingTarget::StyleImageOpacity:
+    case BindingTarget::StyleImageRecolorOpacity:
+    case BindingTarget::StyleArcOpacity:
+    case BindingTarget::StyleArcGradientSegments:
+    case BindingTarget::StyleBorderWidth:
+    case BindingTarget::StyleRadius:
+    case BindingTarget::StylePadding:
+    case BindingTarget::StylePaddingLeft:
+    case BindingTarget::StylePaddingRight:
+    case BindingTarget::StylePaddingTop:
+    case BindingTarget::StylePaddingBottom:
+    case BindingTarget::StyleMargin:
+    case BindingTarget::StyleMarginLeft:
+    case BindingTarget::StyleMarginRight:
+    case BindingTarget::StyleMarginTop:
+    case BindingTarget::StyleMarginBottom:
+    case BindingTarget::StyleShadowWidth:
+    case BindingTarget::StyleShadowOffsetX:
+    case BindingTarget::StyleShadowOffsetY:
+    case BindingTarget::StyleLineWidth:
+    case BindingTarget::StyleArcWidth:
+    case BindingTarget::StyleFontSize:
+    case BindingTarget::StyleImageFontSize:
+    case BindingTarget::StyleArcRounded:
+    case BindingTarget::LayoutGap:
+    case BindingTarget::PlacementGridColumn:
+    case BindingTarget::PlacementGridRow:
+    case BindingTarget::PlacementGridColumnSpan:
+    case BindingTarget::PlacementGridRowSpan:
+    case BindingTarget::PlacementFlexGrow:
+        return true;
+    default:
+        return false;
+    }
+}
+
 static std::expected<Dimension, std::string> parse_dimension_from_store_string(
     std::string_view value,
     const Environment &environment)
@@ -761,6 +891,22 @@ public:
         PlacementApplyMask placement = PlacementApplyMask::None;
     };
 
+    // One binding declaration compiled when its node record is created, so batched updates never have to
+    // re-parse binding paths or store keys
+    struct BindingRoute {
+        uint64_t uid = 0;
+        std::string binding_path;
+        BindingTargetInfo target_info;
+    };
+
+    // Latest value of one node binding, waiting for the next commit while binding batching is enabled
+    struct PendingBindingUpdate {
+        uint64_t uid = 0;
+        std::string binding_path;
+        BindingTargetInfo target_info;
+        DataValue value;
+    };
+
     struct SubtreeBuildProfile {
         size_t nodes = 0;
         int64_t copy_definition_us = 0;
@@ -825,6 +971,11 @@ public:
         boost::unordered_node_map<uint64_t, NodeRecord> nodes;
         boost::unordered_flat_map<BackendHandle::Value, uint64_t> handle_to_uid;
         boost::unordered_flat_map<std::string, uint64_t> absolute_path_to_uid;
+        // Keyed by build_binding_route_key(absolute_path, store_key), in node binding declaration order
+        boost::unordered_flat_map<std::string, std::vector<BindingRoute>> binding_routes;
+        // Queued in arrival order, indexed by build_pending_binding_key(uid, binding_path) so repeats collapse
+        std::vector<PendingBindingUpdate> pending_bindings;
+        boost::unordered_flat_map<std::string, size_t> pending_binding_index;
         std::vector<InstanceSnapshot> dynamic_instances;
         uint64_t next_uid = 1;
     };
@@ -1752,6 +1903,40 @@ public:
         return view_debug_enabled_;
     }
 
+    void set_binding_batching_enabled(bool enabled)
+    {
+        if (binding_batching_enabled_ == enabled) {
+            return;
+        }
+        binding_batching_enabled_ = enabled;
+        if (!enabled) {
+            commit_binding_updates();
+        }
+    }
+
+    bool is_binding_batching_enabled() const
+    {
+        return binding_batching_enabled_;
+    }
+
+    void set_binding_batch_pending_handler(Runtime::BindingBatchPendingHandler handler)
+    {
+        binding_batch_pending_handler_ = std::move(handler);
+    }
+
+    BindingBatchStats get_binding_batch_stats() const
+    {
+        return binding_batch_stats_;
+    }
+
+    // View accessors read and write node state directly, so whatever is still batched for the document lands first
+    void commit_pending_bindings(DocumentId document_id)
+    {
+        if (binding_batching_enabled_) {
+            commit_binding_updates(document_id);
+        }
+    }
+
     void poll_live_preview(Runtime *runtime)
     {
         const auto now = std::chrono::steady_clock::now();
@@ -4587,6 +4772,9 @@ public:
     TransientMountId::Value next_transient_mount_id_ = 1;
     uint64_t next_mounted_screen_sequence_ = 1;
     bool view_debug_enabled_ = false;
+    bool binding_batching_enabled_ = false;
+    Runtime::BindingBatchPendingHandler binding_batch_pending_handler_;
+    BindingBatchStats binding_batch_stats_;
 #if BROOKESIA_GUI_INTERFACE_ENABLE_MEMORY_TRACE
     size_t dbg_create_view_count_ = 0;
     size_t dbg_create_subtree_count_ = 0;
@@ -4859,7 +5047,7 @@ private:
         dbg_step_events_ += static_cast<int64_t>(dbg_s8) - static_cast<int64_t>(dbg_s9);
 #endif
         step_start = subtree_profile_now();
-        subscribe_bindings(document_id, *stored_record);
+        subscribe_bindings(document_id, tree, *stored_record);
         add_subtree_profile_time(subtree_build_profile_.subscribe_bindings_us, step_start);
 #if BROOKESIA_GUI_INTERFACE_ENABLE_MEMORY_TRACE
         const size_t dbg_s10 = dbg_ext_free();
@@ -4909,6 +5097,7 @@ private:
 
         tree.handle_to_uid.clear();
         tree.absolute_path_to_uid.clear();
+        tree.binding_routes.clear();
         tree.nodes.clear();
         tree.screen_roots.clear();
     }
@@ -4973,6 +5162,7 @@ private:
                 store->unsubscribe(subscription_id);
             }
             unregister_fast_action_routes(current_it->second);
+            unregister_binding_routes(tree, current_it->second);
             tree.absolute_path_to_uid.erase(current_it->second.absolute_path);
             tree.handle_to_uid.erase(current_it->second.handle.value());
             tree.nodes.erase(current_it);
@@ -5144,9 +5334,18 @@ private:
         TreeRecord &tree,
         NodeRecord &record,
         const BindingTargetInfo &target_info,
-        std::string_view value)
+        const DataValue &typed_value)
     {
         const auto target = target_info.target;
+        // Typed targets read `typed_value` directly, the others still parse text, so only they pay for formatting
+        std::string converted_text;
+        std::string_view value;
+        if (const auto *text = std::get_if<std::string>(&typed_value); text != nullptr) {
+            value = *text;
+        } else if (!binding_target_reads_typed_value(target)) {
+            converted_text = typed_value.to_string();
+            value = converted_text;
+        }
         Style *target_style = nullptr;
         if (target_info.style_part.empty()) {
             target_style = target_info.style_state.empty() ?
@@ -5160,7 +5359,7 @@ private:
         }
         switch (target) {
         case BindingTarget::CommonPropsHidden: {
-            auto parsed = parse_bool_from_store_string(value);
+            auto parsed = read_bool_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5168,7 +5367,7 @@ private:
             break;
         }
         case BindingTarget::CommonPropsDisabled: {
-            auto parsed = parse_bool_from_store_string(value);
+            auto parsed = read_bool_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5176,7 +5375,7 @@ private:
             break;
         }
         case BindingTarget::CommonPropsClickable: {
-            auto parsed = parse_bool_from_store_string(value);
+            auto parsed = read_bool_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5184,7 +5383,7 @@ private:
             break;
         }
         case BindingTarget::CommonPropsScrollable: {
-            auto parsed = parse_bool_from_store_string(value);
+            auto parsed = read_bool_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5192,7 +5391,7 @@ private:
             break;
         }
         case BindingTarget::CommonPropsPressLock: {
-            auto parsed = parse_bool_from_store_string(value);
+            auto parsed = read_bool_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5200,7 +5399,7 @@ private:
             break;
         }
         case BindingTarget::CommonPropsAngle: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5208,7 +5407,7 @@ private:
             break;
         }
         case BindingTarget::CommonPropsZoom: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5250,7 +5449,7 @@ private:
             record.node.image_props.recolor = std::string(value);
             break;
         case BindingTarget::ImagePropsRecolorOpacity: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5261,7 +5460,7 @@ private:
             break;
         }
         case BindingTarget::ImagePropsAngle: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5269,7 +5468,7 @@ private:
             break;
         }
         case BindingTarget::ImagePropsOffsetX: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5277,7 +5476,7 @@ private:
             break;
         }
         case BindingTarget::ImagePropsOffsetY: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5285,7 +5484,7 @@ private:
             break;
         }
         case BindingTarget::ImagePropsZoom: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5309,7 +5508,7 @@ private:
             break;
         }
         case BindingTarget::FrameViewPropsAutoRegisterOutput: {
-            auto parsed = parse_bool_from_store_string(value);
+            auto parsed = read_bool_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5335,7 +5534,7 @@ private:
             record.node.text_input_props.placeholder = std::string(value);
             break;
         case BindingTarget::TextInputPropsPassword: {
-            auto parsed = parse_bool_from_store_string(value);
+            auto parsed = read_bool_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5343,7 +5542,7 @@ private:
             break;
         }
         case BindingTarget::TextInputPropsMultiline: {
-            auto parsed = parse_bool_from_store_string(value);
+            auto parsed = read_bool_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5351,7 +5550,7 @@ private:
             break;
         }
         case BindingTarget::TextInputPropsMaxLength: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5362,7 +5561,7 @@ private:
         case BindingTarget::RangePropsMin:
         case BindingTarget::RangePropsMax:
         case BindingTarget::RangePropsStep: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5378,7 +5577,7 @@ private:
             break;
         }
         case BindingTarget::TogglePropsChecked: {
-            auto parsed = parse_bool_from_store_string(value);
+            auto parsed = read_bool_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5394,7 +5593,7 @@ private:
             break;
         }
         case BindingTarget::DropdownPropsSelectedIndex: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5403,7 +5602,7 @@ private:
         }
         case BindingTarget::TablePropsRows:
         case BindingTarget::TablePropsColumns: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5434,7 +5633,7 @@ private:
             record.node.keyboard_props.mode = std::string(value);
             break;
         case BindingTarget::KeyboardPropsPopovers: {
-            auto parsed = parse_bool_from_store_string(value);
+            auto parsed = read_bool_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5563,7 +5762,7 @@ private:
         case BindingTarget::StyleImageRecolorOpacity:
         case BindingTarget::StyleArcOpacity:
         case BindingTarget::StyleArcGradientSegments: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5624,7 +5823,7 @@ private:
             case BindingTarget::StyleArcWidth: field_name = "style.arcWidth"; break;
             default: break;
             }
-            auto parsed = parse_scaled_from_store_string(value, field_name, "dp", tree.environment.density);
+            auto parsed = read_scaled_binding_value(typed_value, field_name, "dp", tree.environment.density);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5666,8 +5865,8 @@ private:
             if (!target_info.style_state.empty() || !target_info.style_part.empty()) {
                 return std::unexpected("stateStyles and partStyles do not support fontSize");
             }
-            auto parsed = parse_scaled_from_store_string(
-                              value,
+            auto parsed = read_scaled_binding_value(
+                              typed_value,
                               "style.fontSize",
                               "sp",
                               tree.environment.density * tree.environment.font_scale
@@ -5682,8 +5881,8 @@ private:
             if (!target_info.style_state.empty() || !target_info.style_part.empty()) {
                 return std::unexpected("stateStyles and partStyles do not support imageFontSize");
             }
-            auto parsed = parse_scaled_from_store_string(
-                              value,
+            auto parsed = read_scaled_binding_value(
+                              typed_value,
                               "style.imageFontSize",
                               "sp",
                               tree.environment.density * tree.environment.font_scale
@@ -5695,7 +5894,7 @@ private:
             break;
         }
         case BindingTarget::StyleArcRounded: {
-            auto parsed = parse_bool_from_store_string(value);
+            auto parsed = read_bool_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5735,7 +5934,7 @@ private:
             break;
         }
         case BindingTarget::LayoutGap: {
-            auto parsed = parse_scaled_from_store_string(value, "layout.gap", "dp", tree.environment.density);
+            auto parsed = read_scaled_binding_value(typed_value, "layout.gap", "dp", tree.environment.density);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5817,7 +6016,7 @@ private:
         case BindingTarget::PlacementGridColumnSpan:
         case BindingTarget::PlacementGridRowSpan:
         case BindingTarget::PlacementFlexGrow: {
-            auto parsed = parse_int_from_store_string(value);
+            auto parsed = read_int_binding_value(typed_value);
             if (!parsed) {
                 return std::unexpected(parsed.error());
             }
@@ -5997,7 +6196,161 @@ private:
         return node != nullptr && node_has_binding_key(*node, key);
     }
 
-    void set_binding_values(DocumentId document_id, const std::vector<BindingValueUpdate> &updates)
+    // Only reached when no compiled route matches, so the tree walk here stays off the update hot path
+    template<typename Update>
+    void warn_unrouted_binding_update(
+        const TreeRecord &tree,
+        std::string_view query,
+        const Update &update
+    ) const
+    {
+        auto uid = resolve_any_uid(tree, query);
+        if (!uid.has_value()) {
+            if (!tree_has_binding_declaration_for_update(tree, query, update.key)) {
+                BROOKESIA_LOGW(
+                    "Binding update target not found and no matching binding declaration exists: "
+                    "document_id=%1%, path='%2%', key='%3%', value='%4%'",
+                    tree.document_id.value(), query, update.key, update.value
+                );
+            }
+            return;
+        }
+        auto *record = find_node_record_const(tree, *uid);
+        if (record == nullptr) {
+            return;
+        }
+        if (node_has_binding_key(record->node, update.key)) {
+            BROOKESIA_LOGW(
+                "Binding update matched only invalid binding declarations: document_id=%1%, path='%2%', key='%3%'",
+                tree.document_id.value(), record->absolute_path, update.key
+            );
+            return;
+        }
+        BROOKESIA_LOGW(
+            "Binding update path exists but no binding declaration matched key: "
+            "document_id=%1%, path='%2%', key='%3%', value='%4%', node_type=%5%",
+            tree.document_id.value(), record->absolute_path, update.key, update.value,
+            get_theme_style_key(record->node.type)
+        );
+    }
+
+    void merge_dirty_binding_node(
+        boost::unordered_flat_map<uint64_t, BindingApplyMasks> &dirty_nodes,
+        uint64_t uid,
+        const BindingTargetInfo &target_info)
+    {
+        auto [mask_it, inserted] = dirty_nodes.try_emplace(uid);
+        if (!inserted) {
+            binding_batch_stats_.merged_nodes++;
+        }
+        merge_binding_mask(mask_it->second, target_info);
+    }
+
+    void reapply_dirty_binding_nodes(
+        TreeRecord &tree,
+        const boost::unordered_flat_map<uint64_t, BindingApplyMasks> &dirty_nodes)
+    {
+        for (const auto &[uid, masks] : dirty_nodes) {
+            auto *record = find_node_record(tree, uid);
+            if (record == nullptr) {
+                continue;
+            }
+            reapply_binding_masks(tree, *record, masks);
+            binding_batch_stats_.reapplied_nodes++;
+        }
+    }
+
+    void queue_binding_update(
+        TreeRecord &tree,
+        uint64_t uid,
+        std::string_view binding_path,
+        const BindingTargetInfo &target_info,
+        DataValue value)
+    {
+        binding_batch_stats_.queued_updates++;
+        auto [index_it, inserted] = tree.pending_binding_index.try_emplace(
+                                        build_pending_binding_key(uid, binding_path), tree.pending_bindings.size()
+                                    );
+        if (!inserted) {
+            tree.pending_bindings[index_it->second].value = std::move(value);
+            binding_batch_stats_.merged_updates++;
+            return;
+        }
+
+        const bool was_idle = tree.pending_bindings.empty();
+        tree.pending_bindings.push_back(PendingBindingUpdate{
+            .uid = uid,
+            .binding_path = std::string(binding_path),
+            .target_info = target_info,
+            .value = std::move(value),
+        });
+        if (was_idle && binding_batch_pending_handler_) {
+            binding_batch_pending_handler_(tree.document_id);
+        }
+    }
+
+    void commit_binding_updates(TreeRecord &tree)
+    {
+        if (tree.pending_bindings.empty()) {
+            return;
+        }
+
+        // Detach the batch first, a listener fired while applying may queue into a fresh one
+        auto pending = std::move(tree.pending_bindings);
+        tree.pending_bindings.clear();
+        tree.pending_binding_index.clear();
+
+        boost::unordered_flat_map<uint64_t, BindingApplyMasks> dirty_nodes;
+        for (const auto &update : pending) {
+            auto *record = find_node_record(tree, update.uid);
+            if (record == nullptr) {
+                continue;
+            }
+            auto apply_result = apply_binding_value(tree, *record, update.target_info, update.value);
+            if (!apply_result) {
+                BROOKESIA_LOGW(
+                    "Failed to apply committed binding update: node='%1%', path='%2%', value='%3%', reason='%4%'",
+                    record->absolute_path,
+                    update.binding_path,
+                    update.value,
+                    apply_result.error()
+                );
+                continue;
+            }
+            merge_dirty_binding_node(dirty_nodes, update.uid, update.target_info);
+        }
+        reapply_dirty_binding_nodes(tree, dirty_nodes);
+        binding_batch_stats_.commits++;
+    }
+
+    void commit_binding_updates(DocumentId document_id)
+    {
+        auto *tree = resolve_tree(document_id);
+        if (tree != nullptr) {
+            commit_binding_updates(*tree);
+        }
+    }
+
+    void commit_binding_updates()
+    {
+        for (auto &[unused_document_id, tree] : trees) {
+            (void)unused_document_id;
+            commit_binding_updates(tree);
+        }
+    }
+
+    void store_binding_update(DocumentId document_id, const BindingValueUpdate &update)
+    {
+        store->set_string(document_id, update.absolute_path, update.key, update.value);
+    }
+
+    void store_binding_update(DocumentId document_id, const TypedBindingValueUpdate &update)
+    {
+        store->set_value(document_id, update.absolute_path, update.key, update.value);
+    }
+
+    template<typename Update>
+    void set_binding_values(DocumentId document_id, const std::vector<Update> &updates)
     {
         if (store == nullptr || updates.empty()) {
             return;
@@ -6011,75 +6364,44 @@ private:
         const bool previous_suppress = suppress_binding_listener_apply_;
         suppress_binding_listener_apply_ = true;
         for (const auto &update : updates) {
-            store->set_string(document_id, update.absolute_path, update.key, update.value);
+            store_binding_update(document_id, update);
         }
         suppress_binding_listener_apply_ = previous_suppress;
 
         boost::unordered_flat_map<uint64_t, BindingApplyMasks> dirty_nodes;
         for (const auto &update : updates) {
             const auto query = normalize_absolute_path(update.absolute_path);
-            auto uid = resolve_any_uid(*tree, query);
-            if (!uid.has_value()) {
-                if (!tree_has_binding_declaration_for_update(*tree, query, update.key)) {
-                    BROOKESIA_LOGW(
-                        "Binding update target not found and no matching binding declaration exists: "
-                        "document_id=%1%, path='%2%', key='%3%', value='%4%'",
-                        document_id.value(), query, update.key, update.value
-                    );
-                }
-                continue;
-            }
-            auto *record = find_node_record(*tree, *uid);
-            if (record == nullptr) {
+            auto route_it = tree->binding_routes.find(build_binding_route_key(query, update.key));
+            if (route_it == tree->binding_routes.end()) {
+                warn_unrouted_binding_update(*tree, query, update);
                 continue;
             }
-            bool matched_binding = false;
-            for (const auto &[binding_path, expression] : record->node.bindings) {
-                auto store_key = normalize_binding_store_key(expression);
-                if (!store_key || *store_key != update.key) {
+            for (const auto &route : route_it->second) {
+                if (binding_batching_enabled_) {
+                    queue_binding_update(
+                        *tree, route.uid, route.binding_path, route.target_info, DataValue(update.value)
+                    );
                     continue;
                 }
-                matched_binding = true;
-                auto binding_target = resolve_binding_target(record->node.type, binding_path);
-                if (!binding_target) {
-                    BROOKESIA_LOGW(
-                        "Skipping invalid batched binding path '%1%' on '%2%': %3%",
-                        binding_path,
-                        record->absolute_path,
-                        binding_target.error()
-                    );
+                auto *record = find_node_record(*tree, route.uid);
+                if (record == nullptr) {
                     continue;
                 }
-                auto apply_result = apply_binding_value(*tree, *record, *binding_target, update.value);
+                auto apply_result = apply_binding_value(*tree, *record, route.target_info, update.value);
                 if (!apply_result) {
                     BROOKESIA_LOGW(
                         "Failed to apply batched binding update: node='%1%', path='%2%', value='%3%', reason='%4%'",
                         record->absolute_path,
-                        binding_path,
+                        route.binding_path,
                         update.value,
                         apply_result.error()
                     );
                     continue;
                 }
-                merge_binding_mask(dirty_nodes[record->uid], *binding_target);
-            }
-            if (!matched_binding) {
-                BROOKESIA_LOGW(
-                    "Binding update path exists but no binding declaration matched key: "
-                    "document_id=%1%, path='%2%', key='%3%', value='%4%', node_type=%5%",
-                    document_id.value(), record->absolute_path, update.key, update.value,
-                    get_theme_style_key(record->node.type)
-                );
-            }
-        }
-
-        for (auto &[uid, masks] : dirty_nodes) {
-            auto *record = find_node_record(*tree, uid);
-            if (record == nullptr) {
-                continue;
+                merge_dirty_binding_node(dirty_nodes, record->uid, route.target_info);
             }
-            reapply_binding_masks(*tree, *record, masks);
         }
+        reapply_dirty_binding_nodes(*tree, dirty_nodes);
 
 #if BROOKESIA_GUI_INTERFACE_ENABLE_MEMORY_TRACE
         {
@@ -6119,12 +6441,13 @@ private:
                 continue;
             }
 
-            auto value = store->get_string(tree.document_id, absolute_path, *store_key);
+            auto value = store->get_value(tree.document_id, absolute_path, *store_key);
             if (!value.has_value()) {
                 continue;
             }
-            if (binding_target->target == BindingTarget::ImagePropsSrc && !value->empty() &&
-                    !has_image_resource(tree, *value)) {
+            const auto *image_source = std::get_if<std::string>(&*value);
+            if (binding_target->target == BindingTarget::ImagePropsSrc && image_source != nullptr &&
+                    !image_source->empty() && !has_image_resource(tree, *image_source)) {
                 BROOKESIA_LOGD(
                     "Skip unavailable initial image binding: node='%1%', path='%2%', value='%3%'",
                     absolute_path,
@@ -7052,7 +7375,7 @@ private:
         }
     }
 
-    void subscribe_bindings(DocumentId document_id, NodeRecord &record)
+    void subscribe_bindings(DocumentId document_id, TreeRecord &tree, NodeRecord &record)
     {
         if (store == nullptr) {
             return;
@@ -7083,8 +7406,13 @@ private:
             }
 
             const auto target_info = *binding_target;
+            tree.binding_routes[build_binding_route_key(record.absolute_path, *store_key)].push_back(BindingRoute{
+                .uid = uid,
+                .binding_path = std::string(path),
+                .target_info = target_info,
+            });
             auto listener = [this, document_id, uid, path = std::string(path), target_info]
-            (std::string_view unused_key, std::string_view value) {
+            (std::string_view unused_key, const DataValue &value) {
                 (void)unused_key;
                 if (suppress_binding_listener_apply_) {
                     return;
@@ -7093,6 +7421,10 @@ private:
                 if (tree == nullptr) {
                     return;
                 }
+                if (binding_batching_enabled_) {
+                    queue_binding_update(*tree, uid, path, target_info, value);
+                    return;
+                }
                 auto *node_record = find_node_record(*tree, uid);
                 if (node_record == nullptr) {
                     return;
@@ -7110,11 +7442,33 @@ private:
                 }
                 reapply_binding_domain(*tree, *node_record, target_info);
             };
-            auto subscription_id = store->subscribe(document_id, record.absolute_path, *store_key, std::move(listener));
+            auto subscription_id =
+                store->subscribe_value(document_id, record.absolute_path, *store_key, std::move(listener));
             record.subscriptions.push_back(subscription_id);
         }
     }
 
+    void unregister_binding_routes(TreeRecord &tree, const NodeRecord &record)
+    {
+        for (const auto &[unused_binding_path, expression] : record.node.bindings) {
+            (void)unused_binding_path;
+            auto store_key = normalize_binding_store_key(expression);
+            if (!store_key) {
+                continue;
+            }
+            auto route_it = tree.binding_routes.find(build_binding_route_key(record.absolute_path, *store_key));
+            if (route_it == tree.binding_routes.end()) {
+                continue;
+            }
+            std::erase_if(route_it->second, [&record](const BindingRoute & route) {
+                return route.uid == record.uid;
+            });
+            if (route_it->second.empty()) {
+                tree.binding_routes.erase(route_it);
+            }
+        }
+    }
+
     void dispatch_backend_event(const BackendEvent &event)
     {
         for (auto &[unused_document_id, tree] : trees) {
@@ -7474,6 +7828,7 @@ std::expected<void, std::string> Runtime::release_preloaded_images(
 
 void Runtime::process_backend()
 {
+    impl_->commit_binding_updates();
     if (impl_->backend != nullptr) {
         impl_->backend->process_timers();
     }
@@ -7489,6 +7844,36 @@ bool Runtime::is_view_debug_enabled() const
     return impl_->is_view_debug_enabled();
 }
 
+void Runtime::set_binding_batching_enabled(bool enabled)
+{
+    impl_->set_binding_batching_enabled(enabled);
+}
+
+bool Runtime::is_binding_batching_enabled() const
+{
+    return impl_->is_binding_batching_enabled();
+}
+
+void Runtime::set_binding_batch_pending_handler(BindingBatchPendingHandler handler)
+{
+    impl_->set_binding_batch_pending_handler(std::move(handler));
+}
+
+void Runtime::commit_binding_updates()
+{
+    impl_->commit_binding_updates();
+}
+
+void Runtime::commit_binding_updates(DocumentId id)
+{
+    impl_->commit_binding_updates(id);
+}
+
+BindingBatchStats Runtime::get_binding_batch_stats() const
+{
+    return impl_->get_binding_batch_stats();
+}
+
 std::expected<void, std::string> Runtime::enable_live_preview(DocumentId id, const LivePreviewOptions &options)
 {
     return impl_->enable_live_preview(id, options);
@@ -7651,6 +8036,7 @@ std::vector<RuntimeImageResource> Runtime::list_image_resources(DocumentId id) c
 
 std::optional<ViewStateValue> Runtime::get_view_state(const View &view, ViewStateKind kind) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->get_view_state_internal(view, kind);
 }
 
@@ -7671,6 +8057,23 @@ void Runtime::set_binding_values(DocumentId id, const std::vector<BindingValueUp
     impl_->set_binding_values(id, updates);
 }
 
+void Runtime::set_typed_binding_value(
+    DocumentId id,
+    std::string_view absolute_path,
+    std::string_view key,
+    DataValue value) const
+{
+    if (impl_->store == nullptr) {
+        return;
+    }
+    impl_->store->set_value(id, absolute_path, key, std::move(value));
+}
+
+void Runtime::set_typed_binding_values(DocumentId id, const std::vector<TypedBindingValueUpdate> &updates) const
+{
+    impl_->set_binding_values(id, updates);
+}
+
 std::optional<std::string> Runtime::get_binding_value(
     DocumentId id,
     std::string_view absolute_path,
@@ -7679,6 +8082,14 @@ std::optional<std::string> Runtime::get_binding_value(
     return impl_->store == nullptr ? std::nullopt : impl_->store->get_string(id, absolute_path, key);
 }
 
+std::optional<DataValue> Runtime::get_typed_binding_value(
+    DocumentId id,
+    std::string_view absolute_path,
+    std::string_view key) const
+{
+    return impl_->store == nullptr ? std::nullopt : impl_->store->get_value(id, absolute_path, key);
+}
+
 SubscriptionId Runtime::subscribe_binding_value_with_id(
     DocumentId id,
     std::string_view absolute_path,
@@ -7791,6 +8202,7 @@ SubscriptionId Runtime::start_view_animation_with_id(
     const Animation &animation,
     AnimationCompletedHandler completed_handler)
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->start_view_animation_with_id(view, animation, std::move(completed_handler));
 }
 
@@ -7799,6 +8211,7 @@ RuntimeAnimationStartResult Runtime::start_view_animation_with_result(
     const Animation &animation,
     AnimationCompletedHandler completed_handler)
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->start_view_animation_with_result(view, animation, std::move(completed_handler));
 }
 
@@ -7807,6 +8220,7 @@ ScopedConnection Runtime::start_view_animation(
     const Animation &animation,
     AnimationCompletedHandler completed_handler)
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->start_view_animation(view, animation, std::move(completed_handler));
 }
 
@@ -7827,6 +8241,7 @@ std::string Runtime::get_view_absolute_path(const View &view) const
 
 std::optional<ViewStateValue> Runtime::get_view_state_internal(const View &view, ViewStateKind kind) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->get_view_state_internal(view, kind);
 }
 
@@ -7847,31 +8262,37 @@ bool Runtime::scroll_view_to(DocumentId id, std::string_view absolute_path, int3
 
 bool Runtime::scroll_view_to(const View &view, int32_t x, int32_t y, bool animated) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->scroll_view_to(view, x, y, animated);
 }
 
 bool Runtime::scroll_view_to_visible(const View &view, bool animated) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->scroll_view_to_visible(view, animated);
 }
 
 bool Runtime::set_view_hidden(const View &view, bool hidden) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->set_view_hidden(view, hidden);
 }
 
 bool Runtime::set_view_text(const View &view, std::string_view text) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->set_view_text(view, text);
 }
 
 std::string Runtime::get_view_text(const View &view) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->get_view_text(view);
 }
 
 bool Runtime::set_view_src(const View &view, std::string_view src) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->set_view_src(view, src);
 }
 
@@ -7882,41 +8303,49 @@ bool Runtime::set_view_src(DocumentId id, std::string_view absolute_path, std::s
 
 std::string Runtime::get_view_src(const View &view) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->get_view_src(view);
 }
 
 bool Runtime::set_view_value(const View &view, int32_t value) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->set_view_value(view, value);
 }
 
 int32_t Runtime::get_view_value(const View &view) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->get_view_value(view);
 }
 
 bool Runtime::set_view_checked(const View &view, bool checked) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->set_view_checked(view, checked);
 }
 
 bool Runtime::get_view_checked(const View &view) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->get_view_checked(view);
 }
 
 bool Runtime::set_view_selected_index(const View &view, int32_t index) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->set_view_selected_index(view, index);
 }
 
 int32_t Runtime::get_view_selected_index(const View &view) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->get_view_selected_index(view);
 }
 
 bool Runtime::set_table_cell_text(const View &view, int32_t row, int32_t column, std::string_view text) const
 {
+    impl_->commit_pending_bindings(view.document_id_);
     return impl_->set_table_cell_text(view, row, column, text);
 }
 
@@ -25,29 +25,39 @@ endif()
 add_subdirectory(${TEST_APP_DIR}/.. ${CMAKE_BINARY_DIR}/brookesia_gui_interface)
 
 file(GLOB TEST_APP_SRCS_CPP ${TEST_APP_MAIN_DIR}/*.cpp)
+# Benchmarks build into their own executable, which is not registered with CTest
+set(TEST_APP_BENCHMARK_SRCS_CPP ${TEST_APP_MAIN_DIR}/test_benchmark.cpp)
+list(REMOVE_ITEM TEST_APP_SRCS_CPP ${TEST_APP_BENCHMARK_SRCS_CPP})
 add_executable(test_brookesia_gui_interface ${TEST_APP_SRCS_CPP})
+add_executable(
+    benchmark_brookesia_gui_interface
+    ${TEST_APP_MAIN_DIR}/test_app_main.cpp
+    ${TEST_APP_BENCHMARK_SRCS_CPP}
+)
 
 find_package(Boost COMPONENTS unit_test_framework QUIET)
-if(Boost_unit_test_framework_FOUND)
-    target_link_libraries(test_brookesia_gui_interface PRIVATE Boost::unit_test_framework)
-    target_compile_definitions(test_brookesia_gui_interface PRIVATE BOOST_TEST_DYN_LINK)
-else()
-    if("${BROOKESIA_TEST_BOOST_ROOT}" STREQUAL "")
-        message(FATAL_ERROR "Boost.Test not found. Set BROOKESIA_TEST_BOOST_ROOT to an esp-boost/src path.")
+foreach(TEST_APP_TARGET test_brookesia_gui_interface benchmark_brookesia_gui_interface)
+    if(Boost_unit_test_framework_FOUND)
+        target_link_libraries(${TEST_APP_TARGET} PRIVATE Boost::unit_test_framework)
+        target_compile_definitions(${TEST_APP_TARGET} PRIVATE BOOST_TEST_DYN_LINK)
+    else()
+        if("${BROOKESIA_TEST_BOOST_ROOT}" STREQUAL "")
+            message(FATAL_ERROR "Boost.Test not found. Set BROOKESIA_TEST_BOOST_ROOT to an esp-boost/src path.")
+        endif()
+        target_include_directories(${TEST_APP_TARGET} PRIVATE ${BROOKESIA_TEST_BOOST_ROOT})
+        target_compile_definitions(${TEST_APP_TARGET} PRIVATE
+            BROOKESIA_LIB_UTILS_TEST_ADAPTER_USE_INCLUDED_BOOST_TEST=1
+        )
     endif()
-    target_include_directories(test_brookesia_gui_interface PRIVATE ${BROOKESIA_TEST_BOOST_ROOT})
-    target_compile_definitions(test_brookesia_gui_interface PRIVATE
-        BROOKESIA_LIB_UTILS_TEST_ADAPTER_USE_INCLUDED_BOOST_TEST=1
-    )
-endif()
 
-target_compile_features(test_brookesia_gui_interface PRIVATE cxx_std_23)
-target_include_directories(test_brookesia_gui_interface PRIVATE ${TEST_APP_MAIN_DIR})
-target_link_libraries(
-    test_brookesia_gui_interface
-    PRIVATE
-        brookesia::gui_interface
-)
+    target_compile_features(${TEST_APP_TARGET} PRIVATE cxx_std_23)
+    target_include_directories(${TEST_APP_TARGET} PRIVATE ${TEST_APP_MAIN_DIR})
+    target_link_libraries(
+        ${TEST_APP_TARGET}
+        PRIVATE
+            brookesia::gui_interface
+    )
+endforeach()
 
 enable_testing()
 add_test(NAME test_brookesia_gui_interface COMMAND test_brookesia_gui_interface)
@@ -0,0 +1,344 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "brookesia/gui_interface.hpp"
+
+using namespace esp_brookesia::gui;
+
+inline constexpr std::string_view BINDING_ROUTE_JSON = R"({
+    "version": "0.1.1",
+    "assets": [
+        {
+            "type": "viewScreen",
+            "id": "route_screen",
+            "children": [
+                {
+                    "type": "label",
+                    "id": "status",
+                    "bindings": {
+                        "labelProps.text": "status_text"
+                    },
+                    "labelProps": {
+                        "text": "Idle"
+                    }
+                },
+                {
+                    "type": "slider",
+                    "id": "level",
+                    "bindings": {
+                        "rangeProps.value": "level",
+                        "rangeProps.max": "level_max"
+                    },
+                    "rangeProps": {
+                        "value": 10,
+                        "min": 0,
+                        "max": 100
+                    }
+                }
+            ]
+        }
+    ]
+})";
+
+inline std::string append_child_path(std::string_view parent_path, std::string_view id)
+{
+    if (parent_path.empty() || parent_path == "/") {
+        return "/" + std::string(id);
+    }
+    auto result = std::string(parent_path);
+    if (result.back() != '/') {
+        result.push_back('/');
+    }
+    result.append(id);
+    return result;
+}
+
+class MockBackend final: public IBackend {
+public:
+    void set_event_sink(EventSink sink) override
+    {
+        event_sink_ = std::move(sink);
+    }
+
+    BackendHandle create_node(
+        const Node &node,
+        BackendHandle parent,
+        std::string_view parent_path,
+        std::string_view scope_root_absolute_path
+    ) override
+    {
+        (void)parent;
+        (void)scope_root_absolute_path;
+        const auto handle = BackendHandle(next_handle_++);
+        const auto absolute_path = append_child_path(parent_path, node.id);
+        path_to_handle_[absolute_path] = handle;
+        node_types_[handle.value()] = node.type;
+        create_count_++;
+        return handle;
+    }
+
+    void destroy_node(BackendHandle handle) override
+    {
+        destroyed_handles_.push_back(handle);
+    }
+
+    void apply_props(BackendHandle handle, const Node &node, PropsApplyMask mask = PropsApplyMask::All) override
+    {
+        (void)mask;
+        props_apply_count_++;
+        node_types_[handle.value()] = node.type;
+    }
+
+    void apply_layout(BackendHandle handle, const Layout &layout, LayoutApplyMask mask = LayoutApplyMask::All) override
+    {
+        (void)handle;
+        (void)layout;
+        (void)mask;
+        layout_apply_count_++;
+    }
+
+    void apply_placement(
+        BackendHandle handle, const Placement &placement, PlacementApplyMask mask = PlacementApplyMask::All
+    ) override
+    {
+        (void)handle;
+        (void)placement;
+        (void)mask;
+        placement_apply_count_++;
+    }
+
+    void apply_style(BackendHandle handle, const ResolvedStyle &style, StyleApplyMask mask = StyleApplyMask::All) override
+    {
+        (void)handle;
+        (void)style;
+        (void)mask;
+        style_apply_count_++;
+    }
+
+    void apply_debug_visual(BackendHandle handle, bool enabled) override
+    {
+        (void)handle;
+        debug_visual_enabled_ = enabled;
+    }
+
+    void apply_animations(BackendHandle handle, const std::vector<Animation> &animations) override
+    {
+        (void)handle;
+        animation_apply_count_ += animations.size();
+    }
+
+    std::optional<BackendAnimationStartResult> start_animation(
+        BackendHandle handle,
+        const Animation &animation,
+        std::function<void()> completed_handler = {}
+    ) override
+    {
+        (void)handle;
+        start_animation_count_++;
+        if (completed_handler) {
+            completed_handler();
+        }
+        return BackendAnimationStartResult{
+            .connection = ScopedConnection([]() {}),
+            .resolved_from = animation.from,
+            .resolved_to = animation.to,
+        };
+    }
+
+    void bind_events(BackendHandle handle, const std::vector<EventBinding> &events) override
+    {
+        bound_event_count_[handle.value()] = events.size();
+    }
+
+    std::vector<GuiDisplayInfo> list_displays() const override
+    {
+        return {{
+                .id = "display0",
+                .width_px = 320,
+                .height_px = 480,
+                .is_default = true,
+            }};
+    }
+
+    std::vector<GuiLayer> list_layers() const override
+    {
+        return {GuiLayer::Default, GuiLayer::System};
+    }
+
+    bool mount_screen(BackendHandle handle, const MountTarget &target) override
+    {
+        (void)target;
+        mounted_handles_.push_back(handle);
+        return handle.is_valid();
+    }
+
+    bool unmount_screen(BackendHandle handle) override
+    {
+        unmounted_handles_.push_back(handle);
+        return handle.is_valid();
+    }
+
+    bool register_font_resource(const RuntimeFontResource &resource) override
+    {
+        fonts_.push_back(resource);
+        return !resource.id.empty();
+    }
+
+    std::vector<RuntimeFontResource> list_font_resources() const override
+    {
+        return fonts_;
+    }
+
+    std::expected<void, std::string> preload_image_resource(const RuntimeImageResource &resource) override
+    {
+        if (resource.id.empty()) {
+            return std::unexpected("image id is empty");
+        }
+        images_.push_back(resource);
+        return {};
+    }
+
+    bool requires_preloaded_image_resource(const RuntimeImageResource &resource) const override
+    {
+        return resource.native_src == 0 && !resource.primary_src.empty();
+    }
+
+    void release_image_resource(const RuntimeImageResource &resource) override
+    {
+        released_image_ids_.push_back(resource.id);
+    }
+
+    std::optional<ViewFrame> get_node_frame(BackendHandle handle) const override
+    {
+        if (!handle.is_valid()) {
+            return std::nullopt;
+        }
+        return ViewFrame{.x = 1, .y = 2, .width = 100, .height = 40};
+    }
+
+    bool scroll_node_to(BackendHandle handle, int32_t x, int32_t y, bool animated) override
+    {
+        scroll_to_count_++;
+        last_scroll_to_handle_ = handle;
+        last_scroll_x_ = x;
+        last_scroll_y_ = y;
+        last_scroll_animated_ = animated;
+        return handle.is_valid();
+    }
+
+    bool scroll_node_to_visible(BackendHandle handle, bool animated) override
+    {
+        (void)animated;
+        scroll_count_++;
+        return handle.is_valid();
+    }
+
+    BackendHandle handle_for_path(std::string_view absolute_path) const
+    {
+        auto it = path_to_handle_.find(std::string(absolute_path));
+        return (it == path_to_handle_.end()) ? BackendHandle{} : it->second;
+    }
+
+    void emit_event(const BackendEvent &event)
+    {
+        if (event_sink_) {
+            event_sink_(event);
+        }
+    }
+
+    size_t create_count() const
+    {
+        return create_count_;
+    }
+
+    size_t start_animation_count() const
+    {
+        return start_animation_count_;
+    }
+
+    size_t props_apply_count() const
+    {
+        return props_apply_count_;
+    }
+
+    const std::vector<RuntimeImageResource> &preloaded_images() const
+    {
+        return images_;
+    }
+
+    const std::vector<std::string> &released_image_ids() const
+    {
+        return released_image_ids_;
+    }
+
+    bool debug_visual_enabled() const
+    {
+        return debug_visual_enabled_;
+    }
+
+    size_t scroll_to_count() const
+    {
+        return scroll_to_count_;
+    }
+
+    BackendHandle last_scroll_to_handle() const
+    {
+        return last_scroll_to_handle_;
+    }
+
+    int32_t last_scroll_x() const
+    {
+        return last_scroll_x_;
+    }
+
+    int32_t last_scroll_y() const
+    {
+        return last_scroll_y_;
+    }
+
+    bool last_scroll_animated() const
+    {
+        return last_scroll_animated_;
+    }
+
+private:
+    EventSink event_sink_;
+    BackendHandle::Value next_handle_ = 1;
+    std::map<std::string, BackendHandle> path_to_handle_;
+    std::map<BackendHandle::Value, NodeType> node_types_;
+    std::map<BackendHandle::Value, size_t> bound_event_count_;
+    std::vector<BackendHandle> mounted_handles_;
+    std::vector<BackendHandle> unmounted_handles_;
+    std::vector<BackendHandle> destroyed_handles_;
+    std::vector<RuntimeFontResource> fonts_;
+    std::vector<RuntimeImageResource> images_;
+    std::vector<std::string> released_image_ids_;
+    size_t create_count_ = 0;
+    size_t props_apply_count_ = 0;
+    size_t layout_apply_count_ = 0;
+    size_t placement_apply_count_ = 0;
+    size_t style_apply_count_ = 0;
+    size_t animation_apply_count_ = 0;
+    size_t start_animation_count_ = 0;
+    size_t scroll_to_count_ = 0;
+    size_t scroll_count_ = 0;
+    BackendHandle last_scroll_to_handle_;
+    int32_t last_scroll_x_ = 0;
+    int32_t last_scroll_y_ = 0;
+    bool last_scroll_animated_ = true;
+    bool debug_visual_enabled_ = false;
+};
@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "brookesia/gui_interface.hpp"
+#include "brookesia/lib_utils/log.hpp"
+#include "brookesia/lib_utils/test_adapter.hpp"
+#include "common.hpp"
+
+// The string case only uses the string binding API, so it also builds against a runtime without typed store
+// values. Define `BROOKESIA_GUI_INTERFACE_BENCHMARK_STRING_ONLY` to skip the typed case on such a tree, and compare
+// both cases of this tree against the string case there.
+
+namespace {
+
+constexpr int32_t BENCHMARK_UPDATE_COUNT = 10000;
+constexpr int32_t BENCHMARK_BATCH_SIZE = 100;
+
+class BindingBenchmark {
+public:
+    BindingBenchmark()
+        : runtime_(std::make_unique<MockBackend>())
+    {
+        Environment environment;
+        auto document_id = runtime_.load_json("test/routes.json", BINDING_ROUTE_JSON, "test", environment);
+        TEST_ASSERT_TRUE(document_id.has_value());
+        document_id_ = document_id.value();
+        TEST_ASSERT_TRUE(runtime_.mount_screen(document_id_, "/route_screen").has_value());
+    }
+
+    ~BindingBenchmark()
+    {
+        runtime_.unload(document_id_);
+    }
+
+    // Pushes `BENCHMARK_UPDATE_COUNT` updates of the slider value in batches, returns the elapsed time in us
+    template<typename MakeUpdate, typename Apply>
+    int64_t run(MakeUpdate make_update, Apply apply)
+    {
+        using Update = decltype(make_update(0));
+        std::vector<Update> batch;
+        batch.reserve(BENCHMARK_BATCH_SIZE);
+        const auto start = std::chrono::steady_clock::now();
+        for (int32_t i = 0; i < BENCHMARK_UPDATE_COUNT; i++) {
+            batch.push_back(make_update(i % 100));
+            if (batch.size() == static_cast<size_t>(BENCHMARK_BATCH_SIZE)) {
+                apply(runtime_, document_id_, batch);
+                batch.clear();
+            }
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now() - start
+               ).count();
+    }
+
+    int32_t slider_value()
+    {
+        return runtime_.find_view(document_id_, "/route_screen/level").as_slider().value();
+    }
+
+private:
+    Runtime runtime_;
+    DocumentId document_id_;
+};
+
+} // namespace
+
+BROOKESIA_TEST_CASE(
+    test_gui_interface_runtime_benchmarks_string_binding_value_updates,
+    "GUI interface runtime benchmarks 10k string binding updates",
+    "[gui][interface][runtime][benchmark]"
+)
+{
+    BindingBenchmark benchmark;
+    const auto elapsed_us = benchmark.run([](int32_t value) {
+        return BindingValueUpdate{
+            .absolute_path = "/route_screen/level",
+            .key = "level",
+            .value = std::to_string(value),
+        };
+    }, [](Runtime & runtime, DocumentId id, const std::vector<BindingValueUpdate> &batch) {
+        runtime.set_binding_values(id, batch);
+    });
+    TEST_ASSERT_EQUAL_INT32(99, benchmark.slider_value());
+
+    BROOKESIA_LOGI(
+        "%1% string binding updates in batches of %2%: %3% us", BENCHMARK_UPDATE_COUNT, BENCHMARK_BATCH_SIZE,
+        elapsed_us
+    );
+}
+
+#if !defined(BROOKESIA_GUI_INTERFACE_BENCHMARK_STRING_ONLY)
+BROOKESIA_TEST_CASE(
+    test_gui_interface_runtime_benchmarks_typed_binding_value_updates,
+    "GUI interface runtime benchmarks 10k typed binding updates",
+    "[gui][interface][runtime][benchmark]"
+)
+{
+    BindingBenchmark benchmark;
+    const auto elapsed_us = benchmark.run([](int32_t value) {
+        return TypedBindingValueUpdate{
+            .absolute_path = "/route_screen/level",
+            .key = "level",
+            .value = 99 - value,
+        };
+    }, [](Runtime & runtime, DocumentId id, const std::vector<TypedBindingValueUpdate> &batch) {
+        runtime.set_typed_binding_values(id, batch);
+    });
+    TEST_ASSERT_EQUAL_INT32(0, benchmark.slider_value());
+
+    BROOKESIA_LOGI(
+        "%1% typed binding updates in batches of %2%: %3% us", BENCHMARK_UPDATE_COUNT, BENCHMARK_BATCH_SIZE,
+        elapsed_us
+    );
+}
+#endif
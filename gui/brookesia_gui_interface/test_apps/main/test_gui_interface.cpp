@@ -4,15 +4,15 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <cstdint>
-#include <map>
-#include <optional>
+#include <limits>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
-#include <vector>
 
 #include "brookesia/gui_interface.hpp"
 #include "brookesia/lib_utils/test_adapter.hpp"
+#include "common.hpp"
 
 using namespace esp_brookesia::gui;
 
@@ -100,295 +100,6 @@ constexpr std::string_view IMAGE_BINDING_JSON = R"({
     ]
 })";
 
-std::string append_child_path(std::string_view parent_path, std::string_view id)
-{
-    if (parent_path.empty() || parent_path == "/") {
-        return "/" + std::string(id);
-    }
-    auto result = std::string(parent_path);
-    if (result.back() != '/') {
-        result.push_back('/');
-    }
-    result.append(id);
-    return result;
-}
-
-class MockBackend final: public IBackend {
-public:
-    void set_event_sink(EventSink sink) override
-    {
-        event_sink_ = std::move(sink);
-    }
-
-    BackendHandle create_node(
-        const Node &node,
-        BackendHandle parent,
-        std::string_view parent_path,
-        std::string_view scope_root_absolute_path
-    ) override
-    {
-        (void)parent;
-        (void)scope_root_absolute_path;
-        const auto handle = BackendHandle(next_handle_++);
-        const auto absolute_path = append_child_path(parent_path, node.id);
-        path_to_handle_[absolute_path] = handle;
-        node_types_[handle.value()] = node.type;
-        create_count_++;
-        return handle;
-    }
-
-    void destroy_node(BackendHandle handle) override
-    {
-        destroyed_handles_.push_back(handle);
-    }
-
-    void apply_props(BackendHandle handle, const Node &node, PropsApplyMask mask = PropsApplyMask::All) override
-    {
-        (void)mask;
-        props_apply_count_++;
-        node_types_[handle.value()] = node.type;
-    }
-
-    void apply_layout(BackendHandle handle, const Layout &layout, LayoutApplyMask mask = LayoutApplyMask::All) override
-    {
-        (void)handle;
-        (void)layout;
-        (void)mask;
-        layout_apply_count_++;
-    }
-
-    void apply_placement(
-        BackendHandle handle, const Placement &placement, PlacementApplyMask mask = PlacementApplyMask::All
-    ) override
-    {
-        (void)handle;
-        (void)placement;
-        (void)mask;
-        placement_apply_count_++;
-    }
-
-    void apply_style(BackendHandle handle, const ResolvedStyle &style, StyleApplyMask mask = StyleApplyMask::All) override
-    {
-        (void)handle;
-        (void)style;
-        (void)mask;
-        style_apply_count_++;
-    }
-
-    void apply_debug_visual(BackendHandle handle, bool enabled) override
-    {
-        (void)handle;
-        debug_visual_enabled_ = enabled;
-    }
-
-    void apply_animations(BackendHandle handle, const std::vector<Animation> &animations) override
-    {
-        (void)handle;
-        animation_apply_count_ += animations.size();
-    }
-
-    std::optional<BackendAnimationStartResult> start_animation(
-        BackendHandle handle,
-        const Animation &animation,
-        std::function<void()> completed_handler = {}
-    ) override
-    {
-        (void)handle;
-        start_animation_count_++;
-        if (completed_handler) {
-            completed_handler();
-        }
-        return BackendAnimationStartResult{
-            .connection = ScopedConnection([]() {}),
-            .resolved_from = animation.from,
-            .resolved_to = animation.to,
-        };
-    }
-
-    void bind_events(BackendHandle handle, const std::vector<EventBinding> &events) override
-    {
-        bound_event_count_[handle.value()] = events.size();
-    }
-
-    std::vector<GuiDisplayInfo> list_displays() const override
-    {
-        return {{
-                .id = "display0",
-                .width_px = 320,
-                .height_px = 480,
-                .is_default = true,
-            }};
-    }
-
-    std::vector<GuiLayer> list_layers() const override
-    {
-        return {GuiLayer::Default, GuiLayer::System};
-    }
-
-    bool mount_screen(BackendHandle handle, const MountTarget &target) override
-    {
-        (void)target;
-        mounted_handles_.push_back(handle);
-        return handle.is_valid();
-    }
-
-    bool unmount_screen(BackendHandle handle) override
-    {
-        unmounted_handles_.push_back(handle);
-        return handle.is_valid();
-    }
-
-    bool register_font_resource(const RuntimeFontResource &resource) override
-    {
-        fonts_.push_back(resource);
-        return !resource.id.empty();
-    }
-
-    std::vector<RuntimeFontResource> list_font_resources() const override
-    {
-        return fonts_;
-    }
-
-    std::expected<void, std::string> preload_image_resource(const RuntimeImageResource &resource) override
-    {
-        if (resource.id.empty()) {
-            return std::unexpected("image id is empty");
-        }
-        images_.push_back(resource);
-        return {};
-    }
-
-    bool requires_preloaded_image_resource(const RuntimeImageResource &resource) const override
-    {
-        return resource.native_src == 0 && !resource.primary_src.empty();
-    }
-
-    void release_image_resource(const RuntimeImageResource &resource) override
-    {
-        released_image_ids_.push_back(resource.id);
-    }
-
-    std::optional<ViewFrame> get_node_frame(BackendHandle handle) const override
-    {
-        if (!handle.is_valid()) {
-            return std::nullopt;
-        }
-        return ViewFrame{.x = 1, .y = 2, .width = 100, .height = 40};
-    }
-
-    bool scroll_node_to(BackendHandle handle, int32_t x, int32_t y, bool animated) override
-    {
-        scroll_to_count_++;
-        last_scroll_to_handle_ = handle;
-        last_scroll_x_ = x;
-        last_scroll_y_ = y;
-        last_scroll_animated_ = animated;
-        return handle.is_valid();
-    }
-
-    bool scroll_node_to_visible(BackendHandle handle, bool animated) override
-    {
-        (void)animated;
-        scroll_count_++;
-        return handle.is_valid();
-    }
-
-    BackendHandle handle_for_path(std::string_view absolute_path) const
-    {
-        auto it = path_to_handle_.find(std::string(absolute_path));
-        return (it == path_to_handle_.end()) ? BackendHandle{} : it->second;
-    }
-
-    void emit_event(const BackendEvent &event)
-    {
-        if (event_sink_) {
-            event_sink_(event);
-        }
-    }
-
-    size_t create_count() const
-    {
-        return create_count_;
-    }
-
-    size_t start_animation_count() const
-    {
-        return start_animation_count_;
-    }
-
-    size_t props_apply_count() const
-    {
-        return props_apply_count_;
-    }
-
-    const std::vector<RuntimeImageResource> &preloaded_images() const
-    {
-        return images_;
-    }
-
-    const std::vector<std::string> &released_image_ids() const
-    {
-        return released_image_ids_;
-    }
-
-    bool debug_visual_enabled() const
-    {
-        return debug_visual_enabled_;
-    }
-
-    size_t scroll_to_count() const
-    {
-        return scroll_to_count_;
-    }
-
-    BackendHandle last_scroll_to_handle() const
-    {
-        return last_scroll_to_handle_;
-    }
-
-    int32_t last_scroll_x() const
-    {
-        return last_scroll_x_;
-    }
-
-    int32_t last_scroll_y() const
-    {
-        return last_scroll_y_;
-    }
-
-    bool last_scroll_animated() const
-    {
-        return last_scroll_animated_;
-    }
-
-private:
-    EventSink event_sink_;
-    BackendHandle::Value next_handle_ = 1;
-    std::map<std::string, BackendHandle> path_to_handle_;
-    std::map<BackendHandle::Value, NodeType> node_types_;
-    std::map<BackendHandle::Value, size_t> bound_event_count_;
-    std::vector<BackendHandle> mounted_handles_;
-    std::vector<BackendHandle> unmounted_handles_;
-    std::vector<BackendHandle> destroyed_handles_;
-    std::vector<RuntimeFontResource> fonts_;
-    std::vector<RuntimeImageResource> images_;
-    std::vector<std::string> released_image_ids_;
-    size_t create_count_ = 0;
-    size_t props_apply_count_ = 0;
-    size_t layout_apply_count_ = 0;
-    size_t placement_apply_count_ = 0;
-    size_t style_apply_count_ = 0;
-    size_t animation_apply_count_ = 0;
-    size_t start_animation_count_ = 0;
-    size_t scroll_to_count_ = 0;
-    size_t scroll_count_ = 0;
-    BackendHandle last_scroll_to_handle_;
-    int32_t last_scroll_x_ = 0;
-    int32_t last_scroll_y_ = 0;
-    bool last_scroll_animated_ = true;
-    bool debug_visual_enabled_ = false;
-};
-
 } // namespace
 
 BROOKESIA_TEST_CASE(
@@ -597,6 +308,238 @@ BROOKESIA_TEST_CASE(
     TEST_ASSERT_TRUE(runtime.unload(document_id.value()));
 }
 
+BROOKESIA_TEST_CASE(
+    test_gui_interface_runtime_routes_batched_binding_updates,
+    "GUI interface runtime routes batched binding updates through compiled bindings",
+    "[gui][interface][runtime]"
+)
+{
+    auto backend = std::make_unique<MockBackend>();
+    auto *backend_ptr = backend.get();
+    Runtime runtime(std::move(backend));
+
+    Environment environment;
+    auto document_id = runtime.load_json("test/routes.json", BINDING_ROUTE_JSON, "test", environment);
+    TEST_ASSERT_TRUE(document_id.has_value());
+    auto mounted = runtime.mount_screen(document_id.value(), "/route_screen");
+    TEST_ASSERT_TRUE(mounted.has_value());
+
+    // Both slider bindings land on one node, so the batch reapplies props once per node
+    const auto props_before = backend_ptr->props_apply_count();
+    runtime.set_binding_values(document_id.value(), {
+        BindingValueUpdate{
+            .absolute_path = "/route_screen/status",
+            .key = "status_text",
+            .value = "Busy",
+        },
+        BindingValueUpdate{
+            .absolute_path = "route_screen/level/",
+            .key = "level_max",
+            .value = "200",
+        },
+        BindingValueUpdate{
+            .absolute_path = "/route_screen/level",
+            .key = "level",
+            .value = "150",
+        },
+    });
+    TEST_ASSERT_EQUAL_size_t(props_before + 2, backend_ptr->props_apply_count());
+    TEST_ASSERT_EQUAL_STRING(
+        "Busy", runtime.find_view(document_id.value(), "/route_screen/status").as_label().text().c_str()
+    );
+    TEST_ASSERT_EQUAL_INT32(150, runtime.find_view(document_id.value(), "/route_screen/level").as_slider().value());
+
+    // Keys without a binding declaration on that node are ignored
+    runtime.set_binding_values(document_id.value(), {
+        BindingValueUpdate{
+            .absolute_path = "/route_screen/status",
+            .key = "level",
+            .value = "Ignored",
+        },
+    });
+    TEST_ASSERT_EQUAL_size_t(props_before + 2, backend_ptr->props_apply_count());
+    TEST_ASSERT_EQUAL_STRING(
+        "Busy", runtime.find_view(document_id.value(), "/route_screen/status").as_label().text().c_str()
+    );
+    TEST_ASSERT_TRUE(runtime.unload(document_id.value()));
+}
+
+BROOKESIA_TEST_CASE(
+    test_gui_interface_runtime_batches_binding_updates_until_commit,
+    "GUI interface runtime batches binding updates until the next commit",
+    "[gui][interface][runtime]"
+)
+{
+    auto backend = std::make_unique<MockBackend>();
+    auto *backend_ptr = backend.get();
+    Runtime runtime(std::move(backend));
+
+    Environment environment;
+    auto document_id = runtime.load_json("test/routes.json", BINDING_ROUTE_JSON, "test", environment);
+    TEST_ASSERT_TRUE(document_id.has_value());
+    auto mounted = runtime.mount_screen(document_id.value(), "/route_screen");
+    TEST_ASSERT_TRUE(mounted.has_value());
+
+    size_t pending_notifications = 0;
+    runtime.set_binding_batch_pending_handler([&pending_notifications](DocumentId) {
+        pending_notifications++;
+    });
+    runtime.set_binding_batching_enabled(true);
+    TEST_ASSERT_TRUE(runtime.is_binding_batching_enabled());
+
+    const auto props_before = backend_ptr->props_apply_count();
+    auto slider = runtime.find_view(document_id.value(), "/route_screen/level").as_slider();
+    for (int32_t value = 20; value <= 60; value += 20) {
+        runtime.set_binding_values(document_id.value(), {
+            BindingValueUpdate{
+                .absolute_path = "/route_screen/level",
+                .key = "level",
+                .value = std::to_string(value),
+            },
+        });
+    }
+    runtime.set_binding_value(document_id.value(), "/route_screen/level", "level_max", "80");
+
+    // The store already holds the latest value, the backend waits for the commit
+    auto level = runtime.get_binding_value(document_id.value(), "/route_screen/level", "level");
+    TEST_ASSERT_TRUE(level.has_value());
+    TEST_ASSERT_EQUAL_STRING("60", level->c_str());
+    TEST_ASSERT_EQUAL_size_t(props_before, backend_ptr->props_apply_count());
+    TEST_ASSERT_EQUAL_size_t(1, pending_notifications);
+
+    runtime.process_backend();
+    TEST_ASSERT_EQUAL_INT32(60, slider.value());
+    TEST_ASSERT_EQUAL_size_t(props_before + 1, backend_ptr->props_apply_count());
+
+    auto stats = runtime.get_binding_batch_stats();
+    TEST_ASSERT_TRUE(stats.queued_updates == 4);
+    TEST_ASSERT_TRUE(stats.merged_updates == 2);
+    TEST_ASSERT_TRUE(stats.merged_nodes == 1);
+    TEST_ASSERT_TRUE(stats.reapplied_nodes == 1);
+    TEST_ASSERT_TRUE(stats.commits == 1);
+
+    // Disabling the batching commits what is still pending
+    runtime.set_binding_value(document_id.value(), "/route_screen/status", "status_text", "Done");
+    TEST_ASSERT_EQUAL_size_t(2, pending_notifications);
+    runtime.set_binding_batching_enabled(false);
+    TEST_ASSERT_EQUAL_STRING(
+        "Done", runtime.find_view(document_id.value(), "/route_screen/status").as_label().text().c_str()
+    );
+    TEST_ASSERT_TRUE(runtime.get_binding_batch_stats().commits == 2);
+    TEST_ASSERT_TRUE(runtime.unload(document_id.value()));
+}
+
+BROOKESIA_TEST_CASE(
+    test_gui_interface_runtime_commits_batched_bindings_before_view_access,
+    "GUI interface runtime commits batched bindings before animating or reading a view",
+    "[gui][interface][runtime]"
+)
+{
+    auto backend = std::make_unique<MockBackend>();
+    auto *backend_ptr = backend.get();
+    Runtime runtime(std::move(backend));
+
+    Environment environment;
+    auto document_id = runtime.load_json("test/routes.json", BINDING_ROUTE_JSON, "test", environment);
+    TEST_ASSERT_TRUE(document_id.has_value());
+    auto mounted = runtime.mount_screen(document_id.value(), "/route_screen");
+    TEST_ASSERT_TRUE(mounted.has_value());
+    runtime.set_binding_batching_enabled(true);
+
+    // The animation must start from the bound props, not from the ones before the batch
+    const auto props_before = backend_ptr->props_apply_count();
+    runtime.set_binding_value(document_id.value(), "/route_screen/level", "level", "70");
+    TEST_ASSERT_EQUAL_size_t(props_before, backend_ptr->props_apply_count());
+    Animation animation = {
+        .id = "fade",
+        .from = 0,
+        .to = 255,
+    };
+    auto animation_result =
+        runtime.start_view_animation_with_result(document_id.value(), "/route_screen/level", animation);
+    TEST_ASSERT_NOT_EQUAL(0, animation_result.subscription_id);
+    TEST_ASSERT_EQUAL_size_t(props_before + 1, backend_ptr->props_apply_count());
+    TEST_ASSERT_EQUAL_size_t(1, backend_ptr->start_animation_count());
+
+    // Nothing is left for the frame commit to reapply on top of the running animation
+    runtime.process_backend();
+    TEST_ASSERT_EQUAL_size_t(props_before + 1, backend_ptr->props_apply_count());
+
+    // Getters see the batched value too
+    runtime.set_binding_value(document_id.value(), "/route_screen/status", "status_text", "Ready");
+    TEST_ASSERT_EQUAL_STRING(
+        "Ready", runtime.find_view(document_id.value(), "/route_screen/status").as_label().text().c_str()
+    );
+    TEST_ASSERT_TRUE(runtime.get_binding_batch_stats().commits == 2);
+    TEST_ASSERT_TRUE(runtime.unload(document_id.value()));
+}
+
+BROOKESIA_TEST_CASE(
+    test_gui_interface_runtime_applies_typed_binding_values,
+    "GUI interface runtime applies typed binding values and keeps the string API in sync",
+    "[gui][interface][runtime]"
+)
+{
+    auto backend = std::make_unique<MockBackend>();
+    Runtime runtime(std::move(backend));
+
+    Environment environment;
+    auto document_id = runtime.load_json("test/routes.json", BINDING_ROUTE_JSON, "test", environment);
+    TEST_ASSERT_TRUE(document_id.has_value());
+    auto mounted = runtime.mount_screen(document_id.value(), "/route_screen");
+    TEST_ASSERT_TRUE(mounted.has_value());
+
+    runtime.set_typed_binding_values(document_id.value(), {
+        TypedBindingValueUpdate{
+            .absolute_path = "/route_screen/level",
+            .key = "level_max",
+            .value = 199.6F,
+        },
+        TypedBindingValueUpdate{
+            .absolute_path = "/route_screen/level",
+            .key = "level",
+            .value = 150,
+        },
+        TypedBindingValueUpdate{
+            .absolute_path = "/route_screen/status",
+            .key = "status_text",
+            .value = 42,
+        },
+    });
+    auto slider = runtime.find_view(document_id.value(), "/route_screen/level").as_slider();
+    TEST_ASSERT_EQUAL_INT32(150, slider.value());
+    TEST_ASSERT_EQUAL_STRING(
+        "42", runtime.find_view(document_id.value(), "/route_screen/status").as_label().text().c_str()
+    );
+
+    // The string API reads and writes the same entries
+    auto level = runtime.get_binding_value(document_id.value(), "/route_screen/level", "level");
+    TEST_ASSERT_TRUE(level.has_value());
+    TEST_ASSERT_EQUAL_STRING("150", level->c_str());
+    runtime.set_binding_value(document_id.value(), "/route_screen/level", "level", "120");
+    TEST_ASSERT_EQUAL_INT32(120, slider.value());
+    auto typed_level = runtime.get_typed_binding_value(document_id.value(), "/route_screen/level", "level");
+    TEST_ASSERT_TRUE(typed_level.has_value());
+    TEST_ASSERT_TRUE(typed_level->type() == DataValueType::String);
+    TEST_ASSERT_EQUAL_INT32(120, typed_level->to_int().value_or(0));
+
+    // A typed value of the wrong kind is rejected like an unparsable string
+    runtime.set_typed_binding_value(document_id.value(), "/route_screen/level", "level", DataColor{.rgb = 0x102030});
+    TEST_ASSERT_EQUAL_INT32(120, slider.value());
+
+    // Floats that have no int32_t value are rejected instead of overflowing the conversion
+    runtime.set_typed_binding_value(
+        document_id.value(), "/route_screen/level", "level", std::numeric_limits<float>::quiet_NaN()
+    );
+    TEST_ASSERT_EQUAL_INT32(120, slider.value());
+    runtime.set_typed_binding_value(document_id.value(), "/route_screen/level", "level", 3.0e9F);
+    TEST_ASSERT_EQUAL_INT32(120, slider.value());
+    TEST_ASSERT_FALSE(DataValue(3.0e9F).to_int().has_value());
+    TEST_ASSERT_FALSE(DataValue(-3.0e9F).to_int().has_value());
+    TEST_ASSERT_EQUAL_INT32(-8, DataValue(-7.6F).to_int().value_or(0));
+    TEST_ASSERT_TRUE(runtime.unload(document_id.value()));
+}
+
 BROOKESIA_TEST_CASE(
     test_gui_interface_runtime_preloads_set_view_src_image_sources,
     "GUI interface runtime preloads image resources introduced by set_view_src",
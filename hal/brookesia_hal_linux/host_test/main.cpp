@@ -344,6 +344,12 @@ bool test_video()
 bool test_display()
 {
     bool ok = true;
+    auto &display_device = hal::DisplayLinuxDevice::get_instance();
+    ok &= expect(display_device.configure({
+        .width_px = 320,
+        .height_px = 240,
+        .headless = true,
+    }), "display linux configures headless panel");
     auto panel = get_iface<hal::display::PanelIface>(hal::DisplayLinuxDevice::PANEL_IFACE_NAME, ok);
     auto touch = get_iface<hal::display::TouchIface>(hal::DisplayLinuxDevice::TOUCH_IFACE_NAME, ok);
     auto backlight = get_iface<hal::display::BacklightIface>(hal::DisplayLinuxDevice::BACKLIGHT_IFACE_NAME, ok);
@@ -359,11 +365,29 @@ bool test_display()
               "display panel format matches"
           );
 
+    const auto blank_stats = display_device.get_frame_stats();
+    ok &= expect(blank_stats.checksum != 0, "display headless framebuffer has a checksum");
+
     std::array<uint8_t, 8> pixels = {};
     ok &= expect(panel->draw_bitmap(0, 0, 2, 2, pixels.data()), "display panel draws valid bitmap");
     ok &= expect(!panel->draw_bitmap(0, 0, 321, 2, pixels.data()), "display panel rejects out-of-bounds draw");
     ok &= expect(!panel->draw_bitmap(0, 0, 2, 2, nullptr), "display panel rejects null bitmap");
 
+    auto stats = display_device.get_frame_stats();
+    ok &= expect(stats.frame_count == blank_stats.frame_count + 1, "display headless counts drawn frames");
+    ok &= expect(stats.drawn_pixels == blank_stats.drawn_pixels + 4, "display headless counts drawn pixels");
+    ok &= expect(stats.uploaded_pixels == 0, "display headless uploads nothing");
+    ok &= expect(stats.checksum == blank_stats.checksum, "display black bitmap keeps the blank checksum");
+
+    std::array<uint8_t, 8> white_pixels = {};
+    white_pixels.fill(0xFF);
+    ok &= expect(panel->draw_bitmap(2, 2, 4, 4, white_pixels.data()), "display panel draws white bitmap");
+    stats = display_device.get_frame_stats();
+    ok &= expect(stats.checksum != blank_stats.checksum, "display white bitmap changes the checksum");
+    ok &= expect(panel->draw_bitmap(2, 2, 4, 4, pixels.data()), "display panel clears white bitmap");
+    stats = display_device.get_frame_stats();
+    ok &= expect(stats.checksum == blank_stats.checksum, "display cleared bitmap restores the blank checksum");
+
     hal::display::PanelIface::DriverSpecific panel_specific = {};
     ok &= expect(panel->get_driver_specific(panel_specific), "display panel returns driver-specific placeholder");
     ok &= expect(panel_specific.bus_type == hal::display::PanelIface::BusType::Generic, "display panel bus is generic");
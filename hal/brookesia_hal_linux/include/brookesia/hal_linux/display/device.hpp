@@ -26,6 +26,14 @@ public:
         uint16_t height_px = 480;
         std::string window_title = "ESP-Brookesia HAL Linux Display";
         std::string render_driver = "software";
+        bool headless = false;  ///< Keep frames offscreen without creating a window
+    };
+
+    struct FrameStats {
+        uint64_t frame_count = 0;      ///< Frames presented, or bitmaps drawn when headless
+        uint64_t drawn_pixels = 0;     ///< Pixels converted into the framebuffer
+        uint64_t uploaded_pixels = 0;  ///< Pixels uploaded to the SDL2 texture
+        uint32_t checksum = 0;         ///< FNV-1a of the ARGB8888 framebuffer, 0 when there is none
     };
 
     static constexpr const char *DEVICE_NAME = "DisplayLinux";
@@ -47,6 +55,7 @@ public:
     bool configure(Config config);
     Config get_config() const;
     bool is_quit_requested() const;
+    FrameStats get_frame_stats() const;
 
 private:
     DisplayLinuxDevice()
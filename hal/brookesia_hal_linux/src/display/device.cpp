@@ -8,11 +8,13 @@
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -27,6 +29,7 @@
 #   define BROOKESIA_LOG_DISABLE_DEBUG_TRACE 1
 #endif
 #include "private/utils.hpp"
+#include "brookesia/lib_utils/pixel_convert.hpp"
 #include "brookesia/hal_interface/interfaces/display/backlight.hpp"
 #include "brookesia/hal_interface/interfaces/display/panel.hpp"
 #include "brookesia/hal_interface/interfaces/display/touch.hpp"
@@ -38,6 +41,74 @@ namespace {
 
 constexpr uint8_t LINUX_DISPLAY_TOUCH_MAX_POINTS = 10;
 constexpr const char *LINUX_DISPLAY_GROUP_ID = "linux_display";
+constexpr const char *LINUX_DISPLAY_HEADLESS_ENV = "BROOKESIA_HAL_LINUX_DISPLAY_HEADLESS";
+constexpr size_t LINUX_DISPLAY_DIRTY_RECT_MAX = 16;
+constexpr uint32_t LINUX_DISPLAY_FNV_OFFSET_BASIS = 2166136261U;
+constexpr uint32_t LINUX_DISPLAY_FNV_PRIME = 16777619U;
+
+struct DirtyRect {
+    uint32_t x1 = 0;
+    uint32_t y1 = 0;
+    uint32_t x2 = 0;
+    uint32_t y2 = 0;
+
+    bool contains(const DirtyRect &other) const
+    {
+        return (x1 <= other.x1) && (y1 <= other.y1) && (x2 >= other.x2) && (y2 >= other.y2);
+    }
+
+    size_t get_area() const
+    {
+        return static_cast<size_t>(x2 - x1) * (y2 - y1);
+    }
+};
+
+// Covered rectangles are dropped, and a list that grows past the limit collapses into its bounding box so that
+// a burst of small draws never costs more uploads than one large one
+void add_dirty_rect(std::vector<DirtyRect> &rects, const DirtyRect &rect)
+{
+    const bool covered = std::any_of(rects.begin(), rects.end(), [&rect](const DirtyRect & existing) {
+        return existing.contains(rect);
+    });
+    if (covered) {
+        return;
+    }
+    std::erase_if(rects, [&rect](const DirtyRect & existing) {
+        return rect.contains(existing);
+    });
+    if (rects.size() < LINUX_DISPLAY_DIRTY_RECT_MAX) {
+        rects.push_back(rect);
+        return;
+    }
+
+    auto bounds = rect;
+    for (const auto &existing : rects) {
+        bounds.x1 = std::min(bounds.x1, existing.x1);
+        bounds.y1 = std::min(bounds.y1, existing.y1);
+        bounds.x2 = std::max(bounds.x2, existing.x2);
+        bounds.y2 = std::max(bounds.y2, existing.y2);
+    }
+    rects.assign(1, bounds);
+}
+
+// Hash the pixels byte by byte in B, G, R, A order so the result does not depend on the host endianness
+uint32_t make_framebuffer_checksum(const std::vector<uint32_t> &framebuffer)
+{
+    uint32_t hash = LINUX_DISPLAY_FNV_OFFSET_BASIS;
+    for (auto pixel : framebuffer) {
+        for (uint32_t shift = 0; shift < 32; shift += 8) {
+            hash ^= (pixel >> shift) & 0xFFU;
+            hash *= LINUX_DISPLAY_FNV_PRIME;
+        }
+    }
+    return hash;
+}
+
+bool is_headless_forced_by_env()
+{
+    const char *headless = std::getenv(LINUX_DISPLAY_HEADLESS_ENV);
+    return (headless != nullptr) && (headless[0] != '\0') && (std::string_view(headless) != "0");
+}
 
 #if !BROOKESIA_HAL_LINUX_DISPLAY_BACKEND_STUB
 uint8_t make_sdl_touch_track_id(SDL_FingerID finger_id)
@@ -69,14 +140,6 @@ display::TouchIface::Info make_touch_info(const DisplayLinuxDevice::Config &conf
     };
 }
 
-uint32_t rgb565_to_argb8888(uint16_t pixel)
-{
-    const uint8_t r = static_cast<uint8_t>(((pixel >> 11) & 0x1F) * 255 / 31);
-    const uint8_t g = static_cast<uint8_t>(((pixel >> 5) & 0x3F) * 255 / 63);
-    const uint8_t b = static_cast<uint8_t>((pixel & 0x1F) * 255 / 31);
-    return (0xFFU << 24) | (static_cast<uint32_t>(r) << 16) | (static_cast<uint32_t>(g) << 8) | b;
-}
-
 } // namespace
 
 class DisplayLinuxBackend {
@@ -93,8 +156,13 @@ public:
 
     bool init()
     {
-#if !BROOKESIA_HAL_LINUX_DISPLAY_BACKEND_STUB
         std::unique_lock lock(mutex_);
+        if (config_.headless) {
+            init_headless_locked();
+            return true;
+        }
+
+#if !BROOKESIA_HAL_LINUX_DISPLAY_BACKEND_STUB
         if (sdl_available_) {
             return true;
         }
@@ -140,9 +208,9 @@ public:
         if (render_thread_.joinable()) {
             render_thread_.join();
         }
+#endif
         std::lock_guard lock(mutex_);
         deinit_locked();
-#endif
     }
 
     bool draw_bitmap(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, const uint8_t *data)
@@ -155,21 +223,27 @@ public:
                 return false;
             }
 
-#if !BROOKESIA_HAL_LINUX_DISPLAY_BACKEND_STUB
-            if (sdl_available_) {
+            if (!framebuffer_.empty()) {
                 const uint32_t width = x2 - x1;
                 const uint32_t height = y2 - y1;
-                const auto *pixels = reinterpret_cast<const uint16_t *>(data);
-                for (uint32_t y = 0; y < height; y++) {
-                    auto *destination = framebuffer_.data() + static_cast<size_t>(y1 + y) * config_.width_px + x1;
-                    const auto *source = pixels + static_cast<size_t>(y) * width;
-                    for (uint32_t x = 0; x < width; x++) {
-                        destination[x] = rgb565_to_argb8888(source[x]);
-                    }
+                const lib_utils::PixelRect source = {
+                    .width = width,
+                    .height = height,
+                    .format = lib_utils::PixelFormat::RGB565,
+                };
+                auto *destination = framebuffer_.data() + static_cast<size_t>(y1) * config_.width_px + x1;
+                lib_utils::convert_pixel_rect(
+                    data, source, reinterpret_cast<uint8_t *>(destination), config_.width_px * sizeof(uint32_t),
+                    lib_utils::PixelFormat::ARGB8888
+                );
+                frame_stats_.drawn_pixels += static_cast<uint64_t>(width) * height;
+                if (headless_) {
+                    frame_stats_.frame_count++;
+                } else {
+                    add_dirty_rect(dirty_rects_, DirtyRect{.x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2});
+                    render_dirty_ = true;
                 }
-                render_dirty_ = true;
             }
-#endif
         }
 #if !BROOKESIA_HAL_LINUX_DISPLAY_BACKEND_STUB
         render_cv_.notify_one();
@@ -258,6 +332,14 @@ public:
         return quit_requested_;
     }
 
+    DisplayLinuxDevice::FrameStats get_frame_stats() const
+    {
+        std::lock_guard lock(mutex_);
+        auto stats = frame_stats_;
+        stats.checksum = framebuffer_.empty() ? 0 : make_framebuffer_checksum(framebuffer_);
+        return stats;
+    }
+
     void *window_handle() const
     {
 #if !BROOKESIA_HAL_LINUX_DISPLAY_BACKEND_STUB
@@ -288,6 +370,16 @@ private:
 #endif
     }
 
+    void init_headless_locked()
+    {
+        if (headless_) {
+            return;
+        }
+        framebuffer_.assign(static_cast<size_t>(config_.width_px) * config_.height_px, 0xFF000000U);
+        headless_ = true;
+        BROOKESIA_LOGI("Headless display backend initialized: size(%1%x%2%)", config_.width_px, config_.height_px);
+    }
+
     bool init_sdl_locked()
     {
 #if !BROOKESIA_HAL_LINUX_DISPLAY_BACKEND_STUB
@@ -337,6 +429,7 @@ private:
         }
 
         framebuffer_.assign(static_cast<size_t>(config_.width_px) * config_.height_px, 0xFF000000U);
+        dirty_rects_.assign(1, DirtyRect{.x1 = 0, .y1 = 0, .x2 = config_.width_px, .y2 = config_.height_px});
         present_locked();
         sdl_available_ = true;
         BROOKESIA_LOGI("SDL2 display backend initialized: size(%1%x%2%)", config_.width_px, config_.height_px);
@@ -474,10 +567,22 @@ private:
         if ((renderer_ == nullptr) || (texture_ == nullptr)) {
             return;
         }
-        if (SDL_UpdateTexture(texture_, nullptr, framebuffer_.data(), config_.width_px * sizeof(uint32_t)) != 0) {
-            BROOKESIA_LOGW("Failed to update SDL2 display texture: %1%", SDL_GetError());
-            return;
+        // The streaming texture keeps its content, so only the areas drawn since the last present are uploaded
+        for (const auto &rect : dirty_rects_) {
+            const SDL_Rect area = {
+                .x = static_cast<int>(rect.x1),
+                .y = static_cast<int>(rect.y1),
+                .w = static_cast<int>(rect.x2 - rect.x1),
+                .h = static_cast<int>(rect.y2 - rect.y1),
+            };
+            const auto *pixels = framebuffer_.data() + static_cast<size_t>(rect.y1) * config_.width_px + rect.x1;
+            if (SDL_UpdateTexture(texture_, &area, pixels, config_.width_px * sizeof(uint32_t)) != 0) {
+                BROOKESIA_LOGW("Failed to update SDL2 display texture: %1%", SDL_GetError());
+                return;
+            }
+            frame_stats_.uploaded_pixels += rect.get_area();
         }
+        dirty_rects_.clear();
         if (SDL_RenderClear(renderer_) != 0) {
             BROOKESIA_LOGW("Failed to clear SDL2 display renderer: %1%", SDL_GetError());
             return;
@@ -502,6 +607,7 @@ private:
             }
         }
         SDL_RenderPresent(renderer_);
+        frame_stats_.frame_count++;
 #endif
     }
 
@@ -513,9 +619,9 @@ private:
         return static_cast<uint8_t>(255 - ((static_cast<uint16_t>(brightness_) * 255 + 50) / 100));
     }
 
-#if !BROOKESIA_HAL_LINUX_DISPLAY_BACKEND_STUB
     void deinit_locked()
     {
+#if !BROOKESIA_HAL_LINUX_DISPLAY_BACKEND_STUB
         if (texture_ != nullptr) {
             SDL_DestroyTexture(texture_);
             texture_ = nullptr;
@@ -533,12 +639,14 @@ private:
             sdl_subsystem_initialized_ = false;
         }
         sdl_available_ = false;
+#endif
+        headless_ = false;
         framebuffer_.clear();
+        dirty_rects_.clear();
         active_touch_points_.clear();
         render_dirty_ = false;
         brightness_dirty_ = false;
     }
-#endif
 
     mutable std::mutex mutex_;
     std::condition_variable init_cv_;
@@ -556,6 +664,10 @@ private:
     std::thread render_thread_;
     display::TouchIface::InterruptHandler interrupt_handler_ = nullptr;
     void *interrupt_handler_ctx_ = nullptr;
+    bool headless_ = false;
+    std::vector<uint32_t> framebuffer_;
+    std::vector<DirtyRect> dirty_rects_;
+    DisplayLinuxDevice::FrameStats frame_stats_;
 
 #if !BROOKESIA_HAL_LINUX_DISPLAY_BACKEND_STUB
     SDL_Window *window_ = nullptr;
@@ -564,7 +676,6 @@ private:
     bool sdl_subsystem_initialized_ = false;
     bool sdl_available_ = false;
     bool sdl_failed_ = false;
-    std::vector<uint32_t> framebuffer_;
 #endif
 };
 
@@ -709,6 +820,11 @@ bool DisplayLinuxDevice::is_quit_requested() const
     return (backend_ != nullptr) && backend_->is_quit_requested();
 }
 
+DisplayLinuxDevice::FrameStats DisplayLinuxDevice::get_frame_stats() const
+{
+    return (backend_ != nullptr) ? backend_->get_frame_stats() : FrameStats{};
+}
+
 std::vector<InterfaceSpec> DisplayLinuxDevice::get_interface_specs() const
 {
     return {
@@ -723,6 +839,9 @@ bool DisplayLinuxDevice::on_init()
     BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
 
     auto config = get_config();
+    if (is_headless_forced_by_env()) {
+        config.headless = true;
+    }
     backend_ = std::make_shared<DisplayLinuxBackend>(config);
     if (!backend_->init()) {
         BROOKESIA_LOGW("Using display stub fallback");
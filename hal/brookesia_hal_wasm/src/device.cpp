@@ -33,6 +33,7 @@
 
 #include "private/utils.hpp"
 #include "brookesia/lib_utils/function_guard.hpp"
+#include "brookesia/lib_utils/pixel_convert.hpp"
 #include "brookesia/hal_interface/interfaces/audio/codec_player.hpp"
 #include "brookesia/hal_interface/interfaces/audio/processor.hpp"
 #include "brookesia/hal_interface/interfaces/display/backlight.hpp"
@@ -272,14 +273,6 @@ display::TouchIface::Info make_touch_info(const DisplayWasmDevice::Config &confi
     };
 }
 
-uint32_t rgb565_to_argb8888(uint16_t pixel)
-{
-    const uint8_t r = static_cast<uint8_t>(((pixel >> 11) & 0x1F) * 255 / 31);
-    const uint8_t g = static_cast<uint8_t>(((pixel >> 5) & 0x3F) * 255 / 63);
-    const uint8_t b = static_cast<uint8_t>((pixel & 0x1F) * 255 / 31);
-    return (0xFFU << 24) | (static_cast<uint32_t>(r) << 16) | (static_cast<uint32_t>(g) << 8) | b;
-}
-
 uint8_t modulate_color_component(uint8_t component, uint8_t mod)
 {
     return static_cast<uint8_t>((static_cast<uint16_t>(component) * mod) / 255);
@@ -490,14 +483,16 @@ public:
         }
         const uint32_t width = x2 - x1;
         const uint32_t height = y2 - y1;
-        const auto *pixels = reinterpret_cast<const uint16_t *>(data);
-        for (uint32_t y = 0; y < height; y++) {
-            auto *destination = framebuffer_.data() + static_cast<size_t>(y1 + y) * config_.width_px + x1;
-            const auto *source = pixels + static_cast<size_t>(y) * width;
-            for (uint32_t x = 0; x < width; x++) {
-                destination[x] = rgb565_to_argb8888(source[x]);
-            }
-        }
+        const lib_utils::PixelRect source = {
+            .width = width,
+            .height = height,
+            .format = lib_utils::PixelFormat::RGB565,
+        };
+        auto *destination = framebuffer_.data() + static_cast<size_t>(y1) * config_.width_px + x1;
+        lib_utils::convert_pixel_rect(
+            data, source, reinterpret_cast<uint8_t *>(destination), config_.width_px * sizeof(uint32_t),
+            lib_utils::PixelFormat::ARGB8888
+        );
         present_locked();
         return true;
     }
@@ -564,6 +564,10 @@ public:
                 release_present_buffer(present_buffer_index.value(), service::display::PresentResult::DroppedInvalidFrame);
                 result = service::display::PresentResult::DroppedInvalidFrame;
                 break;
+            case service::display::PresentSubmitState::DroppedQueueFull:
+                release_present_buffer(present_buffer_index.value(), service::display::PresentResult::DroppedQueueFull);
+                result = service::display::PresentResult::DroppedQueueFull;
+                break;
             case service::display::PresentSubmitState::Error:
             default:
                 release_present_buffer(present_buffer_index.value(), service::display::PresentResult::Error);
@@ -1185,7 +1189,9 @@ private:
         {
             std::lock_guard lock(present_mutex_);
             present_buffers_[buffer_index].busy = false;
-            if (result == service::display::PresentResult::DroppedQueueFull) {
+            // A merged frame was replaced by a newer one before reaching the panel
+            if ((result == service::display::PresentResult::DroppedQueueFull) ||
+                    (result == service::display::PresentResult::Merged)) {
                 present_drop_count_++;
                 mark_display_backpressure_locked();
             } else if (result == service::display::PresentResult::Error) {
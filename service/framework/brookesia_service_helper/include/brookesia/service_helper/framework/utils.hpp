@@ -30,6 +30,7 @@ public:
     using DebugSnapshot = service::UtilsService::DebugSnapshot;
     using MemoryDebugSnapshot = service::UtilsService::MemoryDebugSnapshot;
     using ThreadDebugSnapshot = service::UtilsService::ThreadDebugSnapshot;
+    using SchedulerDebugSnapshot = service::UtilsService::SchedulerDebugSnapshot;
     using FunctionId = service::UtilsService::FunctionId;
     using EventId = service::UtilsService::EventId;
 
@@ -64,11 +65,7 @@ public:
         if (!binding.is_valid()) {
             return std::unexpected("Failed to bind Utils service");
         }
-        auto config_json = BROOKESIA_DESCRIBE_TO_JSON(config);
-        if (!config_json.is_object()) {
-            return std::unexpected("Failed to serialize Utils debug configuration");
-        }
-        return call_function_sync<void>(FunctionId::SetDebugConfig, config_json.as_object(), Timeout(timeout_ms));
+        return call_function_typed_sync<void>(FunctionId::SetDebugConfig, config, Timeout(timeout_ms));
     }
 
     static std::expected<void, std::string> start_memory_debug(uint32_t timeout_ms = 0)
@@ -106,6 +103,11 @@ public:
         return call_and_parse<MemoryDebugSnapshot>(FunctionId::GetMemorySnapshot, timeout_ms);
     }
 
+    static std::expected<SchedulerDebugSnapshot, std::string> get_scheduler_snapshot(uint32_t timeout_ms = 0)
+    {
+        return call_and_parse<SchedulerDebugSnapshot>(FunctionId::GetSchedulerSnapshot, timeout_ms);
+    }
+
 private:
     static ServiceBinding bind_service()
     {
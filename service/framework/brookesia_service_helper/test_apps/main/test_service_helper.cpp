@@ -3,6 +3,7 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <memory>
 #include <span>
 #include <string>
 #include <string_view>
@@ -64,6 +65,19 @@ boost::json::value serialize_and_parse(const auto &value)
     return BROOKESIA_DESCRIBE_TO_JSON(value);
 }
 
+// Stands in for the storage service, only its name matters to the helper
+class FakeStorageService : public ServiceBase {
+public:
+    FakeStorageService()
+        : ServiceBase({
+        .name = std::string(Storage::get_name()),
+        .description = "Fake storage service.",
+        .version = "0.0.0",
+    })
+    {
+    }
+};
+
 } // namespace
 
 BROOKESIA_TEST_CASE(
@@ -174,3 +188,35 @@ BROOKESIA_TEST_CASE(
     TEST_ASSERT_EQUAL_STRING(kv_name.name.c_str(), parsed_kv_name.name.c_str());
     TEST_ASSERT_EQUAL_STRING(kv_name.original_name.c_str(), parsed_kv_name.original_name.c_str());
 }
+
+BROOKESIA_TEST_CASE(
+    test_service_helper_cached_service_and_schemas,
+    "Service helper caches the service handle and schema lookups",
+    "[service][helper][cache]"
+)
+{
+    for (const auto &schema : Storage::get_function_schemas()) {
+        Storage::FunctionId function_id;
+        TEST_ASSERT_TRUE(BROOKESIA_DESCRIBE_STR_TO_ENUM(schema.name, function_id));
+        TEST_ASSERT_TRUE(&schema == Storage::get_function_schema(function_id));
+    }
+
+    auto &service_manager = ServiceManager::get_instance();
+    TEST_ASSERT_TRUE(service_manager.init());
+    TEST_ASSERT_FALSE(Storage::is_available());
+
+    // Adding and removing a service invalidates the cached handle
+    auto generation = service_manager.get_service_generation();
+    auto service = std::make_shared<FakeStorageService>();
+    TEST_ASSERT_TRUE(service_manager.add_service(service));
+    TEST_ASSERT_NOT_EQUAL(generation, service_manager.get_service_generation());
+    TEST_ASSERT_TRUE(Storage::is_available());
+    TEST_ASSERT_TRUE(service.get() == Storage::get_service().get());
+    TEST_ASSERT_TRUE(service.get() == Storage::get_service().get());
+
+    TEST_ASSERT_TRUE(service_manager.remove_service(service->get_attributes().name));
+    TEST_ASSERT_FALSE(Storage::is_available());
+    TEST_ASSERT_TRUE(Storage::get_service() == nullptr);
+
+    service_manager.deinit();
+}
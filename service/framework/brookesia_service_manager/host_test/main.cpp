@@ -7,10 +7,13 @@
 #include <atomic>
 #include <cstdlib>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <variant>
+#include <vector>
 #include "boost/chrono.hpp"
 #include "boost/thread/condition_variable.hpp"
 #include "boost/thread/future.hpp"
@@ -48,6 +51,27 @@ public:
         return max_active_calls_.load();
     }
 
+    int get_typed_calls() const
+    {
+        return typed_calls_.load();
+    }
+
+    bool publish_changed(std::string value)
+    {
+        return publish_event("changed", EventItemMap{{"Value", EventItem(std::move(value))}});
+    }
+
+    bool publish_burst(double value)
+    {
+        return publish_event("burst", EventItemMap{{"Value", EventItem(value)}});
+    }
+
+    std::optional<EventDeliveryStats> get_burst_stats() const
+    {
+        auto registry = get_event_registry();
+        return registry ? registry->get_delivery_stats("burst") : std::nullopt;
+    }
+
     bool has_registered_function(std::string_view name) const
     {
         auto registry = get_function_registry();
@@ -123,6 +147,19 @@ public:
                         .type = EventItemType::String,
                     }
                 },
+            }, {
+                .name = "burst",
+                .description = "Test event delivered at most every 100 ms, latest value wins.",
+                .items = {{
+                        .name = "Value",
+                        .description = "Test value.",
+                        .type = EventItemType::Number,
+                    }
+                },
+                .delivery_policy = {
+                    .mode = EventDeliveryMode::Coalesce,
+                    .min_interval_ms = 100,
+                },
             }
         };
     }
@@ -202,10 +239,29 @@ protected:
         };
     }
 
+    TypedFunctionHandlerMap get_typed_function_handlers() override
+    {
+        return {
+            {
+                "echo",
+                [this](TypedParameters &args) -> std::optional<FunctionResult> {
+                    auto *message = (args.size() == 1) ? args[0].get_if<std::string>() : nullptr;
+                    if (message == nullptr)
+                    {
+                        return std::nullopt;
+                    }
+                    typed_calls_++;
+                    return FunctionResult{.success = true, .data = std::move(*message)};
+                },
+            },
+        };
+    }
+
 private:
     std::weak_ptr<ServiceBase> peer_;
     std::atomic<int> active_calls_{0};
     std::atomic<int> max_active_calls_{0};
+    std::atomic<int> typed_calls_{0};
 };
 
 class InvalidVersionService : public ServiceBase {
@@ -308,6 +364,29 @@ private:
     bool allow_stop_ = false;
 };
 
+class SlowStartService final: public ServiceBase {
+public:
+    SlowStartService(std::string name, std::vector<std::string> dependencies = {})
+        : ServiceBase({
+        .name = std::move(name),
+        .description = "Test service.",
+        .version = "0.0.0",
+        .dependencies = std::move(dependencies),
+    })
+    {
+    }
+
+protected:
+    bool on_start() override
+    {
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(START_DELAY_MS));
+        return true;
+    }
+
+public:
+    static constexpr int START_DELAY_MS = 100;
+};
+
 bool verify_version_metadata(ServiceManager &manager, EchoService &service)
 {
     if (service.get_attributes().version != "0.0.0") {
@@ -378,6 +457,184 @@ bool verify_echo_call(ServiceBase &service)
     return true;
 }
 
+bool verify_function_handle_call(ServiceBase &service)
+{
+    auto handle = service.get_function_handle("echo");
+    if (!handle.is_valid() || (handle.get_schema() == nullptr) || (handle.get_schema()->name != "echo")) {
+        std::cerr << "Failed to resolve echo function handle" << '\n';
+        return false;
+    }
+
+    std::vector<FunctionValue> values{FunctionValue(std::string("handle-ok"))};
+    auto result = service.call_function_sync(handle, std::move(values), 500);
+    if (!result.success || !result.has_data() || !std::holds_alternative<std::string>(*result.data) ||
+            (std::get<std::string>(*result.data) != "handle-ok")) {
+        std::cerr << "Echo call by handle failed" << '\n';
+        return false;
+    }
+
+    std::vector<FunctionValue> invalid_type_values{FunctionValue(1.0)};
+    std::vector<FunctionValue> too_many_values{FunctionValue(std::string("a")), FunctionValue(std::string("b"))};
+    auto invalid_type_result = service.call_function_sync(handle, std::move(invalid_type_values), 500);
+    auto too_many_result = service.call_function_sync(handle, std::move(too_many_values), 500);
+    if (invalid_type_result.success || too_many_result.success) {
+        std::cerr << "Invalid parameters were accepted by handle" << '\n';
+        return false;
+    }
+
+    boost::promise<FunctionResult> async_promise;
+    auto async_future = async_promise.get_future();
+    std::vector<FunctionValue> async_values{FunctionValue(std::string("handle-async"))};
+    auto async_result = service.call_function_async(handle, std::move(async_values), [&](FunctionResult && result) {
+        async_promise.set_value(std::move(result));
+    });
+    if (!async_result || (async_future.wait_for(boost::chrono::milliseconds(500)) != boost::future_status::ready)) {
+        std::cerr << "Asynchronous echo call by handle did not complete" << '\n';
+        return false;
+    }
+    auto async_value = async_future.get();
+    if (!async_value.success || !async_value.has_data() ||
+            (std::get<std::string>(*async_value.data) != "handle-async")) {
+        std::cerr << "Asynchronous echo call by handle result mismatch" << '\n';
+        return false;
+    }
+
+    if (service.get_function_handle("missing").is_valid()) {
+        std::cerr << "Unknown function was resolved" << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+bool verify_typed_function_call(EchoService &service)
+{
+    auto handle = service.get_function_handle("echo");
+    const int typed_calls = service.get_typed_calls();
+
+    auto result = service.call_function_typed_sync(handle, {TypedValue::make(std::string("typed-ok"))}, 500);
+    if (!result.success || !result.has_data() || (std::get<std::string>(*result.data) != "typed-ok") ||
+            (service.get_typed_calls() != typed_calls + 1)) {
+        std::cerr << "Typed echo call did not reach the typed handler" << '\n';
+        return false;
+    }
+
+    // Declined by the typed handler, converted and served by the regular handler
+    auto fallback_result = service.call_function_typed_sync(handle, {TypedValue::make("typed-fallback")}, 500);
+    if (!fallback_result.success || !fallback_result.has_data() ||
+            (std::get<std::string>(*fallback_result.data) != "typed-fallback") ||
+            (service.get_typed_calls() != typed_calls + 1)) {
+        std::cerr << "Typed echo call did not fall back to the regular handler" << '\n';
+        return false;
+    }
+
+    auto invalid_type_result = service.call_function_typed_sync(handle, {TypedValue::make(1.0)}, 500);
+    if (invalid_type_result.success) {
+        std::cerr << "Invalid typed parameter was accepted" << '\n';
+        return false;
+    }
+
+    boost::promise<FunctionResult> async_promise;
+    auto async_future = async_promise.get_future();
+    auto async_result = service.call_function_typed_async(
+    handle, {TypedValue::make(std::string("typed-async"))}, [&](FunctionResult && result) {
+        async_promise.set_value(std::move(result));
+    });
+    if (!async_result || (async_future.wait_for(boost::chrono::milliseconds(500)) != boost::future_status::ready)) {
+        std::cerr << "Asynchronous typed echo call did not complete" << '\n';
+        return false;
+    }
+    auto async_value = async_future.get();
+    if (!async_value.success || (std::get<std::string>(*async_value.data) != "typed-async") ||
+            (service.get_typed_calls() != typed_calls + 2)) {
+        std::cerr << "Asynchronous typed echo call result mismatch" << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+bool verify_filtered_event_subscription(EchoService &service)
+{
+    std::atomic<int> main_event_count{0};
+    std::atomic<int> all_event_count{0};
+    {
+        auto main_connection = service.subscribe_event(
+        "changed", [&main_event_count](const std::string &, const EventItemMap &) {
+            main_event_count.fetch_add(1);
+        }, EventRegistry::make_item_predicate("Value", std::string("main"))
+                               );
+        if (!main_connection.connected()) {
+            std::cerr << "Failed to subscribe a filtered event" << '\n';
+            return false;
+        }
+
+        // Skipped before scheduling, the only subscriber does not match
+        if (!service.publish_changed("aux") || !service.publish_changed("main")) {
+            std::cerr << "Failed to publish filtered events" << '\n';
+            return false;
+        }
+        for (int retry = 0; retry < 100 && main_event_count.load() < 1; ++retry) {
+            boost::this_thread::sleep_for(boost::chrono::milliseconds(5));
+        }
+
+        // An unfiltered subscriber receives every event while the filtered one still sees matches only
+        auto all_connection = service.subscribe_event(
+        "changed", [&all_event_count](const std::string &, const EventItemMap &) {
+            all_event_count.fetch_add(1);
+        }
+                              );
+        if (!service.publish_changed("aux")) {
+            std::cerr << "Failed to publish unfiltered event" << '\n';
+            return false;
+        }
+        for (int retry = 0; retry < 100 && all_event_count.load() < 1; ++retry) {
+            boost::this_thread::sleep_for(boost::chrono::milliseconds(5));
+        }
+    }
+    if ((main_event_count.load() != 1) || (all_event_count.load() != 1)) {
+        std::cerr << "Filtered event subscription received unexpected events" << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+bool verify_coalesced_event_delivery(EchoService &service)
+{
+    constexpr int BURST_COUNT = 20;
+
+    std::atomic<int> delivery_count{0};
+    std::atomic<int> last_value{-1};
+    auto connection = service.subscribe_event(
+    "burst", [&](const std::string &, const EventItemMap & items) {
+        last_value.store(static_cast<int>(std::get<double>(items.at("Value"))));
+        delivery_count.fetch_add(1);
+    }
+                      );
+
+    for (int i = 0; i < BURST_COUNT; ++i) {
+        if (!service.publish_burst(i)) {
+            std::cerr << "Failed to publish burst event" << '\n';
+            return false;
+        }
+    }
+    for (int retry = 0; retry < 100 && last_value.load() != BURST_COUNT - 1; ++retry) {
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(5));
+    }
+
+    // The first event may be delivered right away, the rest of the burst collapses into one delayed delivery
+    auto stats = service.get_burst_stats();
+    if ((last_value.load() != BURST_COUNT - 1) || (delivery_count.load() > 2) || !stats ||
+            (stats->published != BURST_COUNT) || (stats->coalesced + delivery_count.load() != BURST_COUNT) ||
+            (stats->dropped != 0)) {
+        std::cerr << "Burst events were not coalesced" << '\n';
+        return false;
+    }
+
+    return true;
+}
+
 bool verify_nested_sync_call(ServiceBase &service)
 {
     auto result = service.call_function_sync("nested", FunctionParameterMap{}, 500);
@@ -602,6 +859,53 @@ bool verify_service_states(ServiceManager &manager)
     return success;
 }
 
+bool verify_parallel_bind(ServiceManager &manager)
+{
+    const std::vector<std::string> names = {"boot_app", "boot_hal_a", "boot_hal_b"};
+    if (!manager.add_service(std::make_shared<SlowStartService>("boot_hal_a")) ||
+            !manager.add_service(std::make_shared<SlowStartService>("boot_hal_b")) ||
+            !manager.add_service(std::make_shared<SlowStartService>(
+                                     "boot_app", std::vector<std::string> {"boot_hal_a", "boot_hal_b"}
+                                 ))) {
+        std::cerr << "Failed to add parallel startup services" << '\n';
+        return false;
+    }
+
+    auto bindings = manager.bind_parallel(names);
+    bool success = (bindings.size() == names.size()) &&
+                   std::all_of(bindings.begin(), bindings.end(), [](const auto & binding) {
+        return binding.is_valid();
+    });
+
+    std::map<std::string, ServiceManager::ServiceStartRecord> records;
+    for (const auto &record : manager.get_boot_timeline()) {
+        records[record.name] = record;
+    }
+    success = success && (records.count("boot_app") == 1) && (records.count("boot_hal_a") == 1) &&
+              (records.count("boot_hal_b") == 1);
+    if (success) {
+        const auto &app = records["boot_app"];
+        const auto &hal_a = records["boot_hal_a"];
+        const auto &hal_b = records["boot_hal_b"];
+        // Independent services overlap: every one of them starts before the earliest of them finishes. This does
+        // not depend on how long the host takes to run them, unlike a bound on the total wall-clock time.
+        const auto earliest_finish_us = std::min(hal_a.finish_us, hal_b.finish_us);
+        const bool is_overlapped = (hal_a.start_us < earliest_finish_us) && (hal_b.start_us < earliest_finish_us);
+        // The dependent service starts after both of its dependencies
+        success = app.success && hal_a.success && hal_b.success && is_overlapped &&
+                  (app.start_us >= std::max(hal_a.finish_us, hal_b.finish_us));
+    }
+
+    bindings.clear();
+    for (const auto &name : names) {
+        success = manager.remove_service(name) && success;
+    }
+    if (!success) {
+        std::cerr << "Parallel startup verification failed" << '\n';
+    }
+    return success;
+}
+
 bool verify_schema_query_during_removal(ServiceManager &manager)
 {
     auto service = std::make_shared<EchoService>("schema_removal");
@@ -682,7 +986,7 @@ bool verify_manager_service(ServiceManager &manager)
 
 bool verify_utils_service(ServiceManager &manager)
 {
-    if ((UtilsService::get_static_function_schemas().size() != 10) ||
+    if ((UtilsService::get_static_function_schemas().size() != 11) ||
             (UtilsService::get_static_event_schemas().size() != 3)) {
         std::cerr << "Utils schema has unexpected members" << '\n';
         return false;
@@ -746,6 +1050,27 @@ bool verify_utils_service(ServiceManager &manager)
         return false;
     }
 
+    auto scheduler_result = service->call_function_sync(
+                                BROOKESIA_DESCRIBE_TO_STR(UtilsService::FunctionId::GetSchedulerSnapshot),
+                                FunctionParameterMap{}
+                            );
+    UtilsService::SchedulerDebugSnapshot scheduler_snapshot;
+    constexpr auto histogram_bucket_num = esp_brookesia::lib_utils::TaskScheduler::LATENCY_HISTOGRAM_BUCKET_NUM;
+    if (!scheduler_result.success || !scheduler_result.has_data() ||
+            !BROOKESIA_DESCRIBE_FROM_JSON(
+                std::get<boost::json::object>(*scheduler_result.data), scheduler_snapshot
+            ) || (scheduler_snapshot.latency_histogram_bounds_us.size() + 1 != histogram_bucket_num)) {
+        std::cerr << "Utils scheduler snapshot is invalid" << '\n';
+        return false;
+    }
+    for (const auto &group_stats : scheduler_snapshot.groups) {
+        if ((group_stats.queue_wait_histogram.size() != histogram_bucket_num) ||
+                (group_stats.execution_histogram.size() != histogram_bucket_num)) {
+            std::cerr << "Utils scheduler snapshot group histogram is invalid" << '\n';
+            return false;
+        }
+    }
+
     auto cached_result = service->call_function_sync(
                              BROOKESIA_DESCRIBE_TO_STR(UtilsService::FunctionId::GetDebugSnapshot),
                              FunctionParameterMap{}
@@ -889,7 +1214,10 @@ int main()
     }
 
     auto bound_service = binding.get_service();
-    if (!bound_service || !verify_echo_call(*bound_service) || !verify_nested_sync_call(*bound_service)) {
+    if (!bound_service || !verify_echo_call(*bound_service) || !verify_function_handle_call(*bound_service) ||
+            !verify_typed_function_call(*service) || !verify_filtered_event_subscription(*service) ||
+            !verify_coalesced_event_delivery(*service) ||
+            !verify_nested_sync_call(*bound_service)) {
         return EXIT_FAILURE;
     }
 
@@ -903,7 +1231,8 @@ int main()
             !verify_cross_service_wait_capacity(manager)) {
         return EXIT_FAILURE;
     }
-    if (!verify_service_states(manager) || !verify_schema_query_during_removal(manager) ||
+    if (!verify_service_states(manager) || !verify_parallel_bind(manager) ||
+            !verify_schema_query_during_removal(manager) ||
             !verify_manager_service(manager) || !verify_utils_service(manager)) {
         return EXIT_FAILURE;
     }
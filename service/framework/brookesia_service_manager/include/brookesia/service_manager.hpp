@@ -11,6 +11,8 @@
 
 #include "service_manager/macro_configs.h"
 #include "service_manager/common.hpp"
+#include "service_manager/raw_buffer_pool.hpp"
+#include "service_manager/binary_codec.hpp"
 /* Event */
 #include "service_manager/event/definition.hpp"
 #include "service_manager/event/registry.hpp"
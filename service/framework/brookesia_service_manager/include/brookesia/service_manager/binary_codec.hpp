@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "brookesia/service_manager/event/definition.hpp"
+#include "brookesia/service_manager/function/definition.hpp"
+
+namespace esp_brookesia::service {
+
+/*
+ * Compact binary encoding of service values, for transports crossing a process boundary.
+ *
+ * The encoding is CBOR (RFC 8949), so peers can decode it with any CBOR library:
+ * - Parameter and item maps are maps keyed by text strings.
+ * - `FunctionResult` is a map with the `success`, `error_message` and optional `data` keys.
+ * - `RawBuffer` values are carried as byte strings. Decoded buffers are shared buffers owning a copy of the bytes.
+ *   A buffer storing its value in the pointer (`data_size == 0`) cannot be encoded.
+ * - Integral numbers are encoded as integers and decoded back to `double`. JSON values keep their integer and
+ *   floating-point kinds.
+ *
+ * Encoders replace the content of the output buffer, reusing its capacity.
+ */
+
+/**
+ * @brief Encode function parameters.
+ *
+ * @param[in] parameters Parameters to encode.
+ * @param[out] buffer Encoded bytes.
+ * @return true on success, false if a value cannot be encoded.
+ */
+bool encode_binary(const FunctionParameterMap &parameters, std::vector<uint8_t> &buffer);
+
+/**
+ * @brief Encode a function result.
+ *
+ * @param[in] result Result to encode.
+ * @param[out] buffer Encoded bytes.
+ * @return true on success, false if the data cannot be encoded.
+ */
+bool encode_binary(const FunctionResult &result, std::vector<uint8_t> &buffer);
+
+/**
+ * @brief Encode event items.
+ *
+ * @param[in] event_items Items to encode.
+ * @param[out] buffer Encoded bytes.
+ * @return true on success, false if a value cannot be encoded.
+ */
+bool encode_binary(const EventItemMap &event_items, std::vector<uint8_t> &buffer);
+
+/**
+ * @brief Decode function parameters.
+ *
+ * @param[in] data Encoded bytes.
+ * @param[in] size Number of encoded bytes.
+ * @param[out] parameters Decoded parameters.
+ * @return true on success, false if the bytes are malformed or do not encode parameters.
+ */
+bool decode_binary(const uint8_t *data, size_t size, FunctionParameterMap &parameters);
+
+/**
+ * @brief Decode a function result.
+ *
+ * @param[in] data Encoded bytes.
+ * @param[in] size Number of encoded bytes.
+ * @param[out] result Decoded result.
+ * @return true on success, false if the bytes are malformed or do not encode a result.
+ */
+bool decode_binary(const uint8_t *data, size_t size, FunctionResult &result);
+
+/**
+ * @brief Decode event items.
+ *
+ * @param[in] data Encoded bytes.
+ * @param[in] size Number of encoded bytes.
+ * @param[out] event_items Decoded items.
+ * @return true on success, false if the bytes are malformed or do not encode items.
+ */
+bool decode_binary(const uint8_t *data, size_t size, EventItemMap &event_items);
+
+} // namespace esp_brookesia::service
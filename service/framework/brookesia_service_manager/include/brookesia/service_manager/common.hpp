@@ -5,7 +5,10 @@
  */
 #pragma once
 
+#include <functional>
 #include <map>
+#include <memory>
+#include <new>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -35,8 +38,17 @@ private:
 
 /**
  * @brief Lightweight wrapper for raw binary data passed through service APIs.
+ *
+ * A plain buffer only borrows the memory of the producer. A shared buffer, created by `make_shared()`,
+ * `allocate()` or `RawBufferPool`, also holds a reference on the memory, so copies passed through `FunctionValue`,
+ * `EventItem` or scheduled tasks keep the data alive without copying it.
  */
 struct RawBuffer {
+    /**
+     * @brief Callback releasing the memory of a shared buffer.
+     */
+    using Releaser = std::function<void(uint8_t *data, size_t size)>;
+
     RawBuffer() = default;
 
     /**
@@ -60,6 +72,65 @@ struct RawBuffer {
         is_const(std::is_const_v<std::remove_pointer_t<T>>)
     {}
 
+    /**
+     * @brief Create a shared buffer taking ownership of existing memory.
+     *
+     * @tparam T Pointer type (must be a pointer type)
+     * @param[in] pointer Pointer to the raw data.
+     * @param[in] size Size of the buffer in bytes.
+     * @param[in] releaser Called once when the last copy of the buffer is destroyed.
+     * @return RawBuffer Shared buffer.
+     */
+    template <typename T>
+    requires (std::is_pointer_v<T>)
+    static RawBuffer make_shared(T pointer, size_t size, Releaser releaser)
+    {
+        RawBuffer buffer(pointer, size);
+        buffer.owner = std::shared_ptr<const void>(
+                           buffer.data_ptr, [releaser = std::move(releaser), size](const void *data) {
+            if (releaser) {
+                releaser(static_cast<uint8_t *>(const_cast<void *>(data)), size);
+            }
+        });
+        return buffer;
+    }
+
+    /**
+     * @brief Allocate a mutable shared buffer on the heap.
+     *
+     * @param[in] size Size of the buffer in bytes.
+     * @return RawBuffer Shared buffer, empty if `size` is 0 or the allocation failed.
+     */
+    static RawBuffer allocate(size_t size)
+    {
+        if (size == 0) {
+            return RawBuffer();
+        }
+        std::shared_ptr<uint8_t[]> data(new (std::nothrow) uint8_t[size]);
+        if (!data) {
+            return RawBuffer();
+        }
+        RawBuffer buffer(data.get(), size);
+        buffer.owner = std::move(data);
+        return buffer;
+    }
+
+    /**
+     * @brief Check whether the buffer holds a reference on its memory.
+     */
+    bool is_shared() const
+    {
+        return owner != nullptr;
+    }
+
+    /**
+     * @brief Get the number of buffers sharing the memory, 0 for a plain buffer.
+     */
+    long get_use_count() const
+    {
+        return owner.use_count();
+    }
+
     /**
      * @brief View the stored pointer as a const typed pointer.
      *
@@ -101,6 +172,8 @@ struct RawBuffer {
     size_t data_size = 0; ///< Data size in bytes. `0` means the data is stored in the `data_ptr`, and the receiver
     ///< should call `get_data_from_ptr<T>()` to get the data.
     bool is_const = true; ///< Whether the data is const. If true, receiver must not modify the data
+    std::shared_ptr<const void> owner; ///< Reference keeping the data of a shared buffer alive, empty otherwise.
+    ///< Not serialized, it only lives in process.
 };
 BROOKESIA_DESCRIBE_STRUCT(RawBuffer, (), (data_ptr, data_size, is_const))
 
@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <variant>
@@ -98,6 +99,46 @@ struct EventItemSchema {
 };
 BROOKESIA_DESCRIBE_STRUCT(EventItemSchema, (), (name, description, type))
 
+/**
+ * @brief How published events are turned into deliveries to the subscribers.
+ */
+enum class EventDeliveryMode {
+    Immediate, ///< Every published event is delivered by its own task.
+    Coalesce,  ///< Latest value wins, events published before the pending delivery runs replace its items.
+    Batch,     ///< Events published before the pending delivery runs are delivered in order by the same task.
+};
+BROOKESIA_DESCRIBE_ENUM(EventDeliveryMode, Immediate, Coalesce, Batch);
+
+/**
+ * @brief Opt-in delivery policy of an event, the default delivers every event immediately.
+ *
+ * Events with `require_scheduler = false` are emitted on the publishing thread, only the rate limit applies to them.
+ */
+struct EventDeliveryPolicy {
+    EventDeliveryMode mode = EventDeliveryMode::Immediate;
+    /**
+     * Minimum interval between two deliveries, 0 means no limit. `Immediate` drops the events published inside the
+     * interval, `Coalesce` and `Batch` postpone the pending delivery to the end of the interval.
+     */
+    uint32_t min_interval_ms = 0;
+    /**
+     * Maximum number of events held by a pending `Batch` delivery, the oldest one is dropped when full. 0 means no
+     * limit.
+     */
+    uint32_t max_batch_size = 0;
+};
+BROOKESIA_DESCRIBE_STRUCT(EventDeliveryPolicy, (), (mode, min_interval_ms, max_batch_size))
+
+/**
+ * @brief Delivery counters of an event.
+ */
+struct EventDeliveryStats {
+    uint64_t published = 0; ///< Events accepted by `publish_event()`.
+    uint64_t coalesced = 0; ///< Events replaced by a newer one before delivery.
+    uint64_t dropped = 0;   ///< Events discarded by the rate limit, a full batch or the service stop.
+};
+BROOKESIA_DESCRIBE_STRUCT(EventDeliveryStats, (), (published, coalesced, dropped))
+
 /**
  * @brief Schema description for one publishable service event.
  */
@@ -106,7 +147,8 @@ struct EventSchema {
     std::string description = "";
     std::vector<EventItemSchema> items = {};
     bool require_scheduler = true;
+    EventDeliveryPolicy delivery_policy = {};
 };
-BROOKESIA_DESCRIBE_STRUCT(EventSchema, (), (name, description, items, require_scheduler))
+BROOKESIA_DESCRIBE_STRUCT(EventSchema, (), (name, description, items, require_scheduler, delivery_policy))
 
 } // namespace esp_brookesia::service
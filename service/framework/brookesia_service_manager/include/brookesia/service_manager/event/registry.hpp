@@ -5,11 +5,15 @@
  */
 #pragma once
 
+#include <chrono>
+#include <deque>
 #include <map>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
+#include <vector>
 #include "boost/json.hpp"
 #include "brookesia/lib_utils/signal.hpp"
 #include "boost/thread/mutex.hpp"
@@ -35,6 +39,23 @@ public:
      * @brief Slot type accepted by `subscribe_event()`.
      */
     using SignalSlot = Signal::slot_type;
+    /**
+     * @brief Subscriber-side filter evaluated on the event items before the slot is invoked.
+     *
+     * Predicates run on the publishing thread and on the event dispatch thread, they must be cheap and must not
+     * block or publish events.
+     */
+    using EventPredicate = std::function<bool(const EventItemMap &event_items)>;
+
+    /**
+     * @brief Outcome of `queue_delivery()` for a published event.
+     */
+    enum class DeliveryAction {
+        Emit,     ///< Emit the items now.
+        Schedule, ///< Items queued, a task delivering `take_pending_deliveries()` must be scheduled.
+        Merged,   ///< Items merged into the delivery already scheduled.
+        Dropped,  ///< Items discarded by the rate limit.
+    };
 
     EventRegistry() = default;
     ~EventRegistry() = default;
@@ -145,6 +166,78 @@ public:
      */
     Signal *get_signal(const std::string &event_name);
 
+    /**
+     * @brief Connect a slot that only receives the events whose items satisfy a predicate.
+     *
+     * @param[in] event_name Event name to subscribe.
+     * @param[in] slot Slot invoked for matching events.
+     * @param[in] predicate Filter on the event items, see `EventPredicate`.
+     * @return SignalConnection Connection of the subscription, disconnected on failure.
+     */
+    SignalConnection subscribe(const std::string &event_name, SignalSlot slot, EventPredicate predicate);
+
+    /**
+     * @brief Check whether publishing the items would invoke at least one subscriber.
+     *
+     * Unfiltered subscribers always match, filtered ones match when their predicate accepts the items.
+     *
+     * @param[in] event_name Event name to check.
+     * @param[in] event_items Items about to be published.
+     * @return true if the event has a matching subscriber.
+     */
+    bool has_matching_subscribers(const std::string &event_name, const EventItemMap &event_items) const;
+
+    /**
+     * @brief Create a predicate matching events whose item equals a value.
+     *
+     * @param[in] item_name Name of the item to compare.
+     * @param[in] value Expected value, items of another type never match.
+     * @return EventPredicate Predicate usable with `subscribe()`.
+     *
+     * @code{.cpp}
+     * registry.subscribe("output_changed", slot, EventRegistry::make_item_predicate("output_name", "main"));
+     * @endcode
+     */
+    static EventPredicate make_item_predicate(std::string item_name, EventItem value);
+
+    /**
+     * @brief Apply the event delivery policy to a published event.
+     *
+     * @param[in] event_name Event name.
+     * @param[in,out] event_items Items of the event, moved into the pending delivery unless the action is `Emit`.
+     * @param[out] delay_ms Delay before the scheduled delivery, only set for `Schedule`.
+     * @return DeliveryAction What the publisher must do with the event.
+     */
+    DeliveryAction queue_delivery(const std::string &event_name, EventItemMap &event_items, uint32_t &delay_ms);
+
+    /**
+     * @brief Take the items of the scheduled delivery, further events schedule a new one.
+     *
+     * @param[in] event_name Event name.
+     * @return std::vector<EventItemMap> Items to deliver, in publish order.
+     */
+    std::vector<EventItemMap> take_pending_deliveries(const std::string &event_name);
+
+    /**
+     * @brief Discard the scheduled delivery of an event, e.g. when its task cannot run.
+     *
+     * @param[in] event_name Event name.
+     */
+    void discard_pending_deliveries(const std::string &event_name);
+
+    /**
+     * @brief Discard the scheduled deliveries of all events.
+     */
+    void discard_pending_deliveries();
+
+    /**
+     * @brief Get the delivery counters of an event.
+     *
+     * @param[in] event_name Event name.
+     * @return std::optional<EventDeliveryStats> Counters, or `std::nullopt` if the event does not exist.
+     */
+    std::optional<EventDeliveryStats> get_delivery_stats(const std::string &event_name) const;
+
     bool has_subscribers(const std::string &event_name) const
     {
         boost::lock_guard lock(event_infos_mutex_);
@@ -153,7 +246,25 @@ public:
     }
 
 private:
-    using EventInfo = std::tuple<EventSchema, std::unique_ptr<Signal>>;
+    struct Filter {
+        lib_utils::connection connection;
+        EventPredicate predicate;
+    };
+    // Copy-on-write so predicates are evaluated without holding the registry lock
+    using FilterList = std::vector<Filter>;
+    struct Delivery {
+        boost::mutex mutex;
+        std::deque<EventItemMap> pending;
+        bool scheduled = false;
+        std::optional<std::chrono::steady_clock::time_point> last_delivery_time;
+        EventDeliveryStats stats;
+    };
+    using EventInfo = std::tuple <
+                      EventSchema, std::unique_ptr<Signal>, std::shared_ptr<const FilterList>, std::shared_ptr<Delivery>
+                      >;
+
+    std::shared_ptr<Delivery> get_delivery(const std::string &event_name, EventDeliveryPolicy *policy = nullptr) const;
+    static void discard_pending_deliveries(Delivery &delivery);
 
     mutable boost::mutex event_infos_mutex_;
     std::map<std::string /*name*/, EventInfo> event_infos_;
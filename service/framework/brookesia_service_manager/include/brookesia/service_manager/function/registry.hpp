@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <map>
 #include <vector>
@@ -15,6 +16,7 @@
 #include "boost/thread/lock_guard.hpp"
 #include "boost/thread/mutex.hpp"
 #include "brookesia/service_manager/function/definition.hpp"
+#include "brookesia/service_manager/function/typed_value.hpp"
 
 namespace esp_brookesia::service {
 
@@ -23,22 +25,85 @@ namespace esp_brookesia::service {
  */
 using FunctionHandler = std::function < FunctionResult(FunctionParameterMap &&) >;
 
+class FunctionRegistry;
+
+/**
+ * @brief Resolved reference to a registered function.
+ *
+ * A handle is obtained once with `FunctionRegistry::get_handle()` and keeps the schema and handler bound, so
+ * calls through it skip the name lookup and the registry lock. It becomes invalid when the function is removed
+ * or its registry is destroyed.
+ */
+class FunctionHandle {
+public:
+    FunctionHandle() = default;
+
+    /**
+     * @brief Check whether the handle still refers to a registered function.
+     *
+     * @return true if the function is still registered.
+     */
+    bool is_valid() const
+    {
+        return entry_ && entry_->is_registered.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get the index of the function in its registry.
+     *
+     * @return size_t Registration index, stable until the function is removed.
+     */
+    size_t get_index() const
+    {
+        return entry_ ? entry_->index : 0;
+    }
+
+    /**
+     * @brief Get the schema bound to the handle.
+     *
+     * @return const FunctionSchema* Pointer to the schema, or `nullptr` for an empty handle.
+     */
+    const FunctionSchema *get_schema() const
+    {
+        return entry_ ? &entry_->schema : nullptr;
+    }
+
+private:
+    friend class FunctionRegistry;
+
+    struct Entry {
+        const FunctionRegistry *registry = nullptr;
+        size_t index = 0;
+        FunctionSchema schema;
+        FunctionHandler handler;
+        TypedFunctionHandler typed_handler;
+        std::atomic<bool> is_registered{true};
+    };
+
+    explicit FunctionHandle(std::shared_ptr<Entry> entry)
+        : entry_(std::move(entry))
+    {}
+
+    std::shared_ptr<Entry> entry_;
+};
+
 /**
  * @brief Registry of callable service functions and their schemas.
  */
 class FunctionRegistry {
 public:
     FunctionRegistry() = default;
-    ~FunctionRegistry() = default;
+    ~FunctionRegistry();
 
     /**
      * @brief Register a function schema and its handler.
      *
      * @param[in] func_schema Function metadata.
      * @param[in] func_handler Handler that executes the function.
+     * @param[in] typed_handler Optional handler for typed calls, see `call(const FunctionHandle &, TypedParameters)`.
      * @return true on success, false if the function name already exists.
      */
-    bool add(FunctionSchema func_schema, FunctionHandler func_handler);
+    bool add(FunctionSchema func_schema, FunctionHandler func_handler, TypedFunctionHandler typed_handler = nullptr);
     /**
      * @brief Remove a registered function.
      *
@@ -62,6 +127,69 @@ public:
      */
     FunctionResult call(const std::string &func_name, FunctionParameterMap parameters);
 
+    /**
+     * @brief Validate positional parameters and invoke a function through a resolved handle.
+     *
+     * Parameters are matched to the schema by position, missing trailing optional parameters use their
+     * default values. No name lookup or registry lock is involved.
+     *
+     * @param[in] handle Handle returned by `get_handle()`.
+     * @param[in] parameters_values Parameter values ordered as in the schema.
+     * @return FunctionResult Execution result or validation failure information.
+     */
+    FunctionResult call(const FunctionHandle &handle, std::vector<FunctionValue> parameters_values);
+
+    /**
+     * @brief Validate named parameters and invoke a function through a resolved handle.
+     *
+     * Same as `call(const std::string &, FunctionParameterMap)` without the name lookup and registry lock.
+     *
+     * @param[in] handle Handle returned by `get_handle()` or `get_handles()`.
+     * @param[in] parameters Parameter map passed to the handler.
+     * @return FunctionResult Execution result or validation failure information.
+     */
+    FunctionResult call(const FunctionHandle &handle, FunctionParameterMap parameters);
+
+    /**
+     * @brief Invoke a function through a resolved handle with typed C++ values.
+     *
+     * When every schema parameter is provided and the function has a typed handler which accepts the values, they
+     * are passed to it as they are. Otherwise the values are converted to `FunctionValue` and the call goes through
+     * the positional overload, including its validation and default values.
+     *
+     * @param[in] handle Handle returned by `get_handle()`.
+     * @param[in] parameters Typed values ordered as in the schema.
+     * @return FunctionResult Execution result or validation failure information.
+     */
+    FunctionResult call(const FunctionHandle &handle, TypedParameters parameters);
+
+    /**
+     * @brief Resolve a registered function into a handle.
+     *
+     * @param[in] func_name Function name to resolve.
+     * @return FunctionHandle Handle of the function, or an invalid handle if not found.
+     */
+    FunctionHandle get_handle(const std::string &func_name) const;
+
+    /**
+     * @brief Resolve the functions of a batch into handles, taking the registry lock once.
+     *
+     * @param[in] calls Function calls to resolve.
+     * @return std::vector<FunctionHandle> One handle per call, invalid for the functions that are not registered.
+     */
+    std::vector<FunctionHandle> get_handles(const std::vector<FunctionCall> &calls) const;
+
+    /**
+     * @brief Check whether a handle refers to a function currently registered in this registry.
+     *
+     * @param[in] handle Handle to check.
+     * @return true if the handle is valid and belongs to this registry.
+     */
+    bool is_handle_valid(const FunctionHandle &handle) const
+    {
+        return handle.is_valid() && (handle.entry_->registry == this);
+    }
+
     /**
      * @brief Look up the schema for a registered function.
      *
@@ -75,7 +203,7 @@ public:
         if (it == functions_.end()) {
             return nullptr;
         }
-        return &it->second.first;
+        return &it->second->schema;
     }
     /**
      * @brief Get a snapshot of all registered function schemas.
@@ -91,7 +219,7 @@ public:
         if (it == functions_.end()) {
             return std::nullopt;
         }
-        return it->second.first;
+        return it->second->schema;
     }
 
     std::vector<std::string> get_names() const
@@ -137,10 +265,17 @@ private:
     bool validate_parameters(
         const FunctionSchema &func_schema, FunctionParameterMap &parameters, std::string &error_msg
     );
+    bool validate_parameters(
+        const FunctionSchema &func_schema, std::vector<FunctionValue> &parameters_values,
+        FunctionParameterMap &parameters, std::string &error_msg
+    );
     bool validate_return_value(const FunctionSchema &func_schema, const FunctionResult &result, std::string &error_msg);
 
+    using Entry = FunctionHandle::Entry;
+
     mutable boost::mutex functions_mutex_;
-    std::map<std::string, std::pair<FunctionSchema, FunctionHandler>> functions_;
+    std::map<std::string, std::shared_ptr<Entry>> functions_;
+    size_t next_index_ = 0;
 };
 
 } // namespace esp_brookesia::service
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "boost/json.hpp"
+#include "brookesia/lib_utils/describe_helpers.hpp"
+#include "brookesia/service_manager/function/definition.hpp"
+
+namespace esp_brookesia::service {
+
+/**
+ * @brief Type-erased C++ value passed to a function through the typed call path.
+ *
+ * In-process callers wrap their arguments (e.g. `BROOKESIA_DESCRIBE_STRUCT` types) with `make()` so a typed
+ * handler can take them back with `get_if()` without a JSON round trip. The value also knows how to convert itself
+ * to a `FunctionValue`, which is used when the target function only has a regular handler.
+ *
+ * Copies share the stored value. No RTTI is needed, types are identified by a per-type tag.
+ */
+class TypedValue {
+public:
+    TypedValue() = default;
+
+    /**
+     * @brief Wrap a value.
+     *
+     * @tparam T Value type, either convertible to `FunctionValue` or supported by `BROOKESIA_DESCRIBE_TO_JSON`.
+     * @param[in] value Value to store, moved in when passed as an rvalue.
+     * @return TypedValue Wrapped value.
+     */
+    template <typename T>
+    static TypedValue make(T &&value)
+    {
+        using ValueType = std::decay_t<T>;
+
+        TypedValue typed_value;
+        typed_value.type_tag_ = get_type_tag<ValueType>();
+        typed_value.value_ = std::make_shared<ValueType>(std::forward<T>(value));
+        typed_value.converter_ = [](const void *value) {
+            return convert_to_function_value(*static_cast<const ValueType *>(value));
+        };
+
+        return typed_value;
+    }
+
+    /**
+     * @brief Check whether a value is stored.
+     */
+    bool has_value() const
+    {
+        return value_ != nullptr;
+    }
+
+    /**
+     * @brief Check whether the stored value is of type `T`.
+     */
+    template <typename T>
+    bool holds() const
+    {
+        return has_value() && (type_tag_ == get_type_tag<std::decay_t<T>>());
+    }
+
+    /**
+     * @brief Access the stored value if it is of type `T`.
+     *
+     * @return T* Pointer to the stored value, or `nullptr` on type mismatch.
+     */
+    template <typename T>
+    T *get_if()
+    {
+        return holds<T>() ? static_cast<T *>(value_.get()) : nullptr;
+    }
+
+    template <typename T>
+    const T *get_if() const
+    {
+        return holds<T>() ? static_cast<const T *>(value_.get()) : nullptr;
+    }
+
+    /**
+     * @brief Convert the stored value for the regular (`FunctionValue`) call path.
+     *
+     * @return std::optional<FunctionValue> Converted value, or `std::nullopt` if empty or not representable.
+     */
+    std::optional<FunctionValue> to_function_value() const
+    {
+        if (!has_value()) {
+            return std::nullopt;
+        }
+        return converter_(value_.get());
+    }
+
+private:
+    using TypeTag = const void *;
+    using Converter = std::optional<FunctionValue>(*)(const void *);
+
+    template <typename T>
+    static TypeTag get_type_tag()
+    {
+        static const char tag = 0;
+        return &tag;
+    }
+
+    template <typename T>
+    static std::optional<FunctionValue> convert_to_function_value(const T &value)
+    {
+        if constexpr (std::is_constructible_v<FunctionValue, const T &>) {
+            return FunctionValue(value);
+        } else {
+            auto json = BROOKESIA_DESCRIBE_TO_JSON(value);
+            if (json.is_object()) {
+                return FunctionValue(std::move(json.as_object()));
+            } else if (json.is_array()) {
+                return FunctionValue(std::move(json.as_array()));
+            } else if (json.is_string()) {
+                // Described enums are serialized as their names
+                return FunctionValue(std::string(json.as_string()));
+            }
+            return std::nullopt;
+        }
+    }
+
+    TypeTag type_tag_ = nullptr;
+    std::shared_ptr<void> value_;
+    Converter converter_ = nullptr;
+};
+
+/**
+ * @brief Typed values ordered as in the function schema.
+ */
+using TypedParameters = std::vector<TypedValue>;
+
+/**
+ * @brief Signature of an optional typed function implementation.
+ *
+ * Returns `std::nullopt` to decline values of unexpected types, the parameters must then be left untouched so
+ * the call can fall back to the regular handler.
+ */
+using TypedFunctionHandler = std::function<std::optional<FunctionResult>(TypedParameters &)>;
+
+} // namespace esp_brookesia::service
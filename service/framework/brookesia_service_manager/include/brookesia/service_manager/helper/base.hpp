@@ -15,11 +15,13 @@
 #include <memory>
 #include <tuple>
 #include <utility>
+#include <vector>
 #include <mutex>
 #include <condition_variable>
 #include <chrono>
 #include "boost/format.hpp"
 #include "brookesia/service_manager/function/definition.hpp"
+#include "brookesia/service_manager/function/typed_value.hpp"
 #include "brookesia/service_manager/event/definition.hpp"
 #include "brookesia/service_manager/service/manager.hpp"
 
@@ -89,11 +91,12 @@ public:
             std::is_same_v<FunctionIdType, typename Derived::FunctionId>, "FunctionIdType must be Derived::FunctionId"
         );
 
-        auto function_schemas = Derived::get_function_schemas();
-        for (const auto &function_schema : function_schemas) {
-            if (function_schema.name == BROOKESIA_DESCRIBE_ENUM_TO_STR(function_id)) {
-                return &function_schema;
-            }
+        // Schemas are static, so they are resolved by name only once
+        static const auto function_schema_table =
+            make_schema_table<FunctionIdType, FunctionSchema>(Derived::get_function_schemas());
+        const auto function_index = static_cast<std::size_t>(BROOKESIA_DESCRIBE_ENUM_TO_NUM(function_id));
+        if ((function_index < function_schema_table.size()) && (function_schema_table[function_index] != nullptr)) {
+            return function_schema_table[function_index];
         }
         auto error_msg = (boost::format("Service [%1%] function schema not found for function_id: %2%") %
                           Derived::get_name() % BROOKESIA_DESCRIBE_ENUM_TO_STR(function_id)).str();
@@ -109,18 +112,17 @@ public:
             std::is_same_v<EventIdType, typename Derived::EventId>, "EventIdType must be Derived::EventId"
         );
 
-        auto event_schemas = Derived::get_event_schemas();
+        static const auto event_schema_table =
+            make_schema_table<EventIdType, EventSchema>(Derived::get_event_schemas());
         const auto event_index = static_cast<std::size_t>(BROOKESIA_DESCRIBE_ENUM_TO_NUM(event_id));
-        if (event_index >= event_schemas.size()) {
+        if (event_index >= Derived::get_event_schemas().size()) {
             auto error_msg = (boost::format("Service [%1%] event schema index out of range: %2%") %
                               Derived::get_name() % BROOKESIA_DESCRIBE_ENUM_TO_NUM(event_id)).str();
             printf("%s\n", error_msg.c_str());
             return nullptr;
         }
-        for (const auto &event_schema : event_schemas) {
-            if (event_schema.name == BROOKESIA_DESCRIBE_ENUM_TO_STR(event_id)) {
-                return &event_schema;
-            }
+        if ((event_index < event_schema_table.size()) && (event_schema_table[event_index] != nullptr)) {
+            return event_schema_table[event_index];
         }
         auto error_msg = (boost::format("Service [%1%] event schema not found for event_id: %2%") %
                           Derived::get_name() % BROOKESIA_DESCRIBE_ENUM_TO_STR(event_id)).str();
@@ -131,18 +133,91 @@ public:
     static bool is_available()
     {
         static_assert(DerivedMeta<Derived>, "Derived must satisfy DerivedMeta concept");
-        return (ServiceManager::get_instance().get_service(Derived::get_name().data()) != nullptr);
+        return (get_service() != nullptr);
     }
 
     static bool is_running()
     {
         static_assert(DerivedMeta<Derived>, "Derived must satisfy DerivedMeta concept");
-        return is_available() && ServiceManager::get_instance().get_service(Derived::get_name().data())->is_running();
+        auto service = get_service();
+        return service && service->is_running();
+    }
+
+    /**
+     * @brief Get the service instance
+     *
+     * The handle is cached, it is only looked up again in the service manager after a service has been added or
+     * removed.
+     *
+     * @return std::shared_ptr<ServiceBase> Service instance, or nullptr if the service is not added
+     */
+    static std::shared_ptr<ServiceBase> get_service()
+    {
+        static_assert(DerivedMeta<Derived>, "Derived must satisfy DerivedMeta concept");
+
+        struct ServiceCache {
+            std::mutex mutex;
+            std::weak_ptr<ServiceBase> service;
+            uint32_t generation = 0;
+            bool is_valid = false;
+            bool is_found = false;
+        };
+        static ServiceCache cache;
+
+        auto &manager = ServiceManager::get_instance();
+        // Read the generation before looking up, a concurrent change will make the next call look up again
+        auto generation = manager.get_service_generation();
+        {
+            std::lock_guard lock(cache.mutex);
+            if (cache.is_valid && (cache.generation == generation)) {
+                if (!cache.is_found) {
+                    return nullptr;
+                }
+                auto service = cache.service.lock();
+                if (service) {
+                    return service;
+                }
+            }
+        }
+
+        auto service = manager.get_service(Derived::get_name().data());
+        {
+            std::lock_guard lock(cache.mutex);
+            cache.service = service;
+            cache.generation = generation;
+            cache.is_valid = true;
+            cache.is_found = (service != nullptr);
+        }
+        return service;
     }
 
 private:
     using ServiceAndSchema = std::pair<std::shared_ptr<ServiceBase>, const FunctionSchema *>;
 
+    /**
+     * @brief Build a table of schema pointers indexed by the numeric value of their identifiers
+     *
+     * @param[in] schemas Static schemas of the service
+     * @return std::vector<const SchemaType *> Schema table, entries without a matching schema are nullptr
+     */
+    template <typename IdType, typename SchemaType, typename SchemaSpan>
+    static std::vector<const SchemaType *> make_schema_table(const SchemaSpan &schemas)
+    {
+        std::vector<const SchemaType *> table(schemas.size(), nullptr);
+        for (const auto &schema : schemas) {
+            IdType id{};
+            if (!BROOKESIA_DESCRIBE_STR_TO_ENUM(schema.name, id)) {
+                continue;
+            }
+            const auto index = static_cast<std::size_t>(BROOKESIA_DESCRIBE_ENUM_TO_NUM(id));
+            if (index >= table.size()) {
+                table.resize(index + 1, nullptr);
+            }
+            table[index] = &schema;
+        }
+        return table;
+    }
+
     /**
      * @brief Helper function to validate and get service and function schema
      *
@@ -160,7 +235,7 @@ private:
             "FunctionIdType must be Derived::FunctionId"
         );
 
-        auto service = ServiceManager::get_instance().get_service(Derived::get_name().data());
+        auto service = get_service();
         if (!service) {
             return std::unexpected("Service not found");
         }
@@ -171,6 +246,63 @@ private:
         return ServiceAndSchema{service, function_schema};
     }
 
+    /**
+     * @brief Get the registry handle of a function
+     *
+     * Handles are cached per function ID together with the service and generation they were looked up in, like
+     * `get_service()`. They are only looked up again after a service has been added or removed, or the function
+     * has been unregistered.
+     *
+     * @param[in] service Service returned by `get_service()`
+     * @param[in] function_id Function ID to get the handle for
+     * @param[in] function_schema Schema of the function
+     * @return FunctionHandle Handle of the function, invalid if the function is not registered
+     */
+    template <typename FunctionIdType>
+    static FunctionHandle get_function_handle(
+        const std::shared_ptr<ServiceBase> &service, FunctionIdType function_id,
+        const FunctionSchema *function_schema
+    )
+    {
+        struct HandleCacheEntry {
+            std::weak_ptr<ServiceBase> service;
+            uint32_t generation = 0;
+            FunctionHandle handle;
+        };
+        struct HandleCache {
+            std::mutex mutex;
+            std::vector<HandleCacheEntry> entries;
+        };
+        static HandleCache cache;
+
+        const auto function_index = static_cast<std::size_t>(BROOKESIA_DESCRIBE_ENUM_TO_NUM(function_id));
+        // Read the generation before looking up, a concurrent change will make the next call look up again
+        auto generation = ServiceManager::get_instance().get_service_generation();
+        {
+            std::lock_guard lock(cache.mutex);
+            if (function_index < cache.entries.size()) {
+                auto &entry = cache.entries[function_index];
+                if ((entry.generation == generation) && entry.handle.is_valid() &&
+                        (entry.service.lock() == service)) {
+                    return entry.handle;
+                }
+            }
+        }
+
+        auto handle = service->get_function_handle(function_schema->name);
+        if (!handle.is_valid()) {
+            return handle;
+        }
+        {
+            std::lock_guard lock(cache.mutex);
+            if (function_index >= cache.entries.size()) {
+                cache.entries.resize(function_index + 1);
+            }
+            cache.entries[function_index] = HandleCacheEntry{service, generation, handle};
+        }
+        return handle;
+    }
+
     // Concept to check if a type is string-like (for event_name parameter)
     template<typename T>
     static constexpr bool is_string_type_v =
@@ -509,7 +641,7 @@ private:
             }
         };
 
-        auto service = ServiceManager::get_instance().get_service(Derived::get_name().data());
+        auto service = get_service();
         if (!service) {
             return EventRegistry::SignalConnection();
         }
@@ -571,7 +703,7 @@ private:
             }
         };
 
-        auto service = ServiceManager::get_instance().get_service(Derived::get_name().data());
+        auto service = get_service();
         if (!service) {
             return EventRegistry::SignalConnection();
         }
@@ -615,7 +747,7 @@ private:
             }
         };
 
-        auto service = ServiceManager::get_instance().get_service(Derived::get_name().data());
+        auto service = get_service();
         if (!service) {
             return EventRegistry::SignalConnection();
         }
@@ -830,6 +962,101 @@ public:
         }
     }
 
+    /**
+     * @brief Call a function synchronously with typed C++ arguments (timeout at end)
+     *
+     * Unlike `call_function_sync()`, arguments such as `BROOKESIA_DESCRIBE_STRUCT` types are passed by value to
+     * the service's typed handler without being serialized to JSON. Functions without a typed handler still work,
+     * the arguments are then converted as the regular path would do.
+     *
+     * @tparam ReturnType Expected return type (default: void)
+     * @tparam FunctionIdType Type of the function identifier (enum)
+     * @tparam Args Types of function arguments, optionally with Timeout at the end
+     * @param function_id Function identifier
+     * @param args Function arguments in order, last argument can be Timeout(ms)
+     * @return std::expected<ReturnType, std::string> Function result or error
+     *
+     * @code{.cpp}
+     * auto result = call_function_typed_sync(FunctionId::SetConfig, std::move(config), Timeout(500));
+     * @endcode
+     */
+    template <typename ReturnType = void, typename FunctionIdType, typename... Args>
+    static std::expected<ReturnType, std::string> call_function_typed_sync(
+        FunctionIdType function_id, Args && ... args
+    )
+    {
+        static_assert((0 + ... + (IsTimeout<Args> ? 1 : 0)) <= 1, "At most one Timeout argument is allowed");
+
+        auto service_and_schema = get_service_and_schema(function_id);
+        if (!service_and_schema) {
+            return std::unexpected(service_and_schema.error());
+        }
+        auto &[service, function_schema] = *service_and_schema;
+
+        auto handle = get_function_handle(service, function_id, function_schema);
+        if (!handle.is_valid()) {
+            return std::unexpected("Function not registered");
+        }
+
+        uint32_t timeout_ms = 0;
+        TypedParameters parameters;
+        parameters.reserve(sizeof...(Args));
+        ([&](auto &&arg) {
+            if constexpr (IsTimeout<decltype(arg)>) {
+                timeout_ms = arg.value;
+            } else {
+                parameters.push_back(TypedValue::make(std::forward<decltype(arg)>(arg)));
+            }
+        }(std::forward<Args>(args)), ...);
+
+        auto result = service->call_function_typed_sync(handle, std::move(parameters), timeout_ms);
+        return process_function_result<ReturnType>(result);
+    }
+
+    /**
+     * @brief Call a function asynchronously with typed C++ arguments
+     *
+     * See `call_function_typed_sync()` for how the arguments reach the service.
+     *
+     * @tparam FunctionIdType Type of the function identifier (enum)
+     * @tparam Args Types of function arguments, optionally with FunctionResultHandler at the end
+     * @param function_id Function identifier
+     * @param args Function arguments in order, optionally with FunctionResultHandler at the end
+     * @return true if the call was successfully submitted, false otherwise
+     */
+    template <typename FunctionIdType, typename... Args>
+    static bool call_function_typed_async(FunctionIdType function_id, Args &&... args)
+    {
+        static_assert(
+            (0 + ... + (IsFunctionResultHandler<Args> ? 1 : 0)) <= 1,
+            "At most one FunctionResultHandler argument is allowed"
+        );
+
+        auto service_and_schema = get_service_and_schema(function_id);
+        if (!service_and_schema) {
+            return false;
+        }
+        auto &[service, function_schema] = *service_and_schema;
+
+        auto handle = get_function_handle(service, function_id, function_schema);
+        if (!handle.is_valid()) {
+            return false;
+        }
+
+        ServiceBase::FunctionResultHandler handler = nullptr;
+        TypedParameters parameters;
+        parameters.reserve(sizeof...(Args));
+        ([&](auto &&arg) {
+            if constexpr (IsFunctionResultHandler<decltype(arg)>) {
+                handler = std::forward<decltype(arg)>(arg);
+            } else {
+                parameters.push_back(TypedValue::make(std::forward<decltype(arg)>(arg)));
+            }
+        }(std::forward<Args>(args)), ...);
+
+        return service->call_function_typed_async(handle, std::move(parameters), std::move(handler));
+    }
+
     /**
      * @brief Subscribe to an event with a raw SignalSlot
      *
@@ -853,13 +1080,46 @@ public:
             std::is_same_v<EventIdType, typename Derived::EventId>, "EventIdType must be Derived::EventId"
         );
 
-        auto service = ServiceManager::get_instance().get_service(Derived::get_name().data());
+        auto service = get_service();
         if (!service) {
             return EventRegistry::SignalConnection();
         }
         return service->subscribe_event(BROOKESIA_DESCRIBE_ENUM_TO_STR(event_id), slot);
     }
 
+    /**
+     * @brief Subscribe to the events whose items satisfy a predicate with a raw SignalSlot
+     *
+     * @tparam EventIdType Type of the event identifier (enum)
+     * @param event_id Event identifier
+     * @param slot Signal slot function, only invoked for matching events
+     * @param predicate Filter on the event items, events matching no subscriber are not published at all
+     * @return EventRegistry::SignalConnection Connection object (scoped, automatically unsubscribes on destruction)
+     *
+     * @code{.cpp}
+     * auto conn = subscribe_event(EventId::OutputChanged,
+     *     [](const std::string &event_name, const EventItemMap &items) {
+     *         // Only the "main" output
+     *     }, EventRegistry::make_item_predicate("output_name", std::string("main")));
+     * @endcode
+     */
+    template <typename EventIdType>
+    static EventRegistry::SignalConnection subscribe_event(
+        EventIdType event_id, EventRegistry::SignalSlot slot, EventRegistry::EventPredicate predicate
+    )
+    {
+        static_assert(DerivedMeta<Derived>, "Derived must satisfy DerivedMeta concept");
+        static_assert(
+            std::is_same_v<EventIdType, typename Derived::EventId>, "EventIdType must be Derived::EventId"
+        );
+
+        auto service = get_service();
+        if (!service) {
+            return EventRegistry::SignalConnection();
+        }
+        return service->subscribe_event(BROOKESIA_DESCRIBE_ENUM_TO_STR(event_id), slot, std::move(predicate));
+    }
+
     /**
      * @brief Subscribe to an event with automatic parameter extraction
      *
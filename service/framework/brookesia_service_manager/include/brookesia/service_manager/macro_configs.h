@@ -94,6 +94,13 @@
 #       define BROOKESIA_SERVICE_MANAGER_WORKER_POLL_INTERVAL_MS  (5)
 #   endif
 #endif
+#if !defined(BROOKESIA_SERVICE_MANAGER_WORKER_BLOCKING_WAIT)
+#   if defined(CONFIG_BROOKESIA_SERVICE_MANAGER_WORKER_BLOCKING_WAIT)
+#       define BROOKESIA_SERVICE_MANAGER_WORKER_BLOCKING_WAIT  CONFIG_BROOKESIA_SERVICE_MANAGER_WORKER_BLOCKING_WAIT
+#   else
+#       define BROOKESIA_SERVICE_MANAGER_WORKER_BLOCKING_WAIT  (0)
+#   endif
+#endif
 #if !defined(BROOKESIA_SERVICE_MANAGER_WORKER_NUM)
 #   if defined(CONFIG_BROOKESIA_SERVICE_MANAGER_WORKER_NUM)
 #       define BROOKESIA_SERVICE_MANAGER_WORKER_NUM  CONFIG_BROOKESIA_SERVICE_MANAGER_WORKER_NUM
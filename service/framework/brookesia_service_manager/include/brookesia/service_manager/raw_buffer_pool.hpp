@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "boost/thread/mutex.hpp"
+#include "brookesia/service_manager/common.hpp"
+
+namespace esp_brookesia::service {
+
+/**
+ * @brief Fixed-size block pool handing out shared `RawBuffer`s.
+ *
+ * Blocks are allocated once at creation and return to the pool when the last copy of the buffer is destroyed, so
+ * producers can hand frames or stream chunks to other services without copying and without a heap allocation per
+ * buffer. The pool stays alive while any of its buffers is in use.
+ *
+ * @code{.cpp}
+ * auto pool = RawBufferPool::create(4096, 4);
+ * auto buffer = pool->acquire(2048);
+ * if (buffer.is_shared()) {
+ *     fill(buffer.to_ptr<uint8_t>(), buffer.data_size);
+ *     helper.call_function_async(FunctionId::Write, buffer);
+ * }
+ * @endcode
+ */
+class RawBufferPool: public std::enable_shared_from_this<RawBufferPool> {
+public:
+    /**
+     * @brief Create a pool.
+     *
+     * @param[in] block_size Size of each block in bytes.
+     * @param[in] block_count Number of blocks.
+     * @return std::shared_ptr<RawBufferPool> Pool, or `nullptr` if the arguments are invalid or the allocation failed.
+     */
+    static std::shared_ptr<RawBufferPool> create(size_t block_size, size_t block_count);
+
+    RawBufferPool(const RawBufferPool &) = delete;
+    RawBufferPool &operator=(const RawBufferPool &) = delete;
+
+    /**
+     * @brief Take a free block.
+     *
+     * @param[in] size Size of the returned buffer, at most the block size.
+     * @return RawBuffer Mutable shared buffer, empty if no block is free or `size` does not fit.
+     */
+    RawBuffer acquire(size_t size);
+
+    size_t get_block_size() const
+    {
+        return block_size_;
+    }
+
+    size_t get_block_count() const
+    {
+        return block_count_;
+    }
+
+    /**
+     * @brief Get the number of blocks currently free.
+     */
+    size_t get_free_count() const;
+
+private:
+    RawBufferPool(size_t block_size, size_t block_count, std::unique_ptr<uint8_t[]> storage);
+
+    void release(uint8_t *block);
+
+    const size_t block_size_;
+    const size_t block_count_;
+    std::unique_ptr<uint8_t[]> storage_;
+
+    mutable boost::mutex free_blocks_mutex_;
+    std::vector<uint8_t *> free_blocks_;
+};
+
+} // namespace esp_brookesia::service
@@ -13,9 +13,11 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <vector>
 #include "boost/thread/shared_mutex.hpp"
+#include "brookesia/lib_utils/coroutine.hpp"
 #include "brookesia/lib_utils/task_scheduler.hpp"
 #include "brookesia/service_manager/macro_configs.h"
 #include "brookesia/service_manager/function/registry.hpp"
@@ -45,6 +47,10 @@ public:
      * @brief Map from function names to service-side handlers.
      */
     using FunctionHandlerMap = std::map<std::string, FunctionHandler>;
+    /**
+     * @brief Map from function names to optional typed handlers, see `get_typed_function_handlers()`.
+     */
+    using TypedFunctionHandlerMap = std::map<std::string, TypedFunctionHandler>;
     /**
      * @brief Callback invoked with the result of an asynchronous function call.
      */
@@ -222,10 +228,52 @@ public:
         const std::string &name, const boost::json::object &parameters_json, FunctionResultHandler handler = nullptr
     );
 
+    /**
+     * @brief Resolve a function once for repeated calls by handle
+     *
+     * @param[in] name Function name to resolve
+     * @return FunctionHandle Handle of the function, invalid if the service is not initialized or the function is
+     *         not found
+     */
+    FunctionHandle get_function_handle(const std::string &name);
+
+    /**
+     * @brief Call a function asynchronously through a resolved handle (non-blocking)
+     *
+     * Unlike the name based overloads, no function lookup is performed and parameters are validated by position.
+     *
+     * @param[in] handle Handle returned by `get_function_handle()`
+     * @param[in] parameters_values FunctionParameterMap values (ordered array)
+     * @param[in] handler FunctionResultHandler to handle the result, if not provided, the result will be ignored
+     * @return true if called successfully, false otherwise
+     */
+    bool call_function_async(
+        const FunctionHandle &handle, std::vector<FunctionValue> parameters_values,
+        FunctionResultHandler handler = nullptr
+    );
+
+    /**
+     * @brief Call a function asynchronously with typed C++ values (non-blocking)
+     *
+     * The values are handed to the function's typed handler as they are, without going through `FunctionValue`
+     * or JSON. If the function has no typed handler, or it declines the value types, the values are converted and
+     * the regular handler is called instead.
+     *
+     * @param[in] handle Handle returned by `get_function_handle()`
+     * @param[in] parameters Typed values ordered as in the schema
+     * @param[in] handler FunctionResultHandler to handle the result, if not provided, the result will be ignored
+     * @return true if called successfully, false otherwise
+     */
+    bool call_function_typed_async(
+        const FunctionHandle &handle, TypedParameters parameters, FunctionResultHandler handler = nullptr
+    );
+
     /**
      * @brief Call multiple functions asynchronously on this service in order.
      *
-     * The batch is fail-fast: once one function fails, later functions are skipped.
+     * The batch is fail-fast: once one function fails, later functions are skipped. All functions are resolved
+     * under one registry lock and executed by a single task, between the `on_function_batch_start()` and
+     * `on_function_batch_end()` hooks.
      *
      * @param[in] calls Function calls to execute.
      * @param[in] handler FunctionBatchResultHandler to handle the batch result.
@@ -233,6 +281,31 @@ public:
      */
     bool call_functions_async(std::vector<FunctionCall> calls, FunctionBatchResultHandler handler = nullptr);
 
+    /**
+     * @brief Call a function from a coroutine with parameters map (non-blocking)
+     *
+     * Usage: `auto result = co_await service.co_call_function("name", {});`. The awaiting coroutine is suspended
+     * instead of blocking a scheduler worker, and resumes on the thread that delivers the result.
+     *
+     * @param[in] name Function name to call
+     * @param[in] parameters_map FunctionParameterMap map (key-value pairs)
+     * @return Awaitable yielding the FunctionResult, a failed result is yielded immediately if the call is rejected
+     */
+    lib_utils::CallbackAwaiter<FunctionResult> co_call_function(
+        const std::string &name, FunctionParameterMap parameters_map
+    );
+
+    /**
+     * @brief Call a function from a coroutine with parameters values (non-blocking)
+     *
+     * @param[in] name Function name to call
+     * @param[in] parameters_values FunctionParameterMap values (ordered array)
+     * @return Awaitable yielding the FunctionResult, a failed result is yielded immediately if the call is rejected
+     */
+    lib_utils::CallbackAwaiter<FunctionResult> co_call_function(
+        const std::string &name, std::vector<FunctionValue> parameters_values
+    );
+
     /**
      * @brief Call a function synchronously with parameters map (blocking with timeout)
      *
@@ -272,6 +345,33 @@ public:
         uint32_t timeout_ms = 0
     );
 
+    /**
+     * @brief Call a function synchronously through a resolved handle (blocking with timeout)
+     *
+     * @param[in] handle Handle returned by `get_function_handle()`
+     * @param[in] parameters_values FunctionParameterMap values (ordered array)
+     * @param[in] timeout_ms Timeout in milliseconds. `0` uses the function schema default or manager default.
+     * @return FunctionResult Result of the function call
+     */
+    FunctionResult call_function_sync(
+        const FunctionHandle &handle, std::vector<FunctionValue> parameters_values,
+        uint32_t timeout_ms = 0
+    );
+
+    /**
+     * @brief Call a function synchronously with typed C++ values (blocking with timeout)
+     *
+     * See `call_function_typed_async()` for how the values reach the handler.
+     *
+     * @param[in] handle Handle returned by `get_function_handle()`
+     * @param[in] parameters Typed values ordered as in the schema
+     * @param[in] timeout_ms Timeout in milliseconds. `0` uses the function schema default or manager default.
+     * @return FunctionResult Result of the function call
+     */
+    FunctionResult call_function_typed_sync(
+        const FunctionHandle &handle, TypedParameters parameters, uint32_t timeout_ms = 0
+    );
+
     /**
      * @brief Call multiple functions synchronously on this service in order.
      *
@@ -296,6 +396,20 @@ public:
         const std::string &event_name, const EventRegistry::SignalSlot &slot
     );
 
+    /**
+     * @brief Subscribe to the events whose items satisfy a predicate
+     *
+     * The predicate is also checked by `publish_event()`, an event matching no subscriber is not scheduled at all.
+     *
+     * @param[in] event_name Event name to subscribe
+     * @param[in] slot Callback slot to be invoked when a matching event is published
+     * @param[in] predicate Filter on the event items, e.g. `EventRegistry::make_item_predicate()`
+     * @return EventRegistry::SignalConnection RAII scoped connection object for managing the subscription
+     */
+    EventRegistry::SignalConnection subscribe_event(
+        const std::string &event_name, const EventRegistry::SignalSlot &slot, EventRegistry::EventPredicate predicate
+    );
+
     /**
      * @brief Check if the service is initialized
      *
@@ -444,7 +558,9 @@ protected:
     /**
      * @brief Function-batch execution start callback.
      *
-     * Subclasses can override this hook to create state scoped to one ordered batch.
+     * Subclasses can override this hook to open a transaction scoped to one ordered batch, for example to defer
+     * hardware writes until the end of the batch. Function handlers can tell whether they run inside the batch
+     * with @c is_in_function_batch().
      * The matching @c on_function_batch_end() callback is invoked before the batch task returns.
      *
      * @param[in] calls Function calls that will be executed in order.
@@ -456,9 +572,25 @@ protected:
 
     /**
      * @brief Function-batch execution end callback.
+     *
+     * Subclasses complete the work deferred during the batch here, or discard it when the batch failed. The result
+     * is delivered to the caller after this hook, so a failed commit can be reported by updating it.
+     *
+     * @param[in,out] result Result of the executed calls.
+     */
+    virtual void on_function_batch_end(FunctionBatchResult &result)
+    {
+        (void)result;
+    }
+
+    /**
+     * @brief Check whether the calling thread is executing a function batch of this service.
+     *
+     * @return true between @c on_function_batch_start() and @c on_function_batch_end() on the batch thread.
      */
-    virtual void on_function_batch_end()
+    bool is_in_function_batch() const
     {
+        return function_batch_thread_.load(std::memory_order_acquire) == std::this_thread::get_id();
     }
 
     /**
@@ -492,14 +624,41 @@ protected:
         return {};
     }
 
+    /**
+     * @brief Get typed function handlers map
+     *
+     * Optional fast path for in-process callers using `call_function_typed_sync()` or
+     * `call_function_typed_async()`. A typed handler receives the caller's C++ values directly and returns
+     * `std::nullopt` when it does not recognize their types, in which case the regular handler from
+     * `get_function_handlers()` is used with converted values. Remote and scripted callers always use the regular
+     * handler.
+     *
+     * @return TypedFunctionHandlerMap Typed function handlers map
+     *
+     * @code{.cpp}
+     * TypedFunctionHandlerMap get_typed_function_handlers() override {
+     *     return {
+     *         BROOKESIA_SERVICE_TYPED_FUNC_HANDLER_1("set_config", Config, function_set_config(std::move(PARAM)))
+     *     };
+     * }
+     * @endcode
+     */
+    virtual TypedFunctionHandlerMap get_typed_function_handlers()
+    {
+        return {};
+    }
+
     /**
      * @brief Register function list (internal use)
      *
      * @param[in] schemas Function schemas list
      * @param[in] handlers Function handler map
+     * @param[in] typed_handlers Optional typed function handler map
      * @return true if registered successfully, false otherwise
      */
-    bool register_functions(std::vector<FunctionSchema> schemas, FunctionHandlerMap handlers);
+    bool register_functions(
+        std::vector<FunctionSchema> schemas, FunctionHandlerMap handlers, TypedFunctionHandlerMap typed_handlers = {}
+    );
 
     /**
      * @brief Unregister function list (internal use)
@@ -616,6 +775,11 @@ protected:
     void stop();
 
 private:
+    using HandleInvoker = std::function<FunctionResult(FunctionRegistry &)>;
+
+    bool call_handle_async(const FunctionHandle &handle, HandleInvoker invoker, FunctionResultHandler handler);
+    FunctionResult call_handle_sync(const FunctionHandle &handle, HandleInvoker invoker, uint32_t timeout_ms);
+
     bool init(std::shared_ptr<lib_utils::TaskScheduler> task_scheduler);
     void deinit();
 
@@ -641,6 +805,7 @@ private:
     boost::shared_mutex state_mutex_;  // Protect state transitions (init/deinit/start/stop)
     std::atomic<bool> is_initialized_{false};
     std::atomic<bool> is_running_{false};
+    std::atomic<std::thread::id> function_batch_thread_{};
 
     // Use shared_ptr instead of unique_ptr to support thread-safe access
     mutable boost::shared_mutex resources_mutex_;  // Protect resources access
@@ -737,4 +902,55 @@ BROOKESIA_DESCRIBE_STRUCT(
         } \
     }
 
+// ============================================================================
+// Helper macros: Simplify TypedFunctionHandlerMap writing
+// ============================================================================
+
+/**
+ * @brief Create a single-parameter typed function handler
+ *
+ * The handler declines the call (falls back to the regular handler) unless the value holds `param_type`.
+ *
+ * @param func_name Function name string
+ * @param param_type Parameter C++ type (e.g., a `BROOKESIA_DESCRIBE_STRUCT` type)
+ * @param func_call Function call, use PARAM as parameter placeholder
+ *
+ * Example:
+ * BROOKESIA_SERVICE_TYPED_FUNC_HANDLER_1("set_config", Config, function_set_config(std::move(PARAM)))
+ */
+#define BROOKESIA_SERVICE_TYPED_FUNC_HANDLER_1(func_name, param_type, func_call) \
+    { \
+        func_name, \
+        [this](esp_brookesia::service::TypedParameters &args) \
+                -> std::optional<esp_brookesia::service::FunctionResult> { \
+            auto *PARAM_PTR = (args.size() == 1) ? args[0].get_if<param_type>() : nullptr; \
+            if (PARAM_PTR == nullptr) { \
+                return std::nullopt; \
+            } \
+            auto &PARAM = *PARAM_PTR; \
+            return esp_brookesia::service::ServiceBase::to_function_result(func_call); \
+        } \
+    }
+
+/**
+ * @brief Create a two-parameter typed function handler
+ *
+ * Usage is similar to BROOKESIA_SERVICE_TYPED_FUNC_HANDLER_1, supports PARAM1, PARAM2
+ */
+#define BROOKESIA_SERVICE_TYPED_FUNC_HANDLER_2(func_name, param1_type, param2_type, func_call) \
+    { \
+        func_name, \
+        [this](esp_brookesia::service::TypedParameters &args) \
+                -> std::optional<esp_brookesia::service::FunctionResult> { \
+            auto *PARAM1_PTR = (args.size() == 2) ? args[0].get_if<param1_type>() : nullptr; \
+            auto *PARAM2_PTR = (args.size() == 2) ? args[1].get_if<param2_type>() : nullptr; \
+            if ((PARAM1_PTR == nullptr) || (PARAM2_PTR == nullptr)) { \
+                return std::nullopt; \
+            } \
+            auto &PARAM1 = *PARAM1_PTR; \
+            auto &PARAM2 = *PARAM2_PTR; \
+            return esp_brookesia::service::ServiceBase::to_function_result(func_call); \
+        } \
+    }
+
 } // namespace esp_brookesia::service
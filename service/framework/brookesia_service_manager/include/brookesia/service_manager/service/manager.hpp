@@ -5,6 +5,8 @@
  */
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <list>
 #include <map>
@@ -134,6 +136,41 @@ public:
     using ServiceState = ManagerService::ServiceState;
     using ServiceInfo = ManagerService::ServiceInfo;
 
+    /**
+     * @brief Timestamps of the most recent start of a service
+     *
+     * Times are in microseconds since the service manager was initialized.
+     */
+    struct ServiceStartRecord {
+        std::string name;       ///< Service name
+        uint64_t start_us = 0;  ///< Time `start()` of the service was entered
+        uint64_t finish_us = 0; ///< Time `start()` of the service returned
+        bool success = false;   ///< Whether the service started successfully
+    };
+
+    /**
+     * @brief Configuration of `bind_parallel()`
+     */
+    struct ParallelBindConfig {
+        size_t max_concurrency = 4;             ///< Maximum number of services starting at the same time
+        lib_utils::ThreadConfig thread_config;  ///< Configuration of the threads starting the services
+    };
+
+    /**
+     * @brief Default configuration used by `bind_parallel()`.
+     *
+     * Startup threads use the priority and stack of the service workers.
+     */
+    static ParallelBindConfig make_default_parallel_bind_config()
+    {
+        ParallelBindConfig config;
+        config.thread_config.name = std::string(BROOKESIA_SERVICE_MANAGER_WORKER_NAME) + "Boot";
+        config.thread_config.priority = BROOKESIA_SERVICE_MANAGER_WORKER_PRIORITY;
+        config.thread_config.stack_size = BROOKESIA_SERVICE_MANAGER_WORKER_STACK_SIZE;
+        config.thread_config.stack_in_ext = BROOKESIA_SERVICE_MANAGER_WORKER_STACK_IN_EXT;
+        return config;
+    }
+
     /**
      * @brief Default worker configuration used by `start()`.
      *
@@ -180,6 +217,9 @@ public:
         config.worker_configs.push_back(worker3);
 #endif
         config.worker_poll_interval_ms = BROOKESIA_SERVICE_MANAGER_WORKER_POLL_INTERVAL_MS;
+#if BROOKESIA_SERVICE_MANAGER_WORKER_BLOCKING_WAIT
+        config.worker_mode = lib_utils::TaskScheduler::WorkerMode::Blocking;
+#endif
         return config;
     }
 
@@ -287,6 +327,36 @@ public:
      */
     ServiceBinding bind(const std::string &name);
 
+    /**
+     * @brief Bind several services, starting independent services concurrently
+     *
+     * The requested services and their dependencies are started along the dependency graph: a service starts as
+     * soon as all of its dependencies are running, on one of at most `max_concurrency` dedicated threads. This
+     * shortens the startup of services that mostly wait on hardware in `on_start()`.
+     *
+     * @param[in] names Names of the services to bind
+     * @param[in] config Parallel startup configuration
+     * @return std::vector<ServiceBinding> One binding per requested name, in the same order. The binding of a
+     *         service that failed to start, or whose dependency failed to start, is invalid.
+     */
+    std::vector<ServiceBinding> bind_parallel(const std::vector<std::string> &names, const ParallelBindConfig &config);
+
+    /**
+     * @brief Bind several services with the default parallel startup configuration
+     *
+     * @param[in] names Names of the services to bind
+     * @return std::vector<ServiceBinding> One binding per requested name, in the same order
+     */
+    std::vector<ServiceBinding> bind_parallel(const std::vector<std::string> &names);
+
+    /**
+     * @brief Get the boot timeline
+     *
+     * @return std::vector<ServiceStartRecord> Most recent start of every service started since the service manager
+     *         was initialized, ordered by start time
+     */
+    std::vector<ServiceStartRecord> get_boot_timeline() const;
+
     /**
      * @brief Get all registered service names in lexical order.
      *
@@ -354,6 +424,19 @@ public:
         return (it != services_.end()) ? it->second.service : nullptr;
     }
 
+    /**
+     * @brief Get the service generation
+     *
+     * The generation changes every time a service is added or removed, so a cached service handle is valid as long
+     * as the generation it was looked up in is current.
+     *
+     * @return uint32_t Current service generation
+     */
+    uint32_t get_service_generation() const
+    {
+        return service_generation_.load(std::memory_order_acquire);
+    }
+
     /**
      * @brief Get the singleton instance
      *
@@ -374,6 +457,7 @@ private:
         std::shared_ptr<ServiceBase> service; ///< Managed service instance.
         ServiceState state; ///< Current lifecycle state.
         boost::condition_variable_any transition_cv; ///< Signals completion of start or stop transitions.
+        std::optional<ServiceStartRecord> start_record; ///< Most recent start of the service.
     };
 
     ServiceManager() = default;
@@ -389,10 +473,12 @@ private:
 
     void add_all_registered_services();
     void remove_all_registered_services();
+    uint64_t get_boot_elapsed_us() const;
 
     boost::mutex state_mutex_;  // Protect state transitions (init/deinit/start/stop)
     std::atomic<bool> is_initialized_{false};
     std::atomic<bool> is_running_{false};
+    std::chrono::steady_clock::time_point init_time_;
 
     std::shared_ptr<lib_utils::TaskScheduler> task_scheduler_;
     std::shared_ptr<lib_utils::TaskScheduler> secondary_task_scheduler_;
@@ -404,7 +490,11 @@ private:
     // Service management
     mutable boost::shared_mutex service_mutex_;
     std::map<std::string, RuntimeServiceInfo> services_;
+    std::atomic<uint32_t> service_generation_{0};
     std::list<std::string> service_init_order_;
 };
 
+BROOKESIA_DESCRIBE_STRUCT(ServiceManager::ServiceStartRecord, (), (name, start_us, finish_us, success));
+BROOKESIA_DESCRIBE_STRUCT(ServiceManager::ParallelBindConfig, (), (max_concurrency, thread_config));
+
 } // namespace esp_brookesia::service
@@ -81,6 +81,13 @@ public:
         std::optional<ThreadDebugSnapshot> thread;
     };
 
+    struct SchedulerDebugSnapshot {
+        uint64_t timestamp_ms = 0;
+        std::vector<uint64_t> latency_histogram_bounds_us;
+        lib_utils::TaskScheduler::Statistics statistics;
+        std::vector<lib_utils::TaskScheduler::GroupStatistics> groups;
+    };
+
     enum class FunctionId : uint8_t {
         GetDebugCapabilities,
         GetDebugConfig,
@@ -92,6 +99,7 @@ public:
         GetDebugState,
         GetDebugSnapshot,
         GetMemorySnapshot,
+        GetSchedulerSnapshot,
         Max,
     };
 
@@ -124,6 +132,7 @@ private:
     std::vector<FunctionSchema> get_function_schemas() override;
     std::vector<EventSchema> get_event_schemas() override;
     FunctionHandlerMap get_function_handlers() override;
+    TypedFunctionHandlerMap get_typed_function_handlers() override;
     void on_stop() override;
     void on_deinit() override;
 
@@ -160,6 +169,9 @@ BROOKESIA_DESCRIBE_STRUCT(
 );
 BROOKESIA_DESCRIBE_STRUCT(UtilsService::ThreadDebugSnapshot, (), (timestamp_ms, tasks));
 BROOKESIA_DESCRIBE_STRUCT(UtilsService::DebugSnapshot, (), (state, config, memory, thread));
+BROOKESIA_DESCRIBE_STRUCT(
+    UtilsService::SchedulerDebugSnapshot, (), (timestamp_ms, latency_histogram_bounds_us, statistics, groups)
+);
 BROOKESIA_DESCRIBE_ENUM(
     UtilsService::FunctionId,
     GetDebugCapabilities,
@@ -172,6 +184,7 @@ BROOKESIA_DESCRIBE_ENUM(
     GetDebugState,
     GetDebugSnapshot,
     GetMemorySnapshot,
+    GetSchedulerSnapshot,
     Max
 );
 BROOKESIA_DESCRIBE_ENUM(
@@ -30,10 +30,14 @@ bool EventRegistry::add(EventSchema event_schema)
     }
 
     std::unique_ptr<Signal> signal;
+    std::shared_ptr<Delivery> delivery;
     BROOKESIA_CHECK_EXCEPTION_RETURN(
         signal = std::make_unique<Signal>(), false, "Failed to create signal"
     );
-    event_infos_[event_schema.name] = std::make_tuple(event_schema, std::move(signal));
+    BROOKESIA_CHECK_EXCEPTION_RETURN(
+        delivery = std::make_shared<Delivery>(), false, "Failed to create delivery"
+    );
+    event_infos_[event_schema.name] = std::make_tuple(event_schema, std::move(signal), nullptr, std::move(delivery));
 
     return true;
 }
@@ -113,7 +117,7 @@ std::vector<EventSchema> EventRegistry::get_schemas() const
 
     std::vector<EventSchema> schemas;
     for (const auto& [name, event_info] : event_infos_) {
-        auto &[schema, signal] = event_info;
+        auto &[schema, signal, filters, delivery] = event_info;
         schemas.push_back(schema);
     }
     return schemas;
@@ -125,7 +129,7 @@ boost::json::array EventRegistry::get_schemas_json()
 
     boost::json::array schemas;
     for (const auto& [name, event_info] : event_infos_) {
-        auto &[schema, signal] = event_info;
+        auto &[schema, signal, filters, delivery] = event_info;
         schemas.push_back(BROOKESIA_DESCRIBE_TO_JSON(schema));
     }
 
@@ -142,4 +146,250 @@ EventRegistry::Signal *EventRegistry::get_signal(const std::string &event_name)
     return std::get<1>(it->second).get();
 }
 
+EventRegistry::SignalConnection EventRegistry::subscribe(
+    const std::string &event_name, SignalSlot slot, EventPredicate predicate
+)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    BROOKESIA_LOGD("Params: event_name(%1%)", event_name);
+
+    BROOKESIA_CHECK_FALSE_RETURN(slot != nullptr, SignalConnection(), "Slot is null");
+    BROOKESIA_CHECK_FALSE_RETURN(predicate != nullptr, SignalConnection(), "Predicate is null");
+
+    boost::lock_guard lock(event_infos_mutex_);
+
+    auto it = event_infos_.find(event_name);
+    BROOKESIA_CHECK_FALSE_RETURN(it != event_infos_.end(), SignalConnection(), "Event not found");
+
+    auto &signal = std::get<1>(it->second);
+    auto &filters = std::get<2>(it->second);
+
+    // The slot checks the predicate again at emission, other subscribers may have matched the pre-check
+    auto connection = signal->connect([slot = std::move(slot), predicate](
+    const std::string & name, const EventItemMap & event_items) {
+        if (predicate(event_items)) {
+            slot(name, event_items);
+        }
+    });
+
+    // Republish the filter list, dropping the disconnected subscriptions at the same time
+    auto updated_filters = std::make_shared<FilterList>();
+    if (filters) {
+        updated_filters->reserve(filters->size() + 1);
+        for (const auto &filter : *filters) {
+            if (filter.connection.connected()) {
+                updated_filters->push_back(filter);
+            }
+        }
+    }
+    updated_filters->push_back(Filter{
+        .connection = connection,
+        .predicate = std::move(predicate),
+    });
+    filters = std::move(updated_filters);
+
+    return SignalConnection(connection);
+}
+
+bool EventRegistry::has_matching_subscribers(const std::string &event_name, const EventItemMap &event_items) const
+{
+    size_t slot_count = 0;
+    std::shared_ptr<const FilterList> filters;
+    {
+        boost::lock_guard lock(event_infos_mutex_);
+        auto it = event_infos_.find(event_name);
+        if (it == event_infos_.end()) {
+            return false;
+        }
+        slot_count = std::get<1>(it->second)->num_slots();
+        filters = std::get<2>(it->second);
+    }
+    if ((slot_count == 0) || !filters) {
+        return slot_count > 0;
+    }
+
+    size_t filtered_count = 0;
+    for (const auto &filter : *filters) {
+        if (!filter.connection.connected()) {
+            continue;
+        }
+        if (filter.predicate(event_items)) {
+            return true;
+        }
+        filtered_count++;
+    }
+
+    // Any remaining slot is an unfiltered subscriber
+    return slot_count > filtered_count;
+}
+
+EventRegistry::EventPredicate EventRegistry::make_item_predicate(std::string item_name, EventItem value)
+{
+    return [item_name = std::move(item_name), value = std::move(value)](const EventItemMap & event_items) {
+        auto it = event_items.find(item_name);
+        if (it == event_items.end()) {
+            return false;
+        }
+
+        return std::visit([](const auto & expected, const auto & actual) {
+            using ExpectedType = std::decay_t<decltype(expected)>;
+            using ActualType = std::decay_t<decltype(actual)>;
+            if constexpr (!std::is_same_v<ExpectedType, ActualType>) {
+                return false;
+            } else if constexpr (std::is_same_v<ExpectedType, RawBuffer>) {
+                return (expected.data_ptr == actual.data_ptr) && (expected.data_size == actual.data_size);
+            } else {
+                return expected == actual;
+            }
+        }, static_cast<const EventItem::Base &>(value), static_cast<const EventItem::Base &>(it->second));
+    };
+}
+
+EventRegistry::DeliveryAction EventRegistry::queue_delivery(
+    const std::string &event_name, EventItemMap &event_items, uint32_t &delay_ms
+)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    EventDeliveryPolicy policy;
+    auto delivery = get_delivery(event_name, &policy);
+    BROOKESIA_CHECK_NULL_RETURN(delivery, DeliveryAction::Dropped, "Event not found");
+
+    auto now = std::chrono::steady_clock::now();
+    auto interval = std::chrono::milliseconds(policy.min_interval_ms);
+
+    boost::lock_guard lock(delivery->mutex);
+
+    delivery->stats.published++;
+
+    if (policy.mode == EventDeliveryMode::Immediate) {
+        if (policy.min_interval_ms > 0) {
+            if (delivery->last_delivery_time && ((now - *delivery->last_delivery_time) < interval)) {
+                delivery->stats.dropped++;
+                return DeliveryAction::Dropped;
+            }
+            delivery->last_delivery_time = now;
+        }
+        return DeliveryAction::Emit;
+    }
+
+    if ((policy.mode == EventDeliveryMode::Coalesce) && !delivery->pending.empty()) {
+        delivery->pending.back() = std::move(event_items);
+        delivery->stats.coalesced++;
+    } else {
+        if ((policy.max_batch_size > 0) && (delivery->pending.size() >= policy.max_batch_size)) {
+            delivery->pending.pop_front();
+            delivery->stats.dropped++;
+        }
+        delivery->pending.push_back(std::move(event_items));
+    }
+
+    if (delivery->scheduled) {
+        return DeliveryAction::Merged;
+    }
+    delivery->scheduled = true;
+
+    delay_ms = 0;
+    if (delivery->last_delivery_time) {
+        auto elapsed = now - *delivery->last_delivery_time;
+        if (elapsed < interval) {
+            delay_ms = static_cast<uint32_t>(
+                           std::chrono::duration_cast<std::chrono::milliseconds>(interval - elapsed).count()
+                       );
+        }
+    }
+
+    return DeliveryAction::Schedule;
+}
+
+std::vector<EventItemMap> EventRegistry::take_pending_deliveries(const std::string &event_name)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    auto delivery = get_delivery(event_name);
+    BROOKESIA_CHECK_NULL_RETURN(delivery, {}, "Event not found");
+
+    boost::lock_guard lock(delivery->mutex);
+
+    std::vector<EventItemMap> deliveries(
+        std::make_move_iterator(delivery->pending.begin()), std::make_move_iterator(delivery->pending.end())
+    );
+    delivery->pending.clear();
+    delivery->scheduled = false;
+    delivery->last_delivery_time = std::chrono::steady_clock::now();
+
+    return deliveries;
+}
+
+void EventRegistry::discard_pending_deliveries(const std::string &event_name)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    auto delivery = get_delivery(event_name);
+    if (delivery) {
+        discard_pending_deliveries(*delivery);
+    }
+}
+
+void EventRegistry::discard_pending_deliveries()
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    std::vector<std::shared_ptr<Delivery>> deliveries;
+    {
+        boost::lock_guard lock(event_infos_mutex_);
+        deliveries.reserve(event_infos_.size());
+        for (const auto &[name, event_info] : event_infos_) {
+            deliveries.push_back(std::get<3>(event_info));
+        }
+    }
+    for (const auto &delivery : deliveries) {
+        discard_pending_deliveries(*delivery);
+    }
+}
+
+std::optional<EventDeliveryStats> EventRegistry::get_delivery_stats(const std::string &event_name) const
+{
+    auto delivery = get_delivery(event_name);
+    if (!delivery) {
+        return std::nullopt;
+    }
+
+    boost::lock_guard lock(delivery->mutex);
+    return delivery->stats;
+}
+
+std::shared_ptr<EventRegistry::Delivery> EventRegistry::get_delivery(
+    const std::string &event_name, EventDeliveryPolicy *policy
+) const
+{
+    boost::lock_guard lock(event_infos_mutex_);
+
+    auto it = event_infos_.find(event_name);
+    if (it == event_infos_.end()) {
+        return nullptr;
+    }
+
+    if (policy != nullptr) {
+        const auto &schema = std::get<0>(it->second);
+        *policy = schema.delivery_policy;
+        // Without the scheduler there is no later turn to deliver in, keep the rate limit only
+        if (!schema.require_scheduler) {
+            policy->mode = EventDeliveryMode::Immediate;
+        }
+    }
+
+    return std::get<3>(it->second);
+}
+
+void EventRegistry::discard_pending_deliveries(Delivery &delivery)
+{
+    boost::lock_guard lock(delivery.mutex);
+
+    delivery.stats.dropped += delivery.pending.size();
+    delivery.pending.clear();
+    delivery.scheduled = false;
+}
+
 } // namespace esp_brookesia::service
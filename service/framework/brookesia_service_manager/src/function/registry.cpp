@@ -12,7 +12,13 @@
 
 namespace esp_brookesia::service {
 
-bool FunctionRegistry::add(FunctionSchema func_schema, FunctionHandler func_handler)
+FunctionRegistry::~FunctionRegistry()
+{
+    // Handles may outlive the registry, make sure they can no longer reach the handlers
+    remove_all();
+}
+
+bool FunctionRegistry::add(FunctionSchema func_schema, FunctionHandler func_handler, TypedFunctionHandler typed_handler)
 {
     BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
 
@@ -33,7 +39,13 @@ bool FunctionRegistry::add(FunctionSchema func_schema, FunctionHandler func_hand
 
     // Copy the function name because func_schema.name will be moved afterwards
     auto func_name = func_schema.name;
-    functions_[func_name] = std::make_pair(std::move(func_schema), std::move(func_handler));
+    auto entry = std::make_shared<Entry>();
+    entry->registry = this;
+    entry->index = next_index_++;
+    entry->schema = std::move(func_schema);
+    entry->handler = std::move(func_handler);
+    entry->typed_handler = std::move(typed_handler);
+    functions_[func_name] = std::move(entry);
 
     BROOKESIA_LOGD("Register function `%1%`", func_name);
 
@@ -53,6 +65,7 @@ bool FunctionRegistry::remove(const std::string &func_name)
         it != functions_.end(), false, "Function `%1%` not found", func_name
     );
 
+    it->second->is_registered.store(false, std::memory_order_release);
     functions_.erase(it);
 
     BROOKESIA_LOGD("Unregister function `%1%`", func_name);
@@ -65,6 +78,9 @@ bool FunctionRegistry::remove_all()
     BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
 
     boost::lock_guard lock(functions_mutex_);
+    for (auto &[_, entry] : functions_) {
+        entry->is_registered.store(false, std::memory_order_release);
+    }
     functions_.clear();
 
     return true;
@@ -89,34 +105,163 @@ FunctionResult FunctionRegistry::call(const std::string &func_name, FunctionPara
         BROOKESIA_CHECK_FALSE_RETURN(false, error_result, "%1%", error_message);
     }
 
-    auto func_schema = func_it->second.first;
-    auto func_handler = func_it->second.second;
+    // Keep the entry alive instead of copying the schema and handler
+    auto entry = func_it->second;
+
+    // Unlock the mutex to avoid deadlock
+    lock.unlock();
 
     // Validate parameters and fill default values
     FunctionParameterMap validated_parameters = std::move(parameters);
     BROOKESIA_CHECK_FALSE_RETURN(
-        validate_parameters(func_schema, validated_parameters, error_message), error_result, "%1%", error_message
+        validate_parameters(entry->schema, validated_parameters, error_message), error_result, "%1%", error_message
     );
 
-    // Unlock the mutex to avoid deadlock
-    lock.unlock();
-
     // Call the function
-    FunctionResult result = func_handler(std::move(validated_parameters));
+    FunctionResult result = entry->handler(std::move(validated_parameters));
+    BROOKESIA_CHECK_FALSE_RETURN(
+        validate_return_value(entry->schema, result, error_message), error_result, "%1%", error_message
+    );
+
+    return result;
+}
+
+FunctionResult FunctionRegistry::call(const FunctionHandle &handle, std::vector<FunctionValue> parameters_values)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    FunctionResult error_result{
+        .success = false,
+    };
+    auto &error_message = error_result.error_message;
+
+    if (!is_handle_valid(handle)) {
+        error_message = "Invalid function handle";
+        BROOKESIA_CHECK_FALSE_RETURN(false, error_result, "%1%", error_message);
+    }
+
+    // The handle keeps the entry alive, so no lock is needed from here
+    const auto &entry = *handle.entry_;
+
+    FunctionParameterMap parameters;
+    BROOKESIA_CHECK_FALSE_RETURN(
+        validate_parameters(entry.schema, parameters_values, parameters, error_message), error_result, "%1%",
+        error_message
+    );
+
+    FunctionResult result = entry.handler(std::move(parameters));
     BROOKESIA_CHECK_FALSE_RETURN(
-        validate_return_value(func_schema, result, error_message), error_result, "%1%", error_message
+        validate_return_value(entry.schema, result, error_message), error_result, "%1%", error_message
     );
 
     return result;
 }
 
+FunctionResult FunctionRegistry::call(const FunctionHandle &handle, FunctionParameterMap parameters)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    FunctionResult error_result{
+        .success = false,
+    };
+    auto &error_message = error_result.error_message;
+
+    if (!is_handle_valid(handle)) {
+        error_message = "Invalid function handle";
+        BROOKESIA_CHECK_FALSE_RETURN(false, error_result, "%1%", error_message);
+    }
+
+    const auto &entry = *handle.entry_;
+
+    BROOKESIA_CHECK_FALSE_RETURN(
+        validate_parameters(entry.schema, parameters, error_message), error_result, "%1%", error_message
+    );
+
+    FunctionResult result = entry.handler(std::move(parameters));
+    BROOKESIA_CHECK_FALSE_RETURN(
+        validate_return_value(entry.schema, result, error_message), error_result, "%1%", error_message
+    );
+
+    return result;
+}
+
+FunctionResult FunctionRegistry::call(const FunctionHandle &handle, TypedParameters parameters)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    FunctionResult error_result{
+        .success = false,
+    };
+    auto &error_message = error_result.error_message;
+
+    if (!is_handle_valid(handle)) {
+        error_message = "Invalid function handle";
+        BROOKESIA_CHECK_FALSE_RETURN(false, error_result, "%1%", error_message);
+    }
+
+    const auto &entry = *handle.entry_;
+
+    // Default values only exist as `FunctionValue`, so partial calls always take the converting path
+    if (entry.typed_handler && (parameters.size() == entry.schema.parameters.size())) {
+        auto typed_result = entry.typed_handler(parameters);
+        if (typed_result.has_value()) {
+            BROOKESIA_CHECK_FALSE_RETURN(
+                validate_return_value(entry.schema, *typed_result, error_message), error_result, "%1%", error_message
+            );
+            return std::move(*typed_result);
+        }
+        BROOKESIA_LOGD("Typed handler of `%1%` declined the values, fall back to conversion", entry.schema.name);
+    }
+
+    std::vector<FunctionValue> parameters_values;
+    parameters_values.reserve(parameters.size());
+    for (size_t i = 0; i < parameters.size(); i++) {
+        auto value = parameters[i].to_function_value();
+        if (!value.has_value()) {
+            error_message = "Parameter #" + std::to_string(i) + " cannot be converted to a function value";
+            BROOKESIA_CHECK_FALSE_RETURN(false, error_result, "%1%", error_message);
+        }
+        parameters_values.push_back(std::move(*value));
+    }
+
+    return call(handle, std::move(parameters_values));
+}
+
+FunctionHandle FunctionRegistry::get_handle(const std::string &func_name) const
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    boost::lock_guard lock(functions_mutex_);
+
+    auto it = functions_.find(func_name);
+    BROOKESIA_CHECK_FALSE_RETURN(it != functions_.end(), FunctionHandle(), "Function `%1%` not found", func_name);
+
+    return FunctionHandle(it->second);
+}
+
+std::vector<FunctionHandle> FunctionRegistry::get_handles(const std::vector<FunctionCall> &calls) const
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    std::vector<FunctionHandle> handles;
+    handles.reserve(calls.size());
+
+    boost::lock_guard lock(functions_mutex_);
+    for (const auto &call : calls) {
+        auto it = functions_.find(call.name);
+        handles.push_back((it != functions_.end()) ? FunctionHandle(it->second) : FunctionHandle());
+    }
+
+    return handles;
+}
+
 std::vector<FunctionSchema> FunctionRegistry::get_schemas() const
 {
     std::vector<FunctionSchema> definitions;
     boost::lock_guard lock(functions_mutex_);
     definitions.reserve(functions_.size());
-    for (const auto& [func_name, func_schema_handler] : functions_) {
-        definitions.push_back(func_schema_handler.first);
+    for (const auto& [func_name, entry] : functions_) {
+        definitions.push_back(entry->schema);
     }
 
     return definitions;
@@ -126,9 +271,8 @@ boost::json::array FunctionRegistry::get_schemas_json()
 {
     boost::json::array schema;
     boost::lock_guard lock(functions_mutex_);
-    for (const auto& [_, func_schema_handler] : functions_) {
-        const auto &[func_schema, handler] = func_schema_handler;
-        schema.push_back(BROOKESIA_DESCRIBE_TO_JSON(func_schema));
+    for (const auto& [_, entry] : functions_) {
+        schema.push_back(BROOKESIA_DESCRIBE_TO_JSON(entry->schema));
     }
 
     return schema;
@@ -201,6 +345,49 @@ bool FunctionRegistry::validate_parameters(
     return true;
 }
 
+bool FunctionRegistry::validate_parameters(
+    const FunctionSchema &func_schema, std::vector<FunctionValue> &parameters_values,
+    FunctionParameterMap &parameters, std::string &error_msg
+)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    const auto &schema_parameters = func_schema.parameters;
+    if (parameters_values.size() > schema_parameters.size()) {
+        error_msg = "Too many parameters: expected at most " + std::to_string(schema_parameters.size()) +
+                    ", but got " + std::to_string(parameters_values.size());
+    }
+
+    for (size_t i = 0; error_msg.empty() && (i < schema_parameters.size()); i++) {
+        const auto &param = schema_parameters[i];
+        if (i < parameters_values.size()) {
+            if (!param.is_compatible_value(parameters_values[i])) {
+                const auto actual_type = get_function_value_type(parameters_values[i]);
+                error_msg = "Invalid type for parameter `" + param.name +
+                            "`: expected `" + BROOKESIA_DESCRIBE_TO_STR(param.type) +
+                            "`, but got `" + BROOKESIA_DESCRIBE_TO_STR(actual_type) + "`";
+                break;
+            }
+            parameters.emplace(param.name, std::move(parameters_values[i]));
+        } else if (param.is_required()) {
+            error_msg = "Missing required parameter: `" + param.name + "`";
+        } else if (!param.default_value.has_value()) {
+            error_msg = "Optional parameter `" + param.name + "` has no default value";
+        } else {
+            parameters.emplace(param.name, *param.default_value);
+        }
+    }
+
+    if (!error_msg.empty()) {
+#if BROOKESIA_UTILS_LOG_LEVEL <= BROOKESIA_UTILS_LOG_LEVEL_DEBUG
+        BROOKESIA_LOGE("%1%", error_msg);
+#endif
+        return false;
+    }
+
+    return true;
+}
+
 bool FunctionRegistry::validate_return_value(
     const FunctionSchema &func_schema, const FunctionResult &result, std::string &error_msg
 )
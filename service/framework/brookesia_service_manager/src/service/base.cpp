@@ -191,6 +191,123 @@ bool ServiceBase::call_function_async(
     return call_function_async(name, std::move(parameters_map), std::move(handler));
 }
 
+FunctionHandle ServiceBase::get_function_handle(const std::string &name)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    BROOKESIA_LOGD("Params: name(%1%)", name);
+
+    boost::shared_lock lock(resources_mutex_);
+
+    BROOKESIA_CHECK_NULL_RETURN(
+        function_registry_, FunctionHandle(), "[%1%:%2%] function registry is not available", attributes_.name, name
+    );
+
+    return function_registry_->get_handle(name);
+}
+
+bool ServiceBase::call_function_async(
+    const FunctionHandle &handle, std::vector<FunctionValue> parameters_values, FunctionResultHandler handler
+)
+{
+    auto invoker = [handle, parameters_values = std::move(parameters_values)](FunctionRegistry & registry) mutable {
+        return registry.call(handle, std::move(parameters_values));
+    };
+
+    return call_handle_async(handle, std::move(invoker), std::move(handler));
+}
+
+bool ServiceBase::call_function_typed_async(
+    const FunctionHandle &handle, TypedParameters parameters, FunctionResultHandler handler
+)
+{
+    auto invoker = [handle, parameters = std::move(parameters)](FunctionRegistry & registry) mutable {
+        return registry.call(handle, std::move(parameters));
+    };
+
+    return call_handle_async(handle, std::move(invoker), std::move(handler));
+}
+
+bool ServiceBase::call_handle_async(const FunctionHandle &handle, HandleInvoker invoker, FunctionResultHandler handler)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    BROOKESIA_CHECK_FALSE_RETURN(is_initialized(), false, "[%1%] service not initialized", attributes_.name);
+
+    // Thread-safe get the copies of resources
+    std::shared_ptr<FunctionRegistry> registry;
+    std::shared_ptr<lib_utils::TaskScheduler> scheduler;
+    {
+        boost::shared_lock lock(resources_mutex_);
+        registry = function_registry_;
+        scheduler = task_scheduler_;
+    }
+    BROOKESIA_CHECK_FALSE_RETURN(
+        registry && scheduler, false, "[%1%] function registry or task scheduler is not available", attributes_.name
+    );
+    BROOKESIA_CHECK_FALSE_RETURN(
+        registry->is_handle_valid(handle), false, "[%1%] invalid function handle", attributes_.name
+    );
+
+    // The error prefix is only formatted on failure to keep the hot path free of string building
+    const auto &func_name = handle.get_schema()->name;
+    const bool require_scheduler = handle.get_schema()->require_scheduler;
+    auto call_context = get_current_call_context();
+    auto call_function_task =
+        [this, registry, handle, require_scheduler, invoker = std::move(invoker),
+          handler, call_context = std::move(call_context)]() mutable {
+        BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+        boost::shared_lock lock(state_mutex_);
+
+        FunctionResult result;
+        if (is_running() || !require_scheduler)
+        {
+            ScopedCallContext context_guard(call_context);
+            BROOKESIA_CHECK_EXCEPTION_EXECUTE(result = invoker(*registry), {
+                result.success = false;
+                result.error_message = (boost::format("[%1%:%2%] detected exception: %3%") % attributes_.name %
+                handle.get_schema()->name % e.what()).str();
+            }, {});
+        } else
+        {
+            result.success = false;
+            result.error_message = (boost::format("[%1%:%2%] service is not running") % attributes_.name %
+                                    handle.get_schema()->name).str();
+        }
+
+        // Release the shared state lock before invoking the handler, see the name based overload
+        if (lock.owns_lock())
+        {
+            lock.unlock();
+        }
+
+        if (handler)
+        {
+            BROOKESIA_CHECK_EXCEPTION_EXECUTE(handler(std::move(result)), {
+                BROOKESIA_LOGE(
+                    "[%1%:%2%] detected exception when calling handler: %3%", attributes_.name,
+                    handle.get_schema()->name, e.what()
+                );
+            }, {});
+        }
+    };
+
+    if (!require_scheduler) {
+        call_function_task();
+        return true;
+    }
+
+    BROOKESIA_CHECK_FALSE_RETURN(
+        is_running(), false, "[%1%:%2%] service is not running", attributes_.name, func_name
+    );
+
+    auto post_result = scheduler->post(std::move(call_function_task), nullptr, get_call_task_group());
+    BROOKESIA_CHECK_FALSE_RETURN(post_result, false, "[%1%:%2%] failed to post task", attributes_.name, func_name);
+
+    return true;
+}
+
 bool ServiceBase::call_functions_async(std::vector<FunctionCall> calls, FunctionBatchResultHandler handler)
 {
     BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
@@ -203,6 +320,7 @@ bool ServiceBase::call_functions_async(std::vector<FunctionCall> calls, Function
 
     std::shared_ptr<FunctionRegistry> registry;
     std::shared_ptr<lib_utils::TaskScheduler> scheduler;
+    std::vector<FunctionHandle> handles;
     bool require_scheduler = false;
     {
         boost::shared_lock lock(resources_mutex_);
@@ -215,10 +333,12 @@ bool ServiceBase::call_functions_async(std::vector<FunctionCall> calls, Function
         registry = function_registry_;
         scheduler = task_scheduler_;
 
-        for (const auto &call : calls) {
-            auto *func_schema = registry->get_schema(call.name);
+        // Resolve the whole batch at once, the calls then go through the handles without any lookup
+        handles = registry->get_handles(calls);
+        for (size_t i = 0; i < calls.size(); i++) {
+            auto *func_schema = handles[i].get_schema();
             BROOKESIA_CHECK_NULL_RETURN(
-                func_schema, false, "%1%: function '%2%' not found", error_prefix, call.name
+                func_schema, false, "%1%: function '%2%' not found", error_prefix, calls[i].name
             );
             require_scheduler = require_scheduler || func_schema->require_scheduler;
         }
@@ -226,7 +346,7 @@ bool ServiceBase::call_functions_async(std::vector<FunctionCall> calls, Function
 
     auto call_context = get_current_call_context();
     auto call_functions_task =
-        [this, error_prefix, registry, require_scheduler, calls = std::move(calls),
+        [this, error_prefix, registry, require_scheduler, calls = std::move(calls), handles = std::move(handles),
           handler, call_context = std::move(call_context)]() mutable {
         BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
 
@@ -246,13 +366,23 @@ bool ServiceBase::call_functions_async(std::vector<FunctionCall> calls, Function
         } else
         {
             ScopedCallContext context_guard(call_context);
-            on_function_batch_start(calls);
-            lib_utils::FunctionGuard batch_guard([this]() {
-                on_function_batch_end();
+            batch_result.results.reserve(calls.size());
+            function_batch_thread_.store(std::this_thread::get_id(), std::memory_order_release);
+            lib_utils::FunctionGuard batch_thread_guard([this]() {
+                function_batch_thread_.store(std::thread::id(), std::memory_order_release);
+            });
+            // The end hook runs even if the start hook or a call throws, so services always leave batch mode
+            lib_utils::FunctionGuard batch_end_guard([this, &error_prefix, &batch_result]() {
+                BROOKESIA_CHECK_EXCEPTION_EXECUTE(on_function_batch_end(batch_result), {
+                    BROOKESIA_LOGE("%1%: detected exception when ending batch: %2%", error_prefix, e.what());
+                    batch_result.success = false;
+                }, {});
             });
-            for (auto &call : calls) {
+            on_function_batch_start(calls);
+            for (size_t i = 0; i < calls.size(); i++) {
+                auto &call = calls[i];
                 FunctionResult result;
-                BROOKESIA_CHECK_EXCEPTION_EXECUTE(result = registry->call(call.name, std::move(call.parameters)), {
+                BROOKESIA_CHECK_EXCEPTION_EXECUTE(result = registry->call(handles[i], std::move(call.parameters)), {
                     result.success = false;
                     result.error_message =
                     (boost::format("%1%: function '%2%' detected exception: %3%") %
@@ -268,6 +398,12 @@ bool ServiceBase::call_functions_async(std::vector<FunctionCall> calls, Function
             }
         }
 
+        // Same as single calls, the handler must not run under the state lock
+        if (lock.owns_lock())
+        {
+            lock.unlock();
+        }
+
         if (handler)
         {
             BROOKESIA_LOGD("Has handler, calling it");
@@ -291,6 +427,42 @@ bool ServiceBase::call_functions_async(std::vector<FunctionCall> calls, Function
     return true;
 }
 
+lib_utils::CallbackAwaiter<FunctionResult> ServiceBase::co_call_function(
+    const std::string &name, FunctionParameterMap parameters_map
+)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    auto starter = [this, name, parameters_map = std::move(parameters_map)](auto completion) mutable {
+        return call_function_async(name, std::move(parameters_map), [completion](FunctionResult && result) {
+            completion(std::move(result));
+        });
+    };
+    FunctionResult fallback{
+        .error_message = (boost::format("[%1%:%2%] failed to call function") % attributes_.name % name).str(),
+    };
+
+    return lib_utils::CallbackAwaiter<FunctionResult>(std::move(starter), std::move(fallback));
+}
+
+lib_utils::CallbackAwaiter<FunctionResult> ServiceBase::co_call_function(
+    const std::string &name, std::vector<FunctionValue> parameters_values
+)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    auto starter = [this, name, parameters_values = std::move(parameters_values)](auto completion) mutable {
+        return call_function_async(name, std::move(parameters_values), [completion](FunctionResult && result) {
+            completion(std::move(result));
+        });
+    };
+    FunctionResult fallback{
+        .error_message = (boost::format("[%1%:%2%] failed to call function") % attributes_.name % name).str(),
+    };
+
+    return lib_utils::CallbackAwaiter<FunctionResult>(std::move(starter), std::move(fallback));
+}
+
 FunctionResult ServiceBase::call_function_sync(
     const std::string &name, FunctionParameterMap parameters_map, uint32_t timeout_ms
 )
@@ -456,6 +628,116 @@ FunctionResult ServiceBase::call_function_sync(
     return call_function_sync(name, std::move(parameters_map), timeout_ms);
 }
 
+FunctionResult ServiceBase::call_function_sync(
+    const FunctionHandle &handle, std::vector<FunctionValue> parameters_values, uint32_t timeout_ms
+)
+{
+    auto invoker = [handle, parameters_values = std::move(parameters_values)](FunctionRegistry & registry) mutable {
+        return registry.call(handle, std::move(parameters_values));
+    };
+
+    return call_handle_sync(handle, std::move(invoker), timeout_ms);
+}
+
+FunctionResult ServiceBase::call_function_typed_sync(
+    const FunctionHandle &handle, TypedParameters parameters, uint32_t timeout_ms
+)
+{
+    auto invoker = [handle, parameters = std::move(parameters)](FunctionRegistry & registry) mutable {
+        return registry.call(handle, std::move(parameters));
+    };
+
+    return call_handle_sync(handle, std::move(invoker), timeout_ms);
+}
+
+FunctionResult ServiceBase::call_handle_sync(const FunctionHandle &handle, HandleInvoker invoker, uint32_t timeout_ms)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    // Thread-safe get the copies of resources
+    std::shared_ptr<FunctionRegistry> registry;
+    std::shared_ptr<lib_utils::TaskScheduler> scheduler;
+    {
+        boost::shared_lock lock(resources_mutex_);
+        registry = function_registry_;
+        scheduler = task_scheduler_;
+    }
+    BROOKESIA_CHECK_FALSE_RETURN(registry && registry->is_handle_valid(handle), (FunctionResult{
+        .success = false,
+        .error_message = "Invalid function handle",
+    }), "[%1%] invalid function handle", attributes_.name);
+
+    const auto *func_schema = handle.get_schema();
+    const bool require_scheduler = func_schema->require_scheduler;
+
+    // Functions without a scheduler run on the calling thread anyway, and calls already executing through this
+    // service's call strand must not re-enter it, so both are invoked directly without a promise round trip
+    if (!require_scheduler || (scheduler && scheduler->is_current_thread_in_group(get_call_task_group()))) {
+        boost::shared_lock lock(state_mutex_);
+        FunctionResult inline_result;
+        if (is_running() || !require_scheduler) {
+            BROOKESIA_CHECK_EXCEPTION_EXECUTE(
+            inline_result = invoker(*registry), {
+                inline_result.success = false;
+                inline_result.error_message = (boost::format("[%1%:%2%] detected exception: %3%") %
+                attributes_.name % func_schema->name % e.what()).str();
+            }, {});
+        } else {
+            inline_result.success = false;
+            inline_result.error_message =
+                (boost::format("[%1%:%2%] service is not running") % attributes_.name % func_schema->name).str();
+        }
+        return inline_result;
+    }
+
+    uint32_t effective_timeout_ms = timeout_ms;
+    if (effective_timeout_ms == 0) {
+        effective_timeout_ms = func_schema->default_timeout_ms.value_or(
+                                   BROOKESIA_SERVICE_MANAGER_DEFAULT_CALL_FUNCTION_TIMEOUT_MS
+                               );
+    }
+    const bool requires_worker_wait_slot = scheduler && scheduler->is_current_thread_worker();
+    if (requires_worker_wait_slot && !scheduler->try_acquire_worker_wait_slot()) {
+        return FunctionResult{
+            .success = false,
+            .error_message = (boost::format(
+                                  "[%1%:%2%] synchronous cross-group call has no available scheduler worker"
+                              ) % attributes_.name % func_schema->name).str(),
+        };
+    }
+    lib_utils::FunctionGuard wait_slot_guard([scheduler, requires_worker_wait_slot]() {
+        if (requires_worker_wait_slot) {
+            scheduler->release_worker_wait_slot();
+        }
+    });
+
+    using ResultPromise = boost::promise<FunctionResult>;
+    std::shared_ptr<ResultPromise> result_promise;
+    BROOKESIA_CHECK_EXCEPTION_RETURN(result_promise = std::make_shared<ResultPromise>(), (FunctionResult{
+        .success = false,
+        .error_message = "No memory",
+    }), "[%1%:%2%] no memory", attributes_.name, func_schema->name);
+
+    auto result_future = result_promise->get_future();
+    auto result_handler = [result_promise](FunctionResult && result) {
+        result_promise->set_value(std::move(result));
+    };
+
+    auto async_result = call_handle_async(handle, std::move(invoker), std::move(result_handler));
+    BROOKESIA_CHECK_FALSE_RETURN(async_result, (FunctionResult{
+        .success = false,
+        .error_message = "Failed to call function asynchronously",
+    }), "[%1%:%2%] failed to call function asynchronously", attributes_.name, func_schema->name);
+
+    auto wait_result = result_future.wait_for(boost::chrono::milliseconds(effective_timeout_ms));
+    BROOKESIA_CHECK_FALSE_RETURN(wait_result == boost::future_status::ready, (FunctionResult{
+        .success = false,
+        .error_message = "Wait timeout after " + std::to_string(effective_timeout_ms) + " ms",
+    }), "[%1%:%2%] wait timeout", attributes_.name, func_schema->name);
+
+    return result_future.get();
+}
+
 FunctionBatchResult ServiceBase::call_functions_sync(std::vector<FunctionCall> calls, uint32_t timeout_ms)
 {
     BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
@@ -510,10 +792,20 @@ FunctionBatchResult ServiceBase::call_functions_sync(std::vector<FunctionCall> c
 EventRegistry::SignalConnection ServiceBase::subscribe_event(
     const std::string &event_name, const EventRegistry::SignalSlot &slot
 )
+{
+    return subscribe_event(event_name, slot, nullptr);
+}
+
+EventRegistry::SignalConnection ServiceBase::subscribe_event(
+    const std::string &event_name, const EventRegistry::SignalSlot &slot, EventRegistry::EventPredicate predicate
+)
 {
     BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
 
-    BROOKESIA_LOGD("Params: event_name(%1%), slot(%2%)", event_name, BROOKESIA_DESCRIBE_TO_STR(slot));
+    BROOKESIA_LOGD(
+        "Params: event_name(%1%), slot(%2%), filtered(%3%)", event_name, BROOKESIA_DESCRIBE_TO_STR(slot),
+        BROOKESIA_DESCRIBE_TO_STR(predicate != nullptr)
+    );
 
     BROOKESIA_CHECK_FALSE_RETURN(is_initialized(), EventRegistry::SignalConnection(), "Not initialized");
 
@@ -530,12 +822,16 @@ EventRegistry::SignalConnection ServiceBase::subscribe_event(
         return EventRegistry::SignalConnection();
     }
 
-    auto signal = registry->get_signal(event_name);
-    BROOKESIA_CHECK_NULL_RETURN(
-        signal, EventRegistry::SignalConnection(), "%1%: event signal not found", error_prefix
-    );
-
-    auto connection = signal->connect(slot);
+    EventRegistry::SignalConnection connection;
+    if (predicate) {
+        connection = registry->subscribe(event_name, slot, std::move(predicate));
+    } else {
+        auto signal = registry->get_signal(event_name);
+        BROOKESIA_CHECK_NULL_RETURN(
+            signal, EventRegistry::SignalConnection(), "%1%: event signal not found", error_prefix
+        );
+        connection = signal->connect(slot);
+    }
     if (connection.connected()) {
         on_event_subscribed(event_name);
     }
@@ -543,7 +839,9 @@ EventRegistry::SignalConnection ServiceBase::subscribe_event(
     return connection;
 }
 
-bool ServiceBase::register_functions(std::vector<FunctionSchema> schemas, FunctionHandlerMap handlers)
+bool ServiceBase::register_functions(
+    std::vector<FunctionSchema> schemas, FunctionHandlerMap handlers, TypedFunctionHandlerMap typed_handlers
+)
 {
     BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
 
@@ -571,7 +869,14 @@ bool ServiceBase::register_functions(std::vector<FunctionSchema> schemas, Functi
             continue;
         }
 
-        if (!function_registry_->add(std::move(schema), std::move(it->second))) {
+        // Typed handlers are optional, functions without one are served by converting the values
+        TypedFunctionHandler typed_handler;
+        auto typed_it = typed_handlers.find(func_name);
+        if (typed_it != typed_handlers.end()) {
+            typed_handler = std::move(typed_it->second);
+        }
+
+        if (!function_registry_->add(std::move(schema), std::move(it->second), std::move(typed_handler))) {
             BROOKESIA_LOGE("Failed to register function: %1%", func_name);
             continue;
         }
@@ -683,8 +988,9 @@ bool ServiceBase::publish_event(const std::string &event_name, EventItemMap even
 
         auto signal = event_registry_->get_signal(event_name);
         BROOKESIA_CHECK_NULL_RETURN(signal, false, "Event '%1%': signal not found", event_name);
-        if (signal->num_slots() == 0) {
-            BROOKESIA_LOGD("Event '%1%': has no subscribers, skip publish", event_name);
+        // Filtered subscribers are checked here, so unmatched events never reach the task scheduler
+        if (!event_registry_->has_matching_subscribers(event_name, event_items)) {
+            BROOKESIA_LOGD("Event '%1%': has no matching subscribers, skip publish", event_name);
             return true;
         }
 
@@ -701,22 +1007,49 @@ bool ServiceBase::publish_event(const std::string &event_name, EventItemMap even
         registry->validate_items(event_name, event_items), false, "Event '%1%': failed to validate data", event_name
     );
 
-    auto emit_signal_task = [this, registry, require_scheduler, event_name, event_items = std::move(event_items)]() {
+    // Apply the delivery policy, bursts of coalesced or batched events share one scheduled delivery
+    uint32_t delay_ms = 0;
+    auto action = registry->queue_delivery(event_name, event_items, delay_ms);
+    if (action == EventRegistry::DeliveryAction::Dropped) {
+        BROOKESIA_LOGD("Event '%1%': dropped by the rate limit", event_name);
+        return true;
+    } else if (action == EventRegistry::DeliveryAction::Merged) {
+        BROOKESIA_LOGD("Event '%1%': merged into the pending delivery", event_name);
+        return true;
+    }
+    const bool is_queued = (action == EventRegistry::DeliveryAction::Schedule);
+
+    auto emit_signal_task = [this, registry, require_scheduler, is_queued, event_name,
+                             event_items = std::move(event_items)]() {
         BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
 
         boost::shared_lock lock(state_mutex_);
 
-        if (is_running() || !require_scheduler) {
-            auto signal = registry->get_signal(event_name);
-            if (signal) {
-                BROOKESIA_CHECK_EXCEPTION_EXECUTE((*signal)(event_name, event_items), {}, {
-                    BROOKESIA_LOGE("Event '%1%': failed to emit signal", event_name);
-                });
-            } else {
-                BROOKESIA_LOGW("Event '%1%': signal not found", event_name);
+        if (!is_running() && require_scheduler) {
+            BROOKESIA_LOGW("Event '%1%': service is not running, skip emit signal", event_name);
+            if (is_queued) {
+                registry->discard_pending_deliveries(event_name);
+            }
+            return;
+        }
+
+        auto signal = registry->get_signal(event_name);
+        if (!signal) {
+            BROOKESIA_LOGW("Event '%1%': signal not found", event_name);
+            return;
+        }
+        auto emit_signal = [&](const EventItemMap & items) {
+            BROOKESIA_CHECK_EXCEPTION_EXECUTE((*signal)(event_name, items), {}, {
+                BROOKESIA_LOGE("Event '%1%': failed to emit signal", event_name);
+            });
+        };
+
+        if (is_queued) {
+            for (const auto &items : registry->take_pending_deliveries(event_name)) {
+                emit_signal(items);
             }
         } else {
-            BROOKESIA_LOGW("Event '%1%': service is not running, skip emit signal", event_name);
+            emit_signal(event_items);
         }
     };
 
@@ -728,19 +1061,29 @@ bool ServiceBase::publish_event(const std::string &event_name, EventItemMap even
     }
 
     // Check if the service is running, otherwise the scheduler will not be able to post the task
-    BROOKESIA_CHECK_FALSE_RETURN(is_running(), false, "Event '%1%': service is not running", event_name);
+    if (!is_running()) {
+        if (is_queued) {
+            registry->discard_pending_deliveries(event_name);
+        }
+        BROOKESIA_LOGE("Event '%1%': service is not running", event_name);
+        return false;
+    }
 
     // Post the emit signal task to the task scheduler
-    if (use_dispatch) {
-        BROOKESIA_CHECK_FALSE_RETURN(
-            scheduler->dispatch(emit_signal_task, nullptr, get_event_task_group()), false,
-            "Event '%1%': failed to dispatch emit signal task", event_name
-        );
+    bool posted = false;
+    if (is_queued && (delay_ms > 0)) {
+        posted = scheduler->post_delayed(emit_signal_task, static_cast<int>(delay_ms), nullptr, get_event_task_group());
+    } else if (use_dispatch) {
+        posted = scheduler->dispatch(emit_signal_task, nullptr, get_event_task_group());
     } else {
-        BROOKESIA_CHECK_FALSE_RETURN(
-            scheduler->post(emit_signal_task, nullptr, get_event_task_group()), false,
-            "Event '%1%': failed to post emit signal task", event_name
-        );
+        posted = scheduler->post(emit_signal_task, nullptr, get_event_task_group());
+    }
+    if (!posted) {
+        if (is_queued) {
+            registry->discard_pending_deliveries(event_name);
+        }
+        BROOKESIA_LOGE("Event '%1%': failed to schedule emit signal task", event_name);
+        return false;
     }
 
     return true;
@@ -863,8 +1206,11 @@ bool ServiceBase::init_internal(std::shared_ptr<lib_utils::TaskScheduler> task_s
     // Register service-specific functions. Version metadata is queried through the built-in Manager service.
     auto function_schemas = get_function_schemas();
     auto function_handlers = get_function_handlers();
+    auto typed_function_handlers = get_typed_function_handlers();
     BROOKESIA_CHECK_FALSE_RETURN(
-        register_functions(std::move(function_schemas), std::move(function_handlers)), false,
+        register_functions(
+            std::move(function_schemas), std::move(function_handlers), std::move(typed_function_handlers)
+        ), false,
         "Failed to register functions"
     );
 
@@ -1022,11 +1368,13 @@ void ServiceBase::stop_internal(boost::unique_lock<boost::shared_mutex> *state_l
     // Acquire write lock to prevent concurrent execution with call_function_task
     // This ensures on_stop() can safely clean up resources without race conditions
     std::shared_ptr<lib_utils::TaskScheduler> task_scheduler;
+    std::shared_ptr<EventRegistry> event_registry;
     {
         boost::lock_guard lock(resources_mutex_);
 
         // Get copies of resources under lock
         task_scheduler = task_scheduler_;
+        event_registry = event_registry_;
     }
 
     // Mark the service as stopped now so any pending publish_event::emit_signal_task
@@ -1056,6 +1404,11 @@ void ServiceBase::stop_internal(boost::unique_lock<boost::shared_mutex> *state_l
         }
     }
 
+    // The cancelled delivery tasks will not run, let the next start schedule new ones
+    if (event_registry) {
+        event_registry->discard_pending_deliveries();
+    }
+
     BROOKESIA_LOGI("Stopped service: %1%", attributes_.name);
 }
 
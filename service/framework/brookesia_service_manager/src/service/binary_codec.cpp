@@ -0,0 +1,644 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "brookesia/service_manager/macro_configs.h"
+#if !BROOKESIA_SERVICE_MANAGER_SERVICE_ENABLE_DEBUG_LOG
+#   define BROOKESIA_LOG_DISABLE_DEBUG_TRACE 1
+#endif
+#include "private/utils.hpp"
+#include "brookesia/service_manager/binary_codec.hpp"
+
+namespace esp_brookesia::service {
+
+namespace {
+
+enum MajorType : uint8_t {
+    MajorUnsigned = 0,
+    MajorNegative = 1,
+    MajorBytes = 2,
+    MajorText = 3,
+    MajorArray = 4,
+    MajorMap = 5,
+    MajorTag = 6,
+    MajorSimple = 7,
+};
+
+constexpr uint8_t SIMPLE_FALSE = 20;
+constexpr uint8_t SIMPLE_TRUE = 21;
+constexpr uint8_t SIMPLE_NULL = 22;
+constexpr uint8_t ADDITIONAL_FLOAT16 = 25;
+constexpr uint8_t ADDITIONAL_FLOAT32 = 26;
+constexpr uint8_t ADDITIONAL_FLOAT64 = 27;
+
+// Bounds the recursion on untrusted input
+constexpr int MAX_NESTING_DEPTH = 32;
+// Largest magnitude below which every integer is exactly representable as a double
+constexpr double MAX_EXACT_INTEGER = 9007199254740992.0;
+
+constexpr std::string_view RESULT_KEY_SUCCESS = "success";
+constexpr std::string_view RESULT_KEY_ERROR_MESSAGE = "error_message";
+constexpr std::string_view RESULT_KEY_DATA = "data";
+
+class Writer {
+public:
+    explicit Writer(std::vector<uint8_t> &buffer)
+        : buffer_(buffer)
+    {
+        buffer_.clear();
+    }
+
+    void write_head(uint8_t major, uint64_t value)
+    {
+        const uint8_t type = static_cast<uint8_t>(major << 5);
+        if (value < 24) {
+            buffer_.push_back(type | static_cast<uint8_t>(value));
+        } else if (value <= std::numeric_limits<uint8_t>::max()) {
+            buffer_.push_back(type | 24);
+            write_be(value, 1);
+        } else if (value <= std::numeric_limits<uint16_t>::max()) {
+            buffer_.push_back(type | 25);
+            write_be(value, 2);
+        } else if (value <= std::numeric_limits<uint32_t>::max()) {
+            buffer_.push_back(type | 26);
+            write_be(value, 4);
+        } else {
+            buffer_.push_back(type | 27);
+            write_be(value, 8);
+        }
+    }
+
+    void write_bool(bool value)
+    {
+        buffer_.push_back((MajorSimple << 5) | (value ? SIMPLE_TRUE : SIMPLE_FALSE));
+    }
+
+    void write_null()
+    {
+        buffer_.push_back((MajorSimple << 5) | SIMPLE_NULL);
+    }
+
+    void write_int(int64_t value)
+    {
+        if (value >= 0) {
+            write_head(MajorUnsigned, static_cast<uint64_t>(value));
+        } else {
+            // -1 - n without overflowing on INT64_MIN
+            write_head(MajorNegative, ~static_cast<uint64_t>(value));
+        }
+    }
+
+    void write_float64(double value)
+    {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        buffer_.push_back((MajorSimple << 5) | ADDITIONAL_FLOAT64);
+        write_be(bits, 8);
+    }
+
+    void write_number(double value)
+    {
+        // Integral values are much shorter as integers, e.g. ids, sizes and enum values
+        if ((std::trunc(value) == value) && (std::fabs(value) < MAX_EXACT_INTEGER)) {
+            write_int(static_cast<int64_t>(value));
+        } else {
+            write_float64(value);
+        }
+    }
+
+    void write_text(std::string_view text)
+    {
+        write_head(MajorText, text.size());
+        buffer_.insert(buffer_.end(), text.begin(), text.end());
+    }
+
+    void write_bytes(const uint8_t *data, size_t size)
+    {
+        write_head(MajorBytes, size);
+        if (size > 0) {
+            buffer_.insert(buffer_.end(), data, data + size);
+        }
+    }
+
+private:
+    void write_be(uint64_t value, int bytes)
+    {
+        for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8) {
+            buffer_.push_back(static_cast<uint8_t>(value >> shift));
+        }
+    }
+
+    std::vector<uint8_t> &buffer_;
+};
+
+class Reader {
+public:
+    Reader(const uint8_t *data, size_t size)
+        : data_(data)
+        , size_(size)
+    {
+    }
+
+    bool is_end() const
+    {
+        return offset_ == size_;
+    }
+
+    bool peek_major(uint8_t &major) const
+    {
+        if (offset_ >= size_) {
+            return false;
+        }
+        major = data_[offset_] >> 5;
+        return true;
+    }
+
+    bool read_head(uint8_t &major, uint8_t &additional, uint64_t &value)
+    {
+        if (offset_ >= size_) {
+            return false;
+        }
+        const uint8_t initial = data_[offset_++];
+        major = initial >> 5;
+        additional = initial & 0x1f;
+        if (additional < 24) {
+            value = additional;
+            return true;
+        }
+        // Indefinite lengths (31) and reserved values are never produced by the encoder
+        static constexpr int ARGUMENT_BYTES[] = {1, 2, 4, 8};
+        if (additional > 27) {
+            return false;
+        }
+        return read_be(ARGUMENT_BYTES[additional - 24], value);
+    }
+
+    bool read_expected_head(uint8_t expected_major, uint64_t &value)
+    {
+        uint8_t major = 0;
+        uint8_t additional = 0;
+        if (!read_head(major, additional, value)) {
+            return false;
+        }
+        return major == expected_major;
+    }
+
+    bool read_text(uint64_t length, std::string &text)
+    {
+        if (length > remaining()) {
+            return false;
+        }
+        text.assign(reinterpret_cast<const char *>(data_ + offset_), static_cast<size_t>(length));
+        offset_ += static_cast<size_t>(length);
+        return true;
+    }
+
+    bool read_text(std::string &text)
+    {
+        uint64_t length = 0;
+        return read_expected_head(MajorText, length) && read_text(length, text);
+    }
+
+    bool read_bytes(uint64_t length, const uint8_t *&bytes)
+    {
+        if (length > remaining()) {
+            return false;
+        }
+        bytes = data_ + offset_;
+        offset_ += static_cast<size_t>(length);
+        return true;
+    }
+
+    // Every container element takes at least one byte, larger counts are malformed
+    bool is_count_plausible(uint64_t count) const
+    {
+        return count <= remaining();
+    }
+
+private:
+    size_t remaining() const
+    {
+        return size_ - offset_;
+    }
+
+    bool read_be(int bytes, uint64_t &value)
+    {
+        if (static_cast<size_t>(bytes) > remaining()) {
+            return false;
+        }
+        value = 0;
+        for (int i = 0; i < bytes; i++) {
+            value = (value << 8) | data_[offset_++];
+        }
+        return true;
+    }
+
+    const uint8_t *data_;
+    size_t size_;
+    size_t offset_ = 0;
+};
+
+double decode_float16(uint16_t half)
+{
+    const int exponent = (half >> 10) & 0x1f;
+    const int mantissa = half & 0x3ff;
+    double value = 0;
+    if (exponent == 0) {
+        value = std::ldexp(mantissa, -24);
+    } else if (exponent != 31) {
+        value = std::ldexp(mantissa + 1024, exponent - 25);
+    } else {
+        value = (mantissa == 0) ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+    }
+    return (half & 0x8000) ? -value : value;
+}
+
+bool decode_float(uint8_t additional, uint64_t bits, double &value)
+{
+    if (additional == ADDITIONAL_FLOAT64) {
+        std::memcpy(&value, &bits, sizeof(value));
+    } else if (additional == ADDITIONAL_FLOAT32) {
+        const auto bits32 = static_cast<uint32_t>(bits);
+        float value32 = 0;
+        std::memcpy(&value32, &bits32, sizeof(value32));
+        value = value32;
+    } else if (additional == ADDITIONAL_FLOAT16) {
+        value = decode_float16(static_cast<uint16_t>(bits));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool encode_json(Writer &writer, const boost::json::value &value, int depth);
+
+bool encode_json_object(Writer &writer, const boost::json::object &object, int depth)
+{
+    if (depth > MAX_NESTING_DEPTH) {
+        return false;
+    }
+    writer.write_head(MajorMap, object.size());
+    for (const auto &entry : object) {
+        writer.write_text(std::string_view(entry.key().data(), entry.key().size()));
+        if (!encode_json(writer, entry.value(), depth + 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool encode_json_array(Writer &writer, const boost::json::array &array, int depth)
+{
+    if (depth > MAX_NESTING_DEPTH) {
+        return false;
+    }
+    writer.write_head(MajorArray, array.size());
+    for (const auto &element : array) {
+        if (!encode_json(writer, element, depth + 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool encode_json(Writer &writer, const boost::json::value &value, int depth)
+{
+    switch (value.kind()) {
+    case boost::json::kind::null:
+        writer.write_null();
+        return true;
+    case boost::json::kind::bool_:
+        writer.write_bool(value.get_bool());
+        return true;
+    case boost::json::kind::int64:
+        writer.write_int(value.get_int64());
+        return true;
+    case boost::json::kind::uint64:
+        writer.write_head(MajorUnsigned, value.get_uint64());
+        return true;
+    case boost::json::kind::double_:
+        // Not compacted, a JSON double must not come back as an integer
+        writer.write_float64(value.get_double());
+        return true;
+    case boost::json::kind::string:
+        writer.write_text(std::string_view(value.get_string().data(), value.get_string().size()));
+        return true;
+    case boost::json::kind::array:
+        return encode_json_array(writer, value.get_array(), depth);
+    case boost::json::kind::object:
+        return encode_json_object(writer, value.get_object(), depth);
+    default:
+        return false;
+    }
+}
+
+bool decode_json(Reader &reader, boost::json::value &value, int depth)
+{
+    if (depth > MAX_NESTING_DEPTH) {
+        return false;
+    }
+
+    uint8_t major = 0;
+    uint8_t additional = 0;
+    uint64_t argument = 0;
+    if (!reader.read_head(major, additional, argument)) {
+        return false;
+    }
+
+    switch (major) {
+    case MajorUnsigned:
+        if (argument <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+            value = static_cast<int64_t>(argument);
+        } else {
+            value = argument;
+        }
+        return true;
+    case MajorNegative:
+        if (argument > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+            return false;
+        }
+        value = -1 - static_cast<int64_t>(argument);
+        return true;
+    case MajorText: {
+        std::string text;
+        if (!reader.read_text(argument, text)) {
+            return false;
+        }
+        value = boost::json::string(text);
+        return true;
+    }
+    case MajorArray: {
+        if (!reader.is_count_plausible(argument)) {
+            return false;
+        }
+        boost::json::array array;
+        array.reserve(static_cast<size_t>(argument));
+        for (uint64_t i = 0; i < argument; i++) {
+            boost::json::value element;
+            if (!decode_json(reader, element, depth + 1)) {
+                return false;
+            }
+            array.push_back(std::move(element));
+        }
+        value = std::move(array);
+        return true;
+    }
+    case MajorMap: {
+        if (!reader.is_count_plausible(argument)) {
+            return false;
+        }
+        boost::json::object object;
+        object.reserve(static_cast<size_t>(argument));
+        for (uint64_t i = 0; i < argument; i++) {
+            std::string key;
+            boost::json::value element;
+            if (!reader.read_text(key) || !decode_json(reader, element, depth + 1)) {
+                return false;
+            }
+            object[key] = std::move(element);
+        }
+        value = std::move(object);
+        return true;
+    }
+    case MajorSimple:
+        if (additional == SIMPLE_FALSE) {
+            value = false;
+        } else if (additional == SIMPLE_TRUE) {
+            value = true;
+        } else if (additional == SIMPLE_NULL) {
+            value = nullptr;
+        } else {
+            double number = 0;
+            if (!decode_float(additional, argument, number)) {
+                return false;
+            }
+            value = number;
+        }
+        return true;
+    default:
+        // Byte strings and tags have no JSON equivalent
+        return false;
+    }
+}
+
+// Encodes the alternatives shared by `FunctionValue` and `EventItem`
+template <typename VariantType>
+bool encode_value(Writer &writer, const VariantType &value)
+{
+    return std::visit([&writer](const auto & alternative) {
+        using Type = std::decay_t<decltype(alternative)>;
+        if constexpr (std::is_same_v<Type, bool>) {
+            writer.write_bool(alternative);
+        } else if constexpr (std::is_same_v<Type, double>) {
+            writer.write_number(alternative);
+        } else if constexpr (std::is_same_v<Type, std::string>) {
+            writer.write_text(alternative);
+        } else if constexpr (std::is_same_v<Type, boost::json::object>) {
+            return encode_json_object(writer, alternative, 0);
+        } else if constexpr (std::is_same_v<Type, boost::json::array>) {
+            return encode_json_array(writer, alternative, 0);
+        } else if constexpr (std::is_same_v<Type, RawBuffer>) {
+            BROOKESIA_CHECK_FALSE_RETURN(
+                (alternative.data_size > 0) || (alternative.data_ptr == nullptr), false,
+                "RawBuffer storing its value in the pointer cannot be encoded"
+            );
+            writer.write_bytes(alternative.data_ptr, alternative.data_size);
+        }
+        return true;
+    }, static_cast<const typename VariantType::Base &>(value));
+}
+
+template <typename VariantType>
+bool decode_value(Reader &reader, VariantType &value)
+{
+    uint8_t major = 0;
+    if (!reader.peek_major(major)) {
+        return false;
+    }
+
+    if ((major == MajorMap) || (major == MajorArray)) {
+        boost::json::value json;
+        if (!decode_json(reader, json, 0)) {
+            return false;
+        }
+        if (json.is_object()) {
+            value = std::move(json.get_object());
+        } else {
+            value = std::move(json.get_array());
+        }
+        return true;
+    }
+
+    uint8_t additional = 0;
+    uint64_t argument = 0;
+    if (!reader.read_head(major, additional, argument)) {
+        return false;
+    }
+    switch (major) {
+    case MajorUnsigned:
+        value = static_cast<double>(argument);
+        return true;
+    case MajorNegative:
+        value = -1.0 - static_cast<double>(argument);
+        return true;
+    case MajorText: {
+        std::string text;
+        if (!reader.read_text(argument, text)) {
+            return false;
+        }
+        value = std::move(text);
+        return true;
+    }
+    case MajorBytes: {
+        const uint8_t *bytes = nullptr;
+        if (!reader.read_bytes(argument, bytes)) {
+            return false;
+        }
+        auto buffer = RawBuffer::allocate(static_cast<size_t>(argument));
+        BROOKESIA_CHECK_FALSE_RETURN(
+            (argument == 0) || buffer.is_shared(), false, "Failed to allocate %1% bytes", argument
+        );
+        if (argument > 0) {
+            std::memcpy(buffer.to_ptr<uint8_t>(), bytes, static_cast<size_t>(argument));
+        }
+        value = std::move(buffer);
+        return true;
+    }
+    case MajorSimple:
+        if ((additional == SIMPLE_FALSE) || (additional == SIMPLE_TRUE)) {
+            value = (additional == SIMPLE_TRUE);
+            return true;
+        } else {
+            double number = 0;
+            if (!decode_float(additional, argument, number)) {
+                return false;
+            }
+            value = number;
+            return true;
+        }
+    default:
+        return false;
+    }
+}
+
+template <typename MapType>
+bool encode_map(const MapType &map, std::vector<uint8_t> &buffer)
+{
+    Writer writer(buffer);
+    writer.write_head(MajorMap, map.size());
+    for (const auto &[name, value] : map) {
+        writer.write_text(name);
+        BROOKESIA_CHECK_FALSE_RETURN(encode_value(writer, value), false, "Failed to encode value: `%1%`", name);
+    }
+    return true;
+}
+
+template <typename MapType>
+bool decode_map(const uint8_t *data, size_t size, MapType &map)
+{
+    BROOKESIA_CHECK_FALSE_RETURN((data != nullptr) || (size == 0), false, "Invalid data");
+
+    map.clear();
+
+    Reader reader(data, size);
+    uint64_t count = 0;
+    BROOKESIA_CHECK_FALSE_RETURN(
+        reader.read_expected_head(MajorMap, count) && reader.is_count_plausible(count), false, "Invalid map header"
+    );
+    for (uint64_t i = 0; i < count; i++) {
+        std::string name;
+        typename MapType::mapped_type value;
+        BROOKESIA_CHECK_FALSE_RETURN(
+            reader.read_text(name) && decode_value(reader, value), false, "Invalid map entry #%1%", i
+        );
+        map.insert_or_assign(std::move(name), std::move(value));
+    }
+    BROOKESIA_CHECK_FALSE_RETURN(reader.is_end(), false, "Trailing bytes after the map");
+
+    return true;
+}
+
+} // namespace
+
+bool encode_binary(const FunctionParameterMap &parameters, std::vector<uint8_t> &buffer)
+{
+    return encode_map(parameters, buffer);
+}
+
+bool encode_binary(const FunctionResult &result, std::vector<uint8_t> &buffer)
+{
+    Writer writer(buffer);
+    writer.write_head(MajorMap, result.has_data() ? 3 : 2);
+    writer.write_text(RESULT_KEY_SUCCESS);
+    writer.write_bool(result.success);
+    writer.write_text(RESULT_KEY_ERROR_MESSAGE);
+    writer.write_text(result.error_message);
+    if (result.has_data()) {
+        writer.write_text(RESULT_KEY_DATA);
+        BROOKESIA_CHECK_FALSE_RETURN(encode_value(writer, result.data.value()), false, "Failed to encode data");
+    }
+    return true;
+}
+
+bool encode_binary(const EventItemMap &event_items, std::vector<uint8_t> &buffer)
+{
+    return encode_map(event_items, buffer);
+}
+
+bool decode_binary(const uint8_t *data, size_t size, FunctionParameterMap &parameters)
+{
+    return decode_map(data, size, parameters);
+}
+
+bool decode_binary(const uint8_t *data, size_t size, FunctionResult &result)
+{
+    BROOKESIA_CHECK_FALSE_RETURN((data != nullptr) || (size == 0), false, "Invalid data");
+
+    result = FunctionResult{};
+
+    Reader reader(data, size);
+    uint64_t count = 0;
+    BROOKESIA_CHECK_FALSE_RETURN(
+        reader.read_expected_head(MajorMap, count) && reader.is_count_plausible(count), false, "Invalid result header"
+    );
+    bool has_success = false;
+    for (uint64_t i = 0; i < count; i++) {
+        std::string key;
+        BROOKESIA_CHECK_FALSE_RETURN(reader.read_text(key), false, "Invalid result key #%1%", i);
+        if (key == RESULT_KEY_SUCCESS) {
+            FunctionValue success;
+            BROOKESIA_CHECK_FALSE_RETURN(
+                decode_value(reader, success) && std::holds_alternative<bool>(success), false, "Invalid `success`"
+            );
+            result.success = std::get<bool>(success);
+            has_success = true;
+        } else if (key == RESULT_KEY_ERROR_MESSAGE) {
+            BROOKESIA_CHECK_FALSE_RETURN(reader.read_text(result.error_message), false, "Invalid `error_message`");
+        } else if (key == RESULT_KEY_DATA) {
+            FunctionValue value;
+            BROOKESIA_CHECK_FALSE_RETURN(decode_value(reader, value), false, "Invalid `data`");
+            result.data = std::move(value);
+        } else {
+            BROOKESIA_LOGE("Unknown result key: `%1%`", key);
+            return false;
+        }
+    }
+    BROOKESIA_CHECK_FALSE_RETURN(has_success, false, "Missing `success`");
+    BROOKESIA_CHECK_FALSE_RETURN(reader.is_end(), false, "Trailing bytes after the result");
+
+    return true;
+}
+
+bool decode_binary(const uint8_t *data, size_t size, EventItemMap &event_items)
+{
+    return decode_map(data, size, event_items);
+}
+
+} // namespace esp_brookesia::service
@@ -3,7 +3,9 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <algorithm>
 #include <exception>
+#include <thread>
 #include "brookesia/service_manager/macro_configs.h"
 #if !BROOKESIA_SERVICE_MANAGER_SERVICE_ENABLE_DEBUG_LOG
 #   define BROOKESIA_LOG_DISABLE_DEBUG_TRACE 1
@@ -88,6 +90,8 @@ bool ServiceManager::init_internal()
         BROOKESIA_SERVICE_MANAGER_VER_MAJOR, BROOKESIA_SERVICE_MANAGER_VER_MINOR, BROOKESIA_SERVICE_MANAGER_VER_PATCH
     );
 
+    init_time_ = std::chrono::steady_clock::now();
+
     BROOKESIA_CHECK_EXCEPTION_RETURN(
         task_scheduler_ = std::make_shared<lib_utils::TaskScheduler>(), false, "Failed to create task scheduler"
     );
@@ -199,13 +203,19 @@ bool ServiceManager::start(const lib_utils::TaskScheduler::StartConfig &config)
 
     is_running_.store(true);
 
-    manager_binding_ = bind(ManagerService::get_name().data());
+    // The built-in services are started along the dependency graph instead of one after another
+    auto builtin_bindings = bind_parallel({
+        std::string(ManagerService::get_name()),
+        std::string(UtilsService::get_name()),
+    });
+    manager_binding_ = std::move(builtin_bindings[0]);
+    utils_binding_ = std::move(builtin_bindings[1]);
     if (!manager_binding_.is_valid()) {
+        utils_binding_.release();
         is_running_.store(false);
         BROOKESIA_LOGE("Failed to start the built-in Manager service");
         return false;
     }
-    utils_binding_ = bind(UtilsService::get_name().data());
     if (!utils_binding_.is_valid()) {
         manager_binding_.release();
         is_running_.store(false);
@@ -310,6 +320,7 @@ bool ServiceManager::add_service(std::shared_ptr<ServiceBase> service)
             info.service = service;
             info.state = ServiceState::Stopped;
             service_init_order_.push_back(name);
+            service_generation_.fetch_add(1, std::memory_order_release);
         }
     }
 
@@ -379,7 +390,9 @@ bool ServiceManager::remove_service(const std::string &name)
 
     {
         boost::lock_guard lock(service_mutex_);
-        services_.erase(name);
+        if (services_.erase(name) > 0) {
+            service_generation_.fetch_add(1, std::memory_order_release);
+        }
         service_init_order_.remove(name);
     }
 
@@ -457,7 +470,9 @@ ServiceBinding ServiceManager::bind(const std::string &name)
         // Release lock before calling start() to avoid blocking other operations
         lock.unlock();
 
+        auto start_us = get_boot_elapsed_us();
         bool start_success = service_to_start->start();
+        auto finish_us = get_boot_elapsed_us();
 
         // Re-acquire lock to update state
         lock.lock();
@@ -477,6 +492,12 @@ ServiceBinding ServiceManager::bind(const std::string &name)
 
         // Re-get service info reference after re-acquiring lock
         auto &service_info_after = service_it->second;
+        service_info_after.start_record = ServiceStartRecord{
+            .name = name,
+            .start_us = start_us,
+            .finish_us = finish_us,
+            .success = start_success,
+        };
 
         if (!start_success) {
             // Start failed, decrement ref_count and reset state
@@ -522,6 +543,190 @@ ServiceBinding ServiceManager::bind(const std::string &name)
     return ServiceBinding(unbind_callback, std::move(bound_service), std::move(dependency_bindings));
 }
 
+std::vector<ServiceBinding> ServiceManager::bind_parallel(const std::vector<std::string> &names)
+{
+    return bind_parallel(names, make_default_parallel_bind_config());
+}
+
+std::vector<ServiceBinding> ServiceManager::bind_parallel(
+    const std::vector<std::string> &names, const ParallelBindConfig &config
+)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    BROOKESIA_LOGD("Params: names(%1%), config(%2%)", BROOKESIA_DESCRIBE_TO_STR(names), BROOKESIA_DESCRIBE_TO_STR(config));
+
+    std::vector<ServiceBinding> result(names.size());
+    BROOKESIA_CHECK_FALSE_RETURN(is_initialized(), result, "Not initialized");
+
+    // Startup graph of the requested services and their dependencies
+    struct Node {
+        std::vector<std::string> dependencies;
+        std::vector<std::string> dependents;
+        size_t pending_dependencies = 0;
+        bool is_found = false;
+        bool is_failed = false;
+        ServiceBinding binding;
+    };
+    std::map<std::string, Node> nodes;
+    {
+        boost::shared_lock lock(service_mutex_);
+        std::vector<std::string> unvisited(names.begin(), names.end());
+        while (!unvisited.empty()) {
+            auto name = std::move(unvisited.back());
+            unvisited.pop_back();
+            auto [node_it, inserted] = nodes.try_emplace(name);
+            if (!inserted) {
+                continue;
+            }
+            auto service_it = services_.find(name);
+            if ((service_it == services_.end()) || (service_it->second.service == nullptr)) {
+                continue;
+            }
+            node_it->second.is_found = true;
+            node_it->second.dependencies = service_it->second.service->get_attributes().dependencies;
+            unvisited.insert(
+                unvisited.end(), node_it->second.dependencies.begin(), node_it->second.dependencies.end()
+            );
+        }
+    }
+
+    std::vector<std::string> ready;
+    for (auto &[name, node] : nodes) {
+        for (const auto &dependency : node.dependencies) {
+            nodes[dependency].dependents.push_back(name);
+        }
+        node.pending_dependencies = node.dependencies.size();
+    }
+    for (const auto &[name, node] : nodes) {
+        if (node.pending_dependencies == 0) {
+            ready.push_back(name);
+        }
+    }
+
+    // Services are started by dedicated threads rather than the task schedulers, since `on_start()` may block on
+    // synchronous calls which need the scheduler workers to make progress
+    boost::mutex graph_mutex;
+    boost::condition_variable graph_cv;
+    size_t remaining = nodes.size();
+    size_t starting = 0;
+    auto run_startup = [&]() {
+        boost::unique_lock lock(graph_mutex);
+        while (true) {
+            graph_cv.wait(lock, [&]() {
+                return !ready.empty() || (remaining == 0) || (starting == 0);
+            });
+            if (ready.empty()) {
+                // Nothing left, or nothing can become ready anymore because of a dependency cycle
+                graph_cv.notify_all();
+                return;
+            }
+
+            auto name = std::move(ready.back());
+            ready.pop_back();
+            auto &node = nodes[name];
+            starting++;
+
+            bool can_start = node.is_found;
+            for (const auto &dependency : node.dependencies) {
+                can_start = can_start && !nodes[dependency].is_failed;
+            }
+            if (can_start) {
+                lock.unlock();
+                // The dependencies are already running, so this only starts the service itself
+                auto binding = bind(name);
+                lock.lock();
+                node.is_failed = !binding.is_valid();
+                node.binding = std::move(binding);
+            } else {
+                BROOKESIA_LOGE("Skip starting service %1%: service or dependency is not available", name);
+                node.is_failed = true;
+            }
+
+            for (const auto &dependent : node.dependents) {
+                if (--nodes[dependent].pending_dependencies == 0) {
+                    ready.push_back(dependent);
+                }
+            }
+            starting--;
+            remaining--;
+            graph_cv.notify_all();
+        }
+    };
+
+    auto start_time = std::chrono::steady_clock::now();
+    auto thread_count = std::clamp<size_t>(config.max_concurrency, 1, std::max<size_t>(nodes.size(), 1));
+    std::vector<std::thread> threads;
+    {
+        lib_utils::ThreadConfigGuard thread_config_guard(config.thread_config);
+        for (size_t i = 0; i < thread_count; i++) {
+            bool is_created = true;
+            BROOKESIA_CHECK_EXCEPTION_EXECUTE(threads.emplace_back(run_startup), {
+                BROOKESIA_LOGE("Failed to create startup thread %1%: %2%", i, e.what());
+                is_created = false;
+            }, {});
+            if (!is_created) {
+                break;
+            }
+        }
+    }
+    if (threads.empty()) {
+        BROOKESIA_LOGW("No startup thread available, starting services on the calling thread");
+        run_startup();
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    if (remaining > 0) {
+        BROOKESIA_LOGE("Circular dependency detected, %1% services are not started", remaining);
+    }
+
+    // Dependencies which were not requested are kept running by the bindings of their dependents
+    for (size_t i = 0; i < names.size(); i++) {
+        auto &node = nodes[names[i]];
+        if (node.binding.is_valid()) {
+            result[i] = std::move(node.binding);
+        } else if (!node.is_failed && node.is_found && (remaining == 0)) {
+            // Requested more than once
+            result[i] = bind(names[i]);
+        }
+    }
+
+    BROOKESIA_LOGI(
+        "Parallel bind of %1% services finished in %2% ms", nodes.size(),
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count()
+    );
+
+    return result;
+}
+
+std::vector<ServiceManager::ServiceStartRecord> ServiceManager::get_boot_timeline() const
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    std::vector<ServiceStartRecord> timeline;
+    {
+        boost::shared_lock lock(service_mutex_);
+        for (const auto &[name, runtime_info] : services_) {
+            if (runtime_info.start_record.has_value()) {
+                timeline.push_back(runtime_info.start_record.value());
+            }
+        }
+    }
+    std::sort(timeline.begin(), timeline.end(), [](const auto & lhs, const auto & rhs) {
+        return lhs.start_us < rhs.start_us;
+    });
+
+    return timeline;
+}
+
+uint64_t ServiceManager::get_boot_elapsed_us() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - init_time_
+           ).count();
+}
+
 void ServiceManager::unbind(const std::string &name)
 {
     BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
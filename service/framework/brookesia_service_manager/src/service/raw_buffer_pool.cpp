@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <new>
+#include <utility>
+#include "boost/thread/lock_guard.hpp"
+#include "brookesia/service_manager/macro_configs.h"
+#if !BROOKESIA_SERVICE_MANAGER_SERVICE_ENABLE_DEBUG_LOG
+#   define BROOKESIA_LOG_DISABLE_DEBUG_TRACE 1
+#endif
+#include "private/utils.hpp"
+#include "brookesia/service_manager/raw_buffer_pool.hpp"
+
+namespace esp_brookesia::service {
+
+std::shared_ptr<RawBufferPool> RawBufferPool::create(size_t block_size, size_t block_count)
+{
+    BROOKESIA_LOG_TRACE_GUARD();
+
+    BROOKESIA_LOGD("Params: block_size(%1%), block_count(%2%)", block_size, block_count);
+
+    BROOKESIA_CHECK_FALSE_RETURN((block_size > 0) && (block_count > 0), nullptr, "Invalid pool size");
+
+    std::unique_ptr<uint8_t[]> storage(new (std::nothrow) uint8_t[block_size * block_count]);
+    BROOKESIA_CHECK_NULL_RETURN(storage, nullptr, "Failed to allocate pool storage");
+
+    std::shared_ptr<RawBufferPool> pool;
+    BROOKESIA_CHECK_EXCEPTION_RETURN(
+        pool = std::shared_ptr<RawBufferPool>(new RawBufferPool(block_size, block_count, std::move(storage))),
+        nullptr, "Failed to create pool"
+    );
+
+    return pool;
+}
+
+RawBufferPool::RawBufferPool(size_t block_size, size_t block_count, std::unique_ptr<uint8_t[]> storage)
+    : block_size_(block_size)
+    , block_count_(block_count)
+    , storage_(std::move(storage))
+{
+    free_blocks_.reserve(block_count_);
+    // Reversed so blocks are handed out from the start of the storage
+    for (size_t i = block_count_; i > 0; i--) {
+        free_blocks_.push_back(storage_.get() + (i - 1) * block_size_);
+    }
+}
+
+RawBuffer RawBufferPool::acquire(size_t size)
+{
+    BROOKESIA_CHECK_FALSE_RETURN(
+        (size > 0) && (size <= block_size_), RawBuffer(), "Invalid size: %1% (block size: %2%)", size, block_size_
+    );
+
+    uint8_t *block = nullptr;
+    {
+        boost::lock_guard lock(free_blocks_mutex_);
+        if (free_blocks_.empty()) {
+            BROOKESIA_LOGD("No free block");
+            return RawBuffer();
+        }
+        block = free_blocks_.back();
+        free_blocks_.pop_back();
+    }
+
+    // The releaser holds the pool, it outlives every buffer it handed out
+    return RawBuffer::make_shared(block, size, [pool = shared_from_this()](uint8_t *data, size_t) {
+        pool->release(data);
+    });
+}
+
+size_t RawBufferPool::get_free_count() const
+{
+    boost::lock_guard lock(free_blocks_mutex_);
+    return free_blocks_.size();
+}
+
+void RawBufferPool::release(uint8_t *block)
+{
+    boost::lock_guard lock(free_blocks_mutex_);
+    free_blocks_.push_back(block);
+}
+
+} // namespace esp_brookesia::service
@@ -354,6 +354,23 @@ public:
         };
     }
 
+    std::expected<SchedulerDebugSnapshot, std::string> get_scheduler_snapshot() const
+    {
+        auto scheduler = owner_.get_task_scheduler();
+        if (!scheduler) {
+            return std::unexpected("Utils service has no task scheduler");
+        }
+        return SchedulerDebugSnapshot{
+            .timestamp_ms = to_timestamp_ms(std::chrono::system_clock::now()),
+            .latency_histogram_bounds_us = {
+                lib_utils::TaskScheduler::LATENCY_HISTOGRAM_BOUNDS_US.begin(),
+                lib_utils::TaskScheduler::LATENCY_HISTOGRAM_BOUNDS_US.end()
+            },
+            .statistics = scheduler->get_statistics(),
+            .groups = scheduler->get_group_statistics(),
+        };
+    }
+
     void stop_all()
     {
         stop_memory_debug();
@@ -501,7 +518,7 @@ private:
 UtilsService::UtilsService()
     : ServiceBase({
     .name = get_name().data(),
-    .description = "Inspect memory and thread debug runtimes.",
+    .description = "Inspect memory, thread and task scheduler debug runtimes.",
     .version = make_version(
         BROOKESIA_SERVICE_MANAGER_VER_MAJOR,
         BROOKESIA_SERVICE_MANAGER_VER_MINOR,
@@ -544,6 +561,11 @@ std::span<const FunctionSchema> UtilsService::get_static_function_schemas()
             make_function_schema(
                 FunctionId::GetMemorySnapshot, "Capture the current memory state.", FunctionValueType::Object
             ),
+            make_function_schema(
+                FunctionId::GetSchedulerSnapshot,
+                "Get task counters and per-group queue wait and execution time histograms of the service scheduler.",
+                FunctionValueType::Object
+            ),
         }
     };
     return SCHEMAS;
@@ -675,6 +697,32 @@ ServiceBase::FunctionHandlerMap UtilsService::get_function_handlers()
                                           ));
             },
         },
+        {
+            BROOKESIA_DESCRIBE_TO_STR(FunctionId::GetSchedulerSnapshot),
+            [this](FunctionParameterMap &&)
+            {
+                auto result = impl_->get_scheduler_snapshot();
+                if (!result) {
+                    return to_function_result(std::expected<boost::json::object, std::string>(
+                                                  std::unexpected(result.error())
+                                              ));
+                }
+                return to_function_result(std::expected<boost::json::object, std::string>(
+                                              BROOKESIA_DESCRIBE_TO_JSON(*result).as_object()
+                                          ));
+            },
+        },
+    };
+}
+
+ServiceBase::TypedFunctionHandlerMap UtilsService::get_typed_function_handlers()
+{
+    // In-process callers hand over the configuration as is, without the JSON round trip
+    return {
+        BROOKESIA_SERVICE_TYPED_FUNC_HANDLER_1(
+            BROOKESIA_DESCRIBE_TO_STR(FunctionId::SetDebugConfig), DebugConfig,
+            impl_->set_debug_config(std::move(PARAM))
+        ),
     };
 }
 
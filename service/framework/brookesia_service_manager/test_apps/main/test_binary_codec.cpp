@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "boost/json.hpp"
+#include "brookesia/lib_utils/test_adapter.hpp"
+#include "brookesia/service_manager.hpp"
+#include "common_def.hpp"
+
+namespace esp_brookesia::service {
+
+namespace {
+
+constexpr size_t TEST_BENCHMARK_NUM = 1000;
+constexpr size_t TEST_RAW_BUFFER_SIZE = 1024;
+
+// Shaped like a typical configuration call: short strings, small integers and a nested object
+FunctionParameterMap make_benchmark_parameters()
+{
+    boost::json::array samples;
+    for (int i = 0; i < 16; i++) {
+        samples.push_back(i * 10);
+    }
+    boost::json::object config = {
+        {"sample_rate", 16000},
+        {"channels", 2},
+        {"bits", 16},
+        {"gain", 0.75},
+        {"codec", "opus"},
+        {"samples", samples},
+    };
+
+    return {
+        {"name", FunctionValue(std::string("main"))},
+        {"volume", FunctionValue(75.0)},
+        {"enabled", FunctionValue(true)},
+        {"balance", FunctionValue(-0.25)},
+        {"config", FunctionValue(std::move(config))},
+    };
+}
+
+template <typename Call>
+double measure_us_per_call(Call call)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < TEST_BENCHMARK_NUM; i++) {
+        if (!call()) {
+            return -1;
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                       std::chrono::steady_clock::now() - start
+                   ).count();
+    return static_cast<double>(elapsed) / TEST_BENCHMARK_NUM;
+}
+
+} // namespace
+
+BROOKESIA_TEST_CASE(test_binary_codec_round_trip, "Test Binary Codec: round trip", "[brookesia][service][binary_codec]")
+{
+    BROOKESIA_LOGI("=== Test binary codec round trip ===");
+
+    auto parameters = make_benchmark_parameters();
+    std::vector<uint8_t> raw(TEST_RAW_BUFFER_SIZE);
+    for (size_t i = 0; i < raw.size(); i++) {
+        raw[i] = static_cast<uint8_t>(i);
+    }
+    parameters["raw"] = FunctionValue(RawBuffer(raw.data(), raw.size()));
+
+    std::vector<uint8_t> buffer;
+    TEST_ASSERT_TRUE(encode_binary(parameters, buffer));
+
+    FunctionParameterMap decoded;
+    TEST_ASSERT_TRUE(decode_binary(buffer.data(), buffer.size(), decoded));
+    TEST_ASSERT_EQUAL_size_t(parameters.size(), decoded.size());
+    TEST_ASSERT_EQUAL_STRING("main", std::get<std::string>(decoded["name"]).c_str());
+    TEST_ASSERT_EQUAL_DOUBLE(75.0, std::get<double>(decoded["volume"]));
+    TEST_ASSERT_TRUE(std::get<bool>(decoded["enabled"]));
+    TEST_ASSERT_EQUAL_DOUBLE(-0.25, std::get<double>(decoded["balance"]));
+    TEST_ASSERT_TRUE(std::get<boost::json::object>(decoded["config"]) == std::get<boost::json::object>(parameters["config"]));
+
+    // Byte strings come back as shared buffers owning a copy
+    auto &decoded_raw = std::get<RawBuffer>(decoded["raw"]);
+    TEST_ASSERT_TRUE(decoded_raw.is_shared());
+    TEST_ASSERT_EQUAL_size_t(raw.size(), decoded_raw.data_size);
+    TEST_ASSERT_TRUE(std::memcmp(raw.data(), decoded_raw.data_ptr, raw.size()) == 0);
+
+    // Every truncation is rejected
+    for (size_t size = 0; size < buffer.size(); size++) {
+        TEST_ASSERT_FALSE(decode_binary(buffer.data(), size, decoded));
+    }
+
+    FunctionResult result = {
+        .success = true,
+        .data = FunctionValue(42.0),
+    };
+    TEST_ASSERT_TRUE(encode_binary(result, buffer));
+    FunctionResult decoded_result;
+    TEST_ASSERT_TRUE(decode_binary(buffer.data(), buffer.size(), decoded_result));
+    TEST_ASSERT_TRUE(decoded_result.success);
+    TEST_ASSERT_EQUAL_DOUBLE(42.0, std::get<double>(decoded_result.data.value()));
+
+    EventItemMap event_items = {
+        {"output_name", EventItem(std::string("main"))},
+        {"pressed", EventItem(false)},
+    };
+    TEST_ASSERT_TRUE(encode_binary(event_items, buffer));
+    EventItemMap decoded_items;
+    TEST_ASSERT_TRUE(decode_binary(buffer.data(), buffer.size(), decoded_items));
+    TEST_ASSERT_EQUAL_STRING("main", std::get<std::string>(decoded_items["output_name"]).c_str());
+    TEST_ASSERT_FALSE(std::get<bool>(decoded_items["pressed"]));
+
+    // A value stored in the pointer itself is meaningless in another process
+    int value = 1;
+    TEST_ASSERT_FALSE(encode_binary(EventItemMap{{"pointer", EventItem(RawBuffer(&value))}}, buffer));
+}
+
+BROOKESIA_TEST_CASE(test_binary_codec_benchmark, "Test Binary Codec: benchmark against JSON", "[brookesia][service][binary_codec][benchmark]")
+{
+    BROOKESIA_LOGI("=== Test binary codec benchmark ===");
+
+    auto parameters = make_benchmark_parameters();
+
+    std::vector<uint8_t> buffer;
+    auto binary_encode_us = measure_us_per_call([&]() {
+        return encode_binary(parameters, buffer);
+    });
+    auto binary_size = buffer.size();
+    FunctionParameterMap binary_decoded;
+    auto binary_decode_us = measure_us_per_call([&]() {
+        return decode_binary(buffer.data(), buffer.size(), binary_decoded);
+    });
+
+    std::string text;
+    auto json_encode_us = measure_us_per_call([&]() {
+        text = boost::json::serialize(BROOKESIA_DESCRIBE_TO_JSON(parameters));
+        return !text.empty();
+    });
+    FunctionParameterMap json_decoded;
+    auto json_decode_us = measure_us_per_call([&]() {
+        boost::system::error_code error_code;
+        auto value = boost::json::parse(text, error_code);
+        return !error_code && BROOKESIA_DESCRIBE_FROM_JSON(value, json_decoded);
+    });
+
+    TEST_ASSERT_TRUE((binary_encode_us >= 0) && (binary_decode_us >= 0));
+    TEST_ASSERT_TRUE((json_encode_us >= 0) && (json_decode_us >= 0));
+    TEST_ASSERT_EQUAL_size_t(parameters.size(), binary_decoded.size());
+    TEST_ASSERT_EQUAL_size_t(parameters.size(), json_decoded.size());
+
+    // JSON cannot carry the bytes at all, base64 would add a third on top of the binary size
+    std::vector<uint8_t> raw(TEST_RAW_BUFFER_SIZE, 0x5a);
+    std::vector<uint8_t> raw_buffer;
+    TEST_ASSERT_TRUE(encode_binary(
+                         FunctionParameterMap{{"raw", FunctionValue(RawBuffer(raw.data(), raw.size()))}}, raw_buffer
+                     ));
+    TEST_ASSERT_TRUE(raw_buffer.size() < TEST_RAW_BUFFER_SIZE + 16);
+
+    BROOKESIA_LOGI(
+        "\nFunctionParameterMap codec over %zu runs:\n\tbinary: %zu bytes, encode %.2f us, decode %.2f us"
+        "\n\tJSON: %zu bytes, encode %.2f us, decode %.2f us\n\t%zu-byte RawBuffer: %zu bytes encoded",
+        TEST_BENCHMARK_NUM, binary_size, binary_encode_us, binary_decode_us, text.size(), json_encode_us,
+        json_decode_us, TEST_RAW_BUFFER_SIZE, raw_buffer.size()
+    );
+    TEST_ASSERT_TRUE(binary_size < text.size());
+}
+
+} // namespace esp_brookesia::service
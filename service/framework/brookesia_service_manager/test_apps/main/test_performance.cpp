@@ -35,6 +35,8 @@ static bool service_test_validate_test_all_types_result(const boost::json::objec
 constexpr size_t TEST_REPEATITIVE_NUM = 100;
 // For call function
 constexpr size_t TEST_CALL_FUNCTION_TIMEOUT_MS = 100;
+// For call function by handle
+constexpr size_t TEST_HANDLE_BENCHMARK_NUM = 1000;
 // For concurrent call function
 constexpr const char *TEST_CONCURRENT_SERVICE_NAME = ServiceTest::SERVICE_NAME;
 constexpr size_t TEST_CONCURRENT_NUM = 10;
@@ -140,6 +142,9 @@ static bool do_concurrent_call_function(
     const ConcurrentCallConfig &concurrent_config,
     size_t timeout_ms
 );
+static bool do_benchmark_call_function_by_handle(
+    const std::string &service_name, const std::string &method, size_t test_num
+);
 
 BROOKESIA_TEST_CASE(test_performance_call_function, "Test Performance: call function", "[brookesia][service][call_function_sync]")
 {
@@ -178,6 +183,25 @@ BROOKESIA_TEST_CASE(test_performance_with_scheduler_concurrent_call_function, "T
     TEST_ASSERT_TRUE_MESSAGE(result, "Concurrent call function with scheduler test failed");
 }
 
+BROOKESIA_TEST_CASE(test_performance_call_function_by_handle, "Test Performance: call function by handle", "[brookesia][service][call_function_sync][handle]")
+{
+    bool result = do_benchmark_call_function_by_handle(
+                      ServiceTest::SERVICE_NAME, ServiceTest::FUNCTION_SCHEMAS[ServiceTest::FunctionIndexAdd].name,
+                      TEST_HANDLE_BENCHMARK_NUM
+                  );
+    TEST_ASSERT_TRUE_MESSAGE(result, "Call function by handle benchmark failed");
+}
+
+BROOKESIA_TEST_CASE(test_performance_with_scheduler_call_function_by_handle, "Test Performance with scheduler: call function by handle", "[brookesia][service][call_function_sync][handle][with_scheduler]")
+{
+    bool result = do_benchmark_call_function_by_handle(
+                      ServiceTestWithScheduler::SERVICE_NAME,
+                      ServiceTestWithScheduler::FUNCTION_SCHEMAS[ServiceTestWithScheduler::FunctionIndexAdd].name,
+                      TEST_HANDLE_BENCHMARK_NUM
+                  );
+    TEST_ASSERT_TRUE_MESSAGE(result, "Call function by handle with scheduler benchmark failed");
+}
+
 static boost::json::object service_test_build_add_params()
 {
     boost::json::object params;
@@ -561,3 +585,78 @@ static bool do_concurrent_call_function(
 
     return test_passed;
 }
+
+static bool do_benchmark_call_function_by_handle(
+    const std::string &service_name, const std::string &method, size_t test_num
+)
+{
+    BROOKESIA_CHECK_FALSE_RETURN(startup(), false, "Failed to startup");
+    FunctionGuard shutdown_guard([]() {
+        shutdown();
+    });
+
+    auto test_service_binding = bind_service(service_name);
+    auto service = test_service_binding.get_service();
+    BROOKESIA_CHECK_NULL_RETURN(service, false, "Failed to get service");
+
+    auto handle = service->get_function_handle(method);
+    BROOKESIA_CHECK_FALSE_RETURN(handle.is_valid(), false, "Failed to get function handle: %s", method.c_str());
+
+    auto validate = [](const FunctionResult & result) {
+        auto double_result = result.has_data() ? std::get_if<double>(&result.data.value()) : nullptr;
+        return result.success && (double_result != nullptr) && service_test_validate_add_result(*double_result);
+    };
+    auto measure_us_per_call = [&](const char *label, auto call) -> double {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < test_num; i++)
+        {
+            if (!validate(call())) {
+                BROOKESIA_LOGE("%s: call %zu failed", label, i);
+                return -1;
+            }
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+        return static_cast<double>(elapsed) / test_num;
+    };
+
+    auto by_name_map_us = measure_us_per_call("by name (map)", [&]() {
+        return service->call_function_sync(method, FunctionParameterMap{
+            {"a", FunctionValue(15.5)},
+            {"b", FunctionValue(4.5)},
+        }, TEST_CALL_FUNCTION_TIMEOUT_MS);
+    });
+    auto by_name_values_us = measure_us_per_call("by name (values)", [&]() {
+        return service->call_function_sync(method, std::vector<FunctionValue>{
+            FunctionValue(15.5), FunctionValue(4.5)
+        }, TEST_CALL_FUNCTION_TIMEOUT_MS);
+    });
+    auto by_handle_us = measure_us_per_call("by handle", [&]() {
+        return service->call_function_sync(handle, std::vector<FunctionValue>{
+            FunctionValue(15.5), FunctionValue(4.5)
+        }, TEST_CALL_FUNCTION_TIMEOUT_MS);
+    });
+    BROOKESIA_CHECK_FALSE_RETURN(
+        (by_name_map_us >= 0) && (by_name_values_us >= 0) && (by_handle_us >= 0), false, "Benchmark calls failed"
+    );
+
+    BROOKESIA_LOGI(
+        "\n%s::%s per-call overhead over %zu calls:\n\tby name (map): %.2f us\n\tby name (values): %.2f us"
+        "\n\tby handle: %.2f us", service_name.c_str(), method.c_str(), test_num, by_name_map_us,
+        by_name_values_us, by_handle_us
+    );
+
+    // Wrong parameter types are still rejected through the handle
+    auto invalid_result = service->call_function_sync(handle, std::vector<FunctionValue> {
+        FunctionValue(std::string("15.5")), FunctionValue(4.5)
+    }, TEST_CALL_FUNCTION_TIMEOUT_MS);
+    BROOKESIA_CHECK_FALSE_RETURN(!invalid_result.success, false, "Invalid parameter type was accepted");
+
+    // Unknown functions cannot be resolved
+    BROOKESIA_CHECK_FALSE_RETURN(
+        !service->get_function_handle("not_exist").is_valid(), false, "Unknown function was resolved"
+    );
+
+    return true;
+}
@@ -511,6 +511,8 @@ private:
             {
                 auto callback = std::move(release_callback);
                 release_callback = nullptr;
+                // Drop the reference of a shared buffer before notifying, so the producer can reuse it
+                borrowed_data = {};
                 if (borrowed && callback) {
                     callback(result);
                 }
@@ -1454,8 +1454,14 @@ AudioWriteResult AudioDecoder::write_stream(
     }
 
     StreamContext::Chunk chunk = {};
-    chunk.owned_data.assign(data.data_ptr, data.data_ptr + data.data_size);
-    stream->queued_bytes += chunk.owned_data.size();
+    if (data.is_shared()) {
+        // Keep a reference instead of copying, the producer's buffer is released once the chunk is fed
+        chunk.borrowed_data = data;
+        chunk.borrowed = true;
+    } else {
+        chunk.owned_data.assign(data.data_ptr, data.data_ptr + data.data_size);
+    }
+    stream->queued_bytes += chunk.size();
     stream->queue.emplace_back(std::move(chunk));
     return AudioWriteResult::Written;
 }
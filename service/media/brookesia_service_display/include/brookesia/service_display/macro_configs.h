@@ -41,6 +41,22 @@
 #   endif
 #endif
 
+#if !defined(BROOKESIA_SERVICE_DISPLAY_FRAME_QUEUE_DEPTH)
+#   if defined(CONFIG_BROOKESIA_SERVICE_DISPLAY_FRAME_QUEUE_DEPTH)
+#       define BROOKESIA_SERVICE_DISPLAY_FRAME_QUEUE_DEPTH  CONFIG_BROOKESIA_SERVICE_DISPLAY_FRAME_QUEUE_DEPTH
+#   else
+#       define BROOKESIA_SERVICE_DISPLAY_FRAME_QUEUE_DEPTH  (4)
+#   endif
+#endif
+
+#if !defined(BROOKESIA_SERVICE_DISPLAY_FRAME_MERGE_MAX_BYTES)
+#   if defined(CONFIG_BROOKESIA_SERVICE_DISPLAY_FRAME_MERGE_MAX_BYTES)
+#       define BROOKESIA_SERVICE_DISPLAY_FRAME_MERGE_MAX_BYTES  CONFIG_BROOKESIA_SERVICE_DISPLAY_FRAME_MERGE_MAX_BYTES
+#   else
+#       define BROOKESIA_SERVICE_DISPLAY_FRAME_MERGE_MAX_BYTES  (65536)
+#   endif
+#endif
+
 #if !defined(BROOKESIA_SERVICE_DISPLAY_TOUCH_POLL_INTERVAL_MS)
 #   if defined(CONFIG_BROOKESIA_SERVICE_DISPLAY_TOUCH_POLL_INTERVAL_MS)
 #       define BROOKESIA_SERVICE_DISPLAY_TOUCH_POLL_INTERVAL_MS \
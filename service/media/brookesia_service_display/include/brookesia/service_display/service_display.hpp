@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <expected>
 #include <functional>
 #include <map>
@@ -49,6 +50,10 @@ public:
     using PresentResult = display::PresentResult;
     using PresentSubmitState = display::PresentSubmitState;
     using AsyncSubmitResult = display::AsyncSubmitResult;
+    using DamageStats = display::DamageStats;
+    using LayerConfig = display::LayerConfig;
+    using CompositorConfig = display::CompositorConfig;
+    using CompositorStats = display::CompositorStats;
     using TouchPoint = display::TouchPoint;
     using TouchSnapshot = display::TouchSnapshot;
     using TouchGestureEventType = display::TouchGestureEventType;
@@ -158,13 +163,45 @@ public:
     /**
      * @brief Present a frame asynchronously using a borrowed input buffer.
      *
-     * The producer must keep @p data valid until @p on_complete is invoked.
+     * The producer must keep @p data valid until @p on_complete is invoked. A shared @p data
+     * (@c RawBuffer::is_shared()) is kept alive by the queued frame instead and released before
+     * @p on_complete, which is then optional.
+     *
+     * Each output queues up to @c BROOKESIA_SERVICE_DISPLAY_FRAME_QUEUE_DEPTH damaged areas. Queued areas covered
+     * by the new one, or forming a rectangle with it, are merged and completed with @c PresentResult::Merged.
+     * The submit is rejected with @c PresentSubmitState::DroppedQueueFull when no slot is left.
      */
     AsyncSubmitResult present_frame_async(
         uint32_t source_id, std::string_view output_name, const FrameInfo &frame, const RawBuffer &data,
         CompletionCallback on_complete, uint32_t timeout_ms = BROOKESIA_SERVICE_DISPLAY_DRAW_TIMEOUT_MS
     );
 
+    /**
+     * @brief Get the asynchronous frame queue statistics of an output.
+     */
+    std::expected<DamageStats, std::string> get_damage_stats(std::string_view output_name) const;
+
+    /**
+     * @brief Switch an output to compositor mode.
+     *
+     * A compositing output draws the layers set by @ref set_layer instead of its active source. Each layer keeps
+     * the pixels of its clip area, and a present only recomposites and flushes the tiles it changed. The
+     * direct @ref present_buffer_frame_sync path is not available in this mode.
+     */
+    std::expected<void, std::string> enable_compositor(std::string_view output_name, CompositorConfig config = {});
+    std::expected<void, std::string> disable_compositor(std::string_view output_name);
+
+    /**
+     * @brief Add a source as a layer of a compositing output, or update its layer.
+     *
+     * Moving or resizing the clip area clears the pixels of the layer.
+     */
+    std::expected<void, std::string> set_layer(
+        std::string_view output_name, std::string_view source_name, LayerConfig config
+    );
+    std::expected<void, std::string> remove_layer(std::string_view output_name, std::string_view source_name);
+    std::expected<CompositorStats, std::string> get_compositor_stats(std::string_view output_name) const;
+
     esp_brookesia::lib_utils::connection connect_source_state_changed(const SourceStateChangedSignal::slot_type &slot)
     {
         return source_state_changed_signal_.connect(slot);
@@ -207,8 +244,25 @@ private:
         RawBuffer data;
         uint32_t timeout_ms = BROOKESIA_SERVICE_DISPLAY_DRAW_TIMEOUT_MS;
         CompletionCallback on_complete;
+        size_t merge_capacity = 0; ///< Bytes the owned buffer of a union can grow to in place
+        std::shared_ptr<std::mutex> fill_mutex; ///< Held while a merge copies the borrowed data out of `mutex_`
+        bool is_merged = false; ///< Union of merged areas, owning its data
+        bool is_filling = false; ///< A merge into this frame is copying data out of `mutex_`
+    };
+
+    // Extension of the last queued area, planned under `mutex_` and copied after releasing it
+    struct AsyncFrameMerge {
+        uint32_t frame_id = 0; ///< Queued frame being extended
+        FrameInfo area; ///< Union area
+        FrameInfo queued_area;
+        RawBuffer queued_data; ///< Copied into a new union buffer, empty when the union grows in place
+        RawBuffer union_data;
+        size_t capacity = 0;
+        std::unique_lock<std::mutex> fill_lock;
     };
 
+    class Compositor;
+
     struct BufferOutputContext {
         RawBuffer buffer;
         size_t stride_bytes = 0;
@@ -238,7 +292,9 @@ private:
         bool gesture_has_active_track = false;
         bool gesture_direction_locked = false;
         bool gesture_release_pending = false;
-        std::optional<AsyncFrame> pending_frame;
+        std::deque<AsyncFrame> pending_frames;
+        DamageStats damage_stats;
+        std::shared_ptr<Compositor> compositor;
         hal::InterfaceHandle<hal::display::BacklightIface> backlight;
         uint8_t backlight_brightness = 0;
         bool backlight_on = false;
@@ -432,6 +488,13 @@ private:
     PresentResult present_frame_to_output(
         const OutputDrawTarget &target, const FrameInfo &frame, const RawBuffer &data, uint32_t timeout_ms
     ) const;
+    PresentResult present_frame_to_compositor(
+        Compositor &compositor, const OutputDrawTarget &target, uint32_t source_id, const FrameInfo &frame,
+        const RawBuffer &data, uint32_t timeout_ms
+    ) const;
+    bool is_source_presentable_locked(const OutputContext &output, uint32_t source_id) const;
+    void schedule_compositor_flush(uint32_t output_id);
+    void flush_compositor(uint32_t output_id);
     size_t bytes_per_pixel(PixelFormat pixel_format) const;
     std::string get_render_task_group() const
     {
@@ -439,6 +502,19 @@ private:
     }
     bool schedule_render_output_locked(uint32_t output_id);
     void render_output(uint32_t output_id);
+    void merge_async_frame_locked(OutputContext &output, AsyncFrame &frame, std::vector<AsyncFrame> &merged_frames);
+    void merge_covered_async_frames_locked(
+        OutputContext &output, const AsyncFrame &frame, std::vector<AsyncFrame> &merged_frames
+    );
+    std::optional<AsyncFrameMerge> prepare_async_frame_merge_locked(OutputContext &output, const AsyncFrame &frame);
+    void fill_async_frame_merge(AsyncFrameMerge &merge, const AsyncFrame &frame) const;
+    PresentSubmitState finish_async_frame_merge_locked(
+        uint32_t output_id, AsyncFrame frame, AsyncFrameMerge &merge, std::vector<AsyncFrame> &merged_frames
+    );
+    bool queue_async_frame_locked(OutputContext &output, AsyncFrame frame);
+    void take_pending_frames_locked(
+        OutputContext &output, std::vector<AsyncFrame> &dropped_frames, uint32_t source_id = 0
+    );
     void drop_pending_frames_locked(std::vector<AsyncFrame> &dropped_frames);
     void complete_async_frame(AsyncFrame frame, PresentResult result);
     void bind_default_touches_locked();
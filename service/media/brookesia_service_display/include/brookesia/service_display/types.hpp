@@ -44,6 +44,7 @@ enum class PresentResult {
     DroppedNotActive,
     DroppedInvalidFrame,
     DroppedQueueFull,
+    Merged,
     Error,
 };
 
@@ -51,6 +52,7 @@ enum class PresentSubmitState {
     Queued,
     DroppedNotActive,
     DroppedInvalidFrame,
+    DroppedQueueFull,
     Error,
 };
 
@@ -59,6 +61,34 @@ struct AsyncSubmitResult {
     PresentSubmitState state = PresentSubmitState::Error;
 };
 
+struct DamageStats {
+    uint32_t queued_frames = 0;  ///< Areas waiting to be presented
+    uint64_t merged_frames = 0;  ///< Areas merged into a later queued area
+    uint64_t merged_pixels = 0;
+    uint64_t dropped_frames = 0; ///< Areas rejected because the queue was full
+    uint64_t dropped_pixels = 0;
+};
+
+struct LayerConfig {
+    int32_t z_order = 0;      ///< Layers with a higher order are drawn on top
+    uint8_t alpha = 255;      ///< Constant opacity of the layer, 255 is opaque
+    uint32_t clip_x = 0;
+    uint32_t clip_y = 0;
+    uint32_t clip_width = 0;  ///< 0 extends the clip area to the right edge of the output
+    uint32_t clip_height = 0; ///< 0 extends the clip area to the bottom edge of the output
+};
+
+struct CompositorConfig {
+    uint32_t tile_size = 32;  ///< Side of the square tiles recomposited when dirty, in pixels
+};
+
+struct CompositorStats {
+    uint32_t layer_count = 0;
+    uint64_t composed_tiles = 0;
+    uint64_t flushed_areas = 0;
+    uint64_t flushed_pixels = 0;
+};
+
 struct TouchSnapshot {
     std::vector<TouchPoint> points;
     uint32_t sequence = 0;
@@ -66,10 +96,18 @@ struct TouchSnapshot {
     bool valid = false;
 };
 
-BROOKESIA_DESCRIBE_ENUM(PresentResult, Presented, DroppedNotActive, DroppedInvalidFrame, DroppedQueueFull, Error);
-BROOKESIA_DESCRIBE_ENUM(PresentSubmitState, Queued, DroppedNotActive, DroppedInvalidFrame, Error);
+BROOKESIA_DESCRIBE_ENUM(PresentResult, Presented, DroppedNotActive, DroppedInvalidFrame, DroppedQueueFull, Merged, Error);
+BROOKESIA_DESCRIBE_ENUM(
+    PresentSubmitState, Queued, DroppedNotActive, DroppedInvalidFrame, DroppedQueueFull, Error
+);
 BROOKESIA_DESCRIBE_STRUCT(FrameInfo, (), (x, y, width, height, pixel_format));
 BROOKESIA_DESCRIBE_STRUCT(AsyncSubmitResult, (), (frame_id, state));
+BROOKESIA_DESCRIBE_STRUCT(
+    DamageStats, (), (queued_frames, merged_frames, merged_pixels, dropped_frames, dropped_pixels)
+);
+BROOKESIA_DESCRIBE_STRUCT(LayerConfig, (), (z_order, alpha, clip_x, clip_y, clip_width, clip_height));
+BROOKESIA_DESCRIBE_STRUCT(CompositorConfig, (), (tile_size));
+BROOKESIA_DESCRIBE_STRUCT(CompositorStats, (), (layer_count, composed_tiles, flushed_areas, flushed_pixels));
 BROOKESIA_DESCRIBE_STRUCT(TouchSnapshot, (), (points, sequence, updated_at_ms, valid));
 
 } // namespace esp_brookesia::service::display
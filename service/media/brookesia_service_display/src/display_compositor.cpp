@@ -0,0 +1,550 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include <cstring>
+#include <expected>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "boost/format.hpp"
+#include "brookesia/service_display/service_display.hpp"
+
+#if !BROOKESIA_SERVICE_DISPLAY_ENABLE_DEBUG_LOG
+#   define BROOKESIA_LOG_DISABLE_DEBUG_TRACE 1
+#endif
+#include "private/utils.hpp"
+#include "private/compositor.hpp"
+
+namespace esp_brookesia::service {
+
+namespace {
+
+constexpr uint32_t COMPOSITOR_TILE_SIZE_MIN = 8;
+constexpr uint32_t COMPOSITOR_TILE_SIZE_MAX = 256;
+
+bool is_area_covering(const display::FrameInfo &outer, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+{
+    return (outer.x <= x0) && (outer.y <= y0) && (outer.x + outer.width >= x1) && (outer.y + outer.height >= y1);
+}
+
+uint32_t blend_channel(uint32_t src, uint32_t dst, uint32_t alpha)
+{
+    return (src * alpha + dst * (255 - alpha) + 127) / 255;
+}
+
+} // namespace
+
+Display::Compositor::Compositor(
+    uint32_t width, uint32_t height, PixelFormat pixel_format, size_t bpp, uint32_t tile_size
+)
+    : width_(width)
+    , height_(height)
+    , pixel_format_(pixel_format)
+    , bpp_(bpp)
+    , tile_size_(tile_size)
+    , tile_columns_((width + tile_size - 1) / tile_size)
+    , tile_rows_((height + tile_size - 1) / tile_size)
+    , canvas_(static_cast<size_t>(width) * height * bpp, 0)
+    // Nothing was flushed yet, the first flush paints the whole output
+    , dirty_tiles_(static_cast<size_t>(tile_columns_) * tile_rows_, true)
+{
+}
+
+bool Display::Compositor::set_layer(uint32_t source_id, const LayerConfig &config)
+{
+    auto clip = resolve_clip(config);
+    if (!clip) {
+        return false;
+    }
+
+    std::lock_guard lock(mutex_);
+    auto layer_it = std::find_if(layers_.begin(), layers_.end(), [source_id](const Layer & layer) {
+        return layer.source_id == source_id;
+    });
+    Layer layer;
+    if (layer_it != layers_.end()) {
+        mark_dirty_locked(layer_it->clip);
+        layer = std::move(*layer_it);
+        layers_.erase(layer_it);
+    }
+
+    const bool clip_changed = (layer.clip.x != clip->x) || (layer.clip.y != clip->y) ||
+                              (layer.clip.width != clip->width) || (layer.clip.height != clip->height);
+    if (clip_changed || layer.pixels.empty()) {
+        layer.pixels.assign(static_cast<size_t>(clip->width) * clip->height * bpp_, 0);
+    }
+    layer.source_id = source_id;
+    layer.config = config;
+    layer.clip = clip.value();
+    mark_dirty_locked(layer.clip);
+
+    auto insert_it = std::upper_bound(layers_.begin(), layers_.end(), config.z_order, [](int32_t z_order,
+    const Layer & item) {
+        return z_order < item.config.z_order;
+    });
+    layers_.insert(insert_it, std::move(layer));
+    stats_.layer_count = static_cast<uint32_t>(layers_.size());
+    return true;
+}
+
+bool Display::Compositor::remove_layer(uint32_t source_id)
+{
+    std::lock_guard lock(mutex_);
+    auto layer_it = std::find_if(layers_.begin(), layers_.end(), [source_id](const Layer & layer) {
+        return layer.source_id == source_id;
+    });
+    if (layer_it == layers_.end()) {
+        return false;
+    }
+    mark_dirty_locked(layer_it->clip);
+    layers_.erase(layer_it);
+    stats_.layer_count = static_cast<uint32_t>(layers_.size());
+    return true;
+}
+
+bool Display::Compositor::has_layer(uint32_t source_id) const
+{
+    std::lock_guard lock(mutex_);
+    return std::any_of(layers_.begin(), layers_.end(), [source_id](const Layer & layer) {
+        return layer.source_id == source_id;
+    });
+}
+
+bool Display::Compositor::has_dirty_tiles() const
+{
+    std::lock_guard lock(mutex_);
+    return std::find(dirty_tiles_.begin(), dirty_tiles_.end(), true) != dirty_tiles_.end();
+}
+
+void Display::Compositor::update_layer(uint32_t source_id, const FrameInfo &frame, const uint8_t *data)
+{
+    std::lock_guard lock(mutex_);
+    auto layer_it = std::find_if(layers_.begin(), layers_.end(), [source_id](const Layer & layer) {
+        return layer.source_id == source_id;
+    });
+    if ((layer_it == layers_.end()) || (data == nullptr)) {
+        return;
+    }
+
+    auto &layer = *layer_it;
+    const uint32_t x0 = std::max(frame.x, layer.clip.x);
+    const uint32_t y0 = std::max(frame.y, layer.clip.y);
+    const uint32_t x1 = std::min(frame.x + frame.width, layer.clip.x + layer.clip.width);
+    const uint32_t y1 = std::min(frame.y + frame.height, layer.clip.y + layer.clip.height);
+    if ((x0 >= x1) || (y0 >= y1)) {
+        return;
+    }
+
+    const size_t frame_stride = static_cast<size_t>(frame.width) * bpp_;
+    const size_t layer_stride = static_cast<size_t>(layer.clip.width) * bpp_;
+    const size_t row_bytes = static_cast<size_t>(x1 - x0) * bpp_;
+    for (uint32_t y = y0; y < y1; ++y) {
+        const uint8_t *src = data + (y - frame.y) * frame_stride + (x0 - frame.x) * bpp_;
+        uint8_t *dst = layer.pixels.data() + (y - layer.clip.y) * layer_stride + (x0 - layer.clip.x) * bpp_;
+        std::memcpy(dst, src, row_bytes);
+    }
+    mark_dirty_locked(FrameInfo{
+        .x = x0,
+        .y = y0,
+        .width = x1 - x0,
+        .height = y1 - y0,
+        .pixel_format = pixel_format_,
+    });
+}
+
+bool Display::Compositor::flush(const FlushHandler &handler)
+{
+    // Areas are composed and copied out under the lock, and handed to the handler after it is released, so a slow
+    // panel does not block the layer updates of other sources. The buffers are swapped out and back to keep their
+    // capacity across flushes.
+    std::vector<FlushArea> areas;
+    std::vector<uint8_t> buffer;
+    {
+        std::lock_guard lock(mutex_);
+        areas.swap(flush_areas_);
+        buffer.swap(flush_buffer_);
+        areas.clear();
+        buffer.clear();
+        const size_t canvas_stride = static_cast<size_t>(width_) * bpp_;
+        for (uint32_t tile_y = 0; tile_y < tile_rows_; ++tile_y) {
+            auto row_begin = dirty_tiles_.begin() + static_cast<size_t>(tile_y) * tile_columns_;
+            auto row_end = row_begin + tile_columns_;
+            auto first_it = std::find(row_begin, row_end, true);
+            if (first_it == row_end) {
+                continue;
+            }
+            const auto first_column = static_cast<uint32_t>(first_it - row_begin);
+            auto last_column = first_column;
+            for (uint32_t tile_x = first_column; tile_x < tile_columns_; ++tile_x) {
+                if (*(row_begin + tile_x)) {
+                    compose_tile_locked(tile_x, tile_y);
+                    last_column = tile_x;
+                }
+            }
+
+            // Clean tiles between dirty ones are already composed, flushing them saves draw calls
+            const uint32_t x = first_column * tile_size_;
+            const uint32_t y = tile_y * tile_size_;
+            const FrameInfo area = {
+                .x = x,
+                .y = y,
+                .width = std::min((last_column + 1) * tile_size_, width_) - x,
+                .height = std::min(tile_size_, height_ - y),
+                .pixel_format = pixel_format_,
+            };
+            const size_t row_bytes = static_cast<size_t>(area.width) * bpp_;
+            const size_t offset = buffer.size();
+            buffer.resize(offset + row_bytes * area.height);
+            for (uint32_t row = 0; row < area.height; ++row) {
+                std::memcpy(
+                    buffer.data() + offset + row * row_bytes, canvas_.data() + (y + row) * canvas_stride + x * bpp_,
+                    row_bytes
+                );
+            }
+            std::fill(row_begin + first_column, row_begin + last_column + 1, false);
+            areas.push_back(FlushArea{
+                .area = area,
+                .offset = offset,
+            });
+        }
+    }
+
+    for (auto &area : areas) {
+        area.is_flushed = handler(area.area, buffer.data() + area.offset);
+    }
+
+    std::lock_guard lock(mutex_);
+    bool success = true;
+    for (const auto &area : areas) {
+        if (!area.is_flushed) {
+            // The whole span is redrawn on the next flush, including clean tiles between the dirty ones
+            mark_dirty_locked(area.area);
+            success = false;
+            continue;
+        }
+        stats_.flushed_areas++;
+        stats_.flushed_pixels += static_cast<uint64_t>(area.area.width) * area.area.height;
+    }
+    if (areas.capacity() > flush_areas_.capacity()) {
+        flush_areas_.swap(areas);
+    }
+    if (buffer.capacity() > flush_buffer_.capacity()) {
+        flush_buffer_.swap(buffer);
+    }
+    return success;
+}
+
+Display::CompositorStats Display::Compositor::get_stats() const
+{
+    std::lock_guard lock(mutex_);
+    return stats_;
+}
+
+std::optional<Display::FrameInfo> Display::Compositor::resolve_clip(const LayerConfig &config) const
+{
+    if ((config.clip_x >= width_) || (config.clip_y >= height_)) {
+        return std::nullopt;
+    }
+    const uint32_t max_width = width_ - config.clip_x;
+    const uint32_t max_height = height_ - config.clip_y;
+    if ((config.clip_width > max_width) || (config.clip_height > max_height)) {
+        return std::nullopt;
+    }
+    return FrameInfo{
+        .x = config.clip_x,
+        .y = config.clip_y,
+        .width = (config.clip_width == 0) ? max_width : config.clip_width,
+        .height = (config.clip_height == 0) ? max_height : config.clip_height,
+        .pixel_format = pixel_format_,
+    };
+}
+
+void Display::Compositor::mark_dirty_locked(const FrameInfo &area)
+{
+    if ((area.width == 0) || (area.height == 0)) {
+        return;
+    }
+    const uint32_t first_column = area.x / tile_size_;
+    const uint32_t last_column = std::min((area.x + area.width - 1) / tile_size_, tile_columns_ - 1);
+    const uint32_t first_row = area.y / tile_size_;
+    const uint32_t last_row = std::min((area.y + area.height - 1) / tile_size_, tile_rows_ - 1);
+    for (uint32_t tile_y = first_row; tile_y <= last_row; ++tile_y) {
+        for (uint32_t tile_x = first_column; tile_x <= last_column; ++tile_x) {
+            dirty_tiles_[static_cast<size_t>(tile_y) * tile_columns_ + tile_x] = true;
+        }
+    }
+}
+
+void Display::Compositor::compose_tile_locked(uint32_t tile_x, uint32_t tile_y)
+{
+    const uint32_t x0 = tile_x * tile_size_;
+    const uint32_t y0 = tile_y * tile_size_;
+    const uint32_t x1 = std::min(x0 + tile_size_, width_);
+    const uint32_t y1 = std::min(y0 + tile_size_, height_);
+    const size_t canvas_stride = static_cast<size_t>(width_) * bpp_;
+
+    // Layers below an opaque layer covering the whole tile are hidden
+    size_t first_layer = 0;
+    bool is_covered = false;
+    for (size_t i = layers_.size(); i-- > 0;) {
+        const auto &layer = layers_[i];
+        if ((layer.config.alpha == 255) && is_area_covering(layer.clip, x0, y0, x1, y1)) {
+            first_layer = i;
+            is_covered = true;
+            break;
+        }
+    }
+    if (!is_covered) {
+        for (uint32_t y = y0; y < y1; ++y) {
+            std::memset(canvas_.data() + y * canvas_stride + x0 * bpp_, 0, (x1 - x0) * bpp_);
+        }
+    }
+
+    for (size_t i = first_layer; i < layers_.size(); ++i) {
+        const auto &layer = layers_[i];
+        const uint8_t alpha = layer.config.alpha;
+        const uint32_t layer_x0 = std::max(x0, layer.clip.x);
+        const uint32_t layer_y0 = std::max(y0, layer.clip.y);
+        const uint32_t layer_x1 = std::min(x1, layer.clip.x + layer.clip.width);
+        const uint32_t layer_y1 = std::min(y1, layer.clip.y + layer.clip.height);
+        if ((alpha == 0) || (layer_x0 >= layer_x1) || (layer_y0 >= layer_y1)) {
+            continue;
+        }
+
+        const size_t layer_stride = static_cast<size_t>(layer.clip.width) * bpp_;
+        const size_t pixel_count = layer_x1 - layer_x0;
+        for (uint32_t y = layer_y0; y < layer_y1; ++y) {
+            uint8_t *dst = canvas_.data() + y * canvas_stride + layer_x0 * bpp_;
+            const uint8_t *src =
+                layer.pixels.data() + (y - layer.clip.y) * layer_stride + (layer_x0 - layer.clip.x) * bpp_;
+            if (alpha == 255) {
+                std::memcpy(dst, src, pixel_count * bpp_);
+            } else {
+                blend_row(dst, src, pixel_count, alpha);
+            }
+        }
+    }
+    stats_.composed_tiles++;
+}
+
+void Display::Compositor::blend_row(uint8_t *dst, const uint8_t *src, size_t pixel_count, uint8_t alpha) const
+{
+    if (pixel_format_ == PixelFormat::RGB565) {
+        for (size_t i = 0; i < pixel_count; ++i) {
+            const uint32_t src_pixel = src[2 * i] | (static_cast<uint32_t>(src[2 * i + 1]) << 8);
+            const uint32_t dst_pixel = dst[2 * i] | (static_cast<uint32_t>(dst[2 * i + 1]) << 8);
+            const uint32_t red = blend_channel(src_pixel >> 11, dst_pixel >> 11, alpha);
+            const uint32_t green = blend_channel((src_pixel >> 5) & 0x3F, (dst_pixel >> 5) & 0x3F, alpha);
+            const uint32_t blue = blend_channel(src_pixel & 0x1F, dst_pixel & 0x1F, alpha);
+            const uint32_t pixel = (red << 11) | (green << 5) | blue;
+            dst[2 * i] = static_cast<uint8_t>(pixel & 0xFF);
+            dst[2 * i + 1] = static_cast<uint8_t>(pixel >> 8);
+        }
+        return;
+    }
+    for (size_t i = 0; i < pixel_count * bpp_; ++i) {
+        dst[i] = static_cast<uint8_t>(blend_channel(src[i], dst[i], alpha));
+    }
+}
+
+std::expected<void, std::string> Display::enable_compositor(std::string_view output_name, CompositorConfig config)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    if ((config.tile_size < COMPOSITOR_TILE_SIZE_MIN) || (config.tile_size > COMPOSITOR_TILE_SIZE_MAX)) {
+        return std::unexpected((boost::format("Compositor tile size must be in [%1%, %2%]") %
+                                COMPOSITOR_TILE_SIZE_MIN % COMPOSITOR_TILE_SIZE_MAX).str());
+    }
+
+    std::lock_guard lock(mutex_);
+    auto output_id = find_output_id_locked(output_name);
+    if (!output_id) {
+        return std::unexpected(output_id.error());
+    }
+    auto &output = outputs_.at(output_id.value());
+    if (output.compositor) {
+        return {};
+    }
+    const size_t bpp = bytes_per_pixel(output.info.pixel_format);
+    if (bpp == 0) {
+        return std::unexpected((boost::format("Display output '%1%' pixel format cannot be composited") %
+                                output.info.name).str());
+    }
+    BROOKESIA_CHECK_EXCEPTION_RETURN(
+        output.compositor = std::make_shared<Compositor>(
+                                output.info.width, output.info.height, output.info.pixel_format, bpp, config.tile_size
+                            ),
+        std::unexpected("Failed to allocate the compositor of Display output '" + output.info.name + "'"),
+        "Failed to allocate the compositor of Display output '%1%'", output.info.name
+    );
+    BROOKESIA_LOGI("Display output '%1%' composites with %2%px tiles", output.info.name, config.tile_size);
+    return {};
+}
+
+std::expected<void, std::string> Display::disable_compositor(std::string_view output_name)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    std::lock_guard lock(mutex_);
+    auto output_id = find_output_id_locked(output_name);
+    if (!output_id) {
+        return std::unexpected(output_id.error());
+    }
+    outputs_.at(output_id.value()).compositor.reset();
+    return {};
+}
+
+std::expected<void, std::string> Display::set_layer(
+    std::string_view output_name, std::string_view source_name, LayerConfig config
+)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    uint32_t output_id = 0;
+    {
+        std::lock_guard lock(mutex_);
+        auto parsed_output_id = find_output_id_locked(output_name);
+        if (!parsed_output_id) {
+            return std::unexpected(parsed_output_id.error());
+        }
+        output_id = parsed_output_id.value();
+        auto source_id = find_source_id_locked(source_name);
+        if (!source_id) {
+            return std::unexpected(source_id.error());
+        }
+        auto &output = outputs_.at(output_id);
+        if (!output.compositor) {
+            return std::unexpected((boost::format("Display output '%1%' is not compositing") %
+                                    output.info.name).str());
+        }
+        if (!output.compositor->set_layer(source_id.value(), config)) {
+            return std::unexpected((boost::format("Layer clip area is outside Display output '%1%'") %
+                                    output.info.name).str());
+        }
+    }
+    schedule_compositor_flush(output_id);
+    return {};
+}
+
+std::expected<void, std::string> Display::remove_layer(std::string_view output_name, std::string_view source_name)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    uint32_t output_id = 0;
+    {
+        std::lock_guard lock(mutex_);
+        auto parsed_output_id = find_output_id_locked(output_name);
+        if (!parsed_output_id) {
+            return std::unexpected(parsed_output_id.error());
+        }
+        output_id = parsed_output_id.value();
+        auto source_id = find_source_id_locked(source_name);
+        if (!source_id) {
+            return std::unexpected(source_id.error());
+        }
+        auto &output = outputs_.at(output_id);
+        if (!output.compositor || !output.compositor->remove_layer(source_id.value())) {
+            return std::unexpected((boost::format("Source '%1%' is not a layer of Display output '%2%'") %
+                                    std::string(source_name) % output.info.name).str());
+        }
+    }
+    schedule_compositor_flush(output_id);
+    return {};
+}
+
+std::expected<Display::CompositorStats, std::string> Display::get_compositor_stats(
+    std::string_view output_name
+) const
+{
+    std::lock_guard lock(mutex_);
+    auto output_id = find_output_id_locked(output_name);
+    if (!output_id) {
+        return std::unexpected(output_id.error());
+    }
+    const auto &output = outputs_.at(output_id.value());
+    if (!output.compositor) {
+        return std::unexpected((boost::format("Display output '%1%' is not compositing") % output.info.name).str());
+    }
+    return output.compositor->get_stats();
+}
+
+Display::PresentResult Display::present_frame_to_compositor(
+    Compositor &compositor, const OutputDrawTarget &target, uint32_t source_id, const FrameInfo &frame,
+    const RawBuffer &data, uint32_t timeout_ms
+) const
+{
+    compositor.update_layer(source_id, frame, data.data_ptr);
+    const bool flushed = compositor.flush([&](const FrameInfo & area, const uint8_t *pixels) {
+        const size_t size = static_cast<size_t>(area.width) * area.height * bytes_per_pixel(area.pixel_format);
+        return present_frame_to_output(target, area, RawBuffer(pixels, size), timeout_ms) == PresentResult::Presented;
+    });
+    return flushed ? PresentResult::Presented : PresentResult::Error;
+}
+
+bool Display::is_source_presentable_locked(const OutputContext &output, uint32_t source_id) const
+{
+    if (output.compositor) {
+        return output.compositor->has_layer(source_id);
+    }
+    return output.active_source_id == source_id;
+}
+
+void Display::schedule_compositor_flush(uint32_t output_id)
+{
+    auto scheduler = get_task_scheduler();
+    if ((scheduler == nullptr) || !scheduler->is_running()) {
+        return;
+    }
+    scheduler->post([this, output_id]() {
+        flush_compositor(output_id);
+    }, nullptr, get_render_task_group());
+}
+
+void Display::flush_compositor(uint32_t output_id)
+{
+    std::shared_ptr<std::mutex> draw_mutex;
+    {
+        std::lock_guard lock(mutex_);
+        auto output_it = outputs_.find(output_id);
+        if ((output_it == outputs_.end()) || !output_it->second.compositor) {
+            return;
+        }
+        draw_mutex = output_it->second.draw_mutex;
+    }
+    if (!draw_mutex) {
+        return;
+    }
+
+    std::lock_guard draw_lock(*draw_mutex);
+    OutputDrawTarget target;
+    std::shared_ptr<Compositor> compositor;
+    {
+        std::lock_guard lock(mutex_);
+        auto output_it = outputs_.find(output_id);
+        if ((output_it == outputs_.end()) || !output_it->second.compositor) {
+            return;
+        }
+        const auto &output = output_it->second;
+        compositor = output.compositor;
+        target = OutputDrawTarget{
+            .info = output.info,
+            .panel = output.panel.get(),
+            .buffer = output.buffer,
+        };
+    }
+    auto flushed = compositor->flush([&](const FrameInfo & area, const uint8_t *pixels) {
+        const size_t size = static_cast<size_t>(area.width) * area.height * bytes_per_pixel(area.pixel_format);
+        return present_frame_to_output(
+                   target, area, RawBuffer(pixels, size), BROOKESIA_SERVICE_DISPLAY_DRAW_TIMEOUT_MS
+               ) == PresentResult::Presented;
+    });
+    if (!flushed) {
+        BROOKESIA_LOGW("Failed to flush composited Display output '%1%'", target.info.name);
+    }
+}
+
+} // namespace esp_brookesia::service
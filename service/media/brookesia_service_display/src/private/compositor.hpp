@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "brookesia/service_display/service_display.hpp"
+
+namespace esp_brookesia::service {
+
+/**
+ * @brief Tile-based compositor of the layers of one output.
+ *
+ * Every layer keeps a copy of the pixels inside its clip area. Updating a layer marks the tiles it touches as
+ * dirty, and a flush recomposites only those tiles into the canvas, from the lowest to the highest layer over a
+ * black background. Dirty tiles of one tile row are flushed as one area, spanning the first to the last of them.
+ */
+class Display::Compositor {
+public:
+    using FlushHandler = std::function<bool(const FrameInfo &area, const uint8_t *data)>;
+
+    Compositor(uint32_t width, uint32_t height, PixelFormat pixel_format, size_t bpp, uint32_t tile_size);
+
+    bool set_layer(uint32_t source_id, const LayerConfig &config);
+    bool remove_layer(uint32_t source_id);
+    bool has_layer(uint32_t source_id) const;
+    bool has_dirty_tiles() const;
+
+    /**
+     * @brief Copy the part of a frame inside the clip area of a layer.
+     *
+     * @param[in] source_id Source owning the layer.
+     * @param[in] frame Area of the frame, validated against the output.
+     * @param[in] data Tightly packed pixels of the frame.
+     */
+    void update_layer(uint32_t source_id, const FrameInfo &frame, const uint8_t *data);
+
+    /**
+     * @brief Recomposite the dirty tiles and hand them to @p handler.
+     *
+     * The handler is called without holding the compositor lock, so layers may be updated meanwhile. Tiles whose
+     * flush failed stay dirty.
+     *
+     * @return true if every area was flushed.
+     */
+    bool flush(const FlushHandler &handler);
+
+    CompositorStats get_stats() const;
+
+private:
+    struct Layer {
+        uint32_t source_id = 0;
+        LayerConfig config;
+        FrameInfo clip;
+        std::vector<uint8_t> pixels;
+    };
+
+    // Composed area waiting for the flush handler, its pixels start at `offset` of the flush buffer
+    struct FlushArea {
+        FrameInfo area;
+        size_t offset = 0;
+        bool is_flushed = false;
+    };
+
+    std::optional<FrameInfo> resolve_clip(const LayerConfig &config) const;
+    void mark_dirty_locked(const FrameInfo &area);
+    void compose_tile_locked(uint32_t tile_x, uint32_t tile_y);
+    void blend_row(uint8_t *dst, const uint8_t *src, size_t pixel_count, uint8_t alpha) const;
+
+    mutable std::mutex mutex_;
+    uint32_t width_ = 0;
+    uint32_t height_ = 0;
+    PixelFormat pixel_format_ = PixelFormat::RGB565;
+    size_t bpp_ = 0;
+    uint32_t tile_size_ = 0;
+    uint32_t tile_columns_ = 0;
+    uint32_t tile_rows_ = 0;
+    std::vector<Layer> layers_; ///< Sorted by z-order, ties keep their insertion order
+    std::vector<uint8_t> canvas_;
+    std::vector<FlushArea> flush_areas_;
+    std::vector<uint8_t> flush_buffer_;
+    std::vector<bool> dirty_tiles_;
+    CompositorStats stats_;
+};
+
+} // namespace esp_brookesia::service
@@ -28,6 +28,7 @@
 #   define BROOKESIA_LOG_DISABLE_DEBUG_TRACE 1
 #endif
 #include "private/utils.hpp"
+#include "private/compositor.hpp"
 
 namespace esp_brookesia::service {
 
@@ -68,6 +69,57 @@ uint8_t to_area_mask(Display::TouchGestureArea area)
     return static_cast<uint8_t>(area);
 }
 
+uint64_t get_frame_pixels(const display::FrameInfo &frame)
+{
+    return static_cast<uint64_t>(frame.width) * frame.height;
+}
+
+bool is_frame_area_contained(const display::FrameInfo &outer, const display::FrameInfo &inner)
+{
+    return (inner.x >= outer.x) && (inner.y >= outer.y) && (inner.x + inner.width <= outer.x + outer.width) &&
+           (inner.y + inner.height <= outer.y + outer.height);
+}
+
+// Union of two areas when it is a rectangle itself, e.g. consecutive stripes of a partial render
+std::optional<display::FrameInfo> get_frame_area_union(const display::FrameInfo &a, const display::FrameInfo &b)
+{
+    if ((a.x == b.x) && (a.width == b.width) && (b.y <= a.y + a.height) && (a.y <= b.y + b.height)) {
+        const uint32_t y = std::min(a.y, b.y);
+        return display::FrameInfo{
+            .x = a.x,
+            .y = y,
+            .width = a.width,
+            .height = std::max(a.y + a.height, b.y + b.height) - y,
+            .pixel_format = a.pixel_format,
+        };
+    }
+    if ((a.y == b.y) && (a.height == b.height) && (b.x <= a.x + a.width) && (a.x <= b.x + b.width)) {
+        const uint32_t x = std::min(a.x, b.x);
+        return display::FrameInfo{
+            .x = x,
+            .y = a.y,
+            .width = std::max(a.x + a.width, b.x + b.width) - x,
+            .height = a.height,
+            .pixel_format = a.pixel_format,
+        };
+    }
+    return std::nullopt;
+}
+
+void copy_frame_area(
+    uint8_t *dst, const display::FrameInfo &dst_area, const uint8_t *src, const display::FrameInfo &src_area,
+    size_t bpp
+)
+{
+    const size_t dst_row_bytes = static_cast<size_t>(dst_area.width) * bpp;
+    const size_t src_row_bytes = static_cast<size_t>(src_area.width) * bpp;
+    const size_t dst_x_offset = static_cast<size_t>(src_area.x - dst_area.x) * bpp;
+    for (uint32_t row = 0; row < src_area.height; ++row) {
+        const size_t dst_offset = (static_cast<size_t>(src_area.y - dst_area.y) + row) * dst_row_bytes + dst_x_offset;
+        std::memcpy(dst + dst_offset, src + static_cast<size_t>(row) * src_row_bytes, src_row_bytes);
+    }
+}
+
 } // namespace
 
 struct Display::TouchInterruptBridge {
@@ -568,10 +620,7 @@ std::expected<void, std::string> Display::unregister_output(std::string_view out
                 revoked_source_names.push_back(active_source_name);
             }
         }
-        if (output.pending_frame.has_value()) {
-            dropped_frames.push_back(std::move(output.pending_frame.value()));
-            output.pending_frame.reset();
-        }
+        take_pending_frames_locked(output, dropped_frames);
 
         for (auto &[_, source] : sources_) {
             if (source.requested_outputs.erase(resolved_output_name) > 0) {
@@ -874,6 +923,7 @@ std::expected<void, std::string> Display::unregister_source(uint32_t source_id)
 
     std::string source_name;
     std::vector<std::string> cleared_outputs;
+    std::vector<uint32_t> composited_outputs;
     std::vector<AsyncFrame> dropped_frames;
     {
         std::lock_guard lock(mutex_);
@@ -884,18 +934,22 @@ std::expected<void, std::string> Display::unregister_source(uint32_t source_id)
 
         source_name = source_it->second.info.name;
         sources_.erase(source_it);
-        for (auto &[_, output] : outputs_) {
+        for (auto &[output_id, output] : outputs_) {
             if (output.active_source_id == source_id) {
                 output.active_source_id = INVALID_SOURCE_ID;
                 cleared_outputs.push_back(output.info.name);
             }
-            if (output.pending_frame.has_value() && (output.pending_frame->source_id == source_id)) {
-                dropped_frames.push_back(std::move(output.pending_frame.value()));
-                output.pending_frame.reset();
+            if (output.compositor && output.compositor->remove_layer(source_id)) {
+                composited_outputs.push_back(output_id);
             }
+            take_pending_frames_locked(output, dropped_frames, source_id);
         }
     }
 
+    for (auto output_id : composited_outputs) {
+        schedule_compositor_flush(output_id);
+    }
+
     for (const auto &output_name : cleared_outputs) {
         emit_active_source_changed(output_name, "");
         emit_source_state_changed(source_name, output_name, SourceState::Revoked);
@@ -967,6 +1021,8 @@ std::expected<void, std::string> Display::release_output(uint32_t source_id, std
     std::string source_name;
     std::string resolved_output_name;
     bool cleared_active = false;
+    bool removed_layer = false;
+    uint32_t output_id = 0;
     std::vector<AsyncFrame> dropped_frames;
     {
         std::lock_guard lock(mutex_);
@@ -975,7 +1031,7 @@ std::expected<void, std::string> Display::release_output(uint32_t source_id, std
             return std::unexpected(validation.error());
         }
 
-        auto output_id = find_output_id_locked(output_name).value();
+        output_id = find_output_id_locked(output_name).value();
         auto &source = sources_.at(source_id);
         auto &output = outputs_.at(output_id);
         source.requested_outputs.erase(output.info.name);
@@ -985,12 +1041,13 @@ std::expected<void, std::string> Display::release_output(uint32_t source_id, std
             output.active_source_id = INVALID_SOURCE_ID;
             cleared_active = true;
         }
-        if (output.pending_frame.has_value() && (output.pending_frame->source_id == source_id)) {
-            dropped_frames.push_back(std::move(output.pending_frame.value()));
-            output.pending_frame.reset();
-        }
+        removed_layer = output.compositor && output.compositor->remove_layer(source_id);
+        take_pending_frames_locked(output, dropped_frames, source_id);
     }
 
+    if (removed_layer) {
+        schedule_compositor_flush(output_id);
+    }
     if (cleared_active) {
         emit_active_source_changed(resolved_output_name, "");
     }
@@ -1058,10 +1115,8 @@ std::expected<void, std::string> Display::set_active_source(
         }
 
         output.active_source_id = next_source_id;
-        if ((previous_source_id != INVALID_SOURCE_ID) && (previous_source_id != next_source_id) &&
-                output.pending_frame.has_value() && (output.pending_frame->source_id == previous_source_id)) {
-            dropped_frames.push_back(std::move(output.pending_frame.value()));
-            output.pending_frame.reset();
+        if ((previous_source_id != INVALID_SOURCE_ID) && (previous_source_id != next_source_id)) {
+            take_pending_frames_locked(output, dropped_frames, previous_source_id);
         }
     }
 
@@ -1185,7 +1240,7 @@ Display::PresentResult Display::present_frame_sync(
         }
         output_id = parsed_output_id.value();
         auto &output = outputs_.at(output_id);
-        if (output.active_source_id != source_id) {
+        if (!is_source_presentable_locked(output, source_id)) {
             return PresentResult::DroppedNotActive;
         }
         if ((data.data_ptr == nullptr) || !is_frame_valid_for_output(frame, output, data.data_size)) {
@@ -1202,10 +1257,11 @@ Display::PresentResult Display::present_frame_sync(
     PresentResult result = PresentResult::Error;
     {
         std::lock_guard draw_lock(*draw_mutex);
+        std::shared_ptr<Compositor> compositor;
         {
             std::lock_guard lock(mutex_);
             auto output_it = outputs_.find(output_id);
-            if ((output_it == outputs_.end()) || (output_it->second.active_source_id != source_id)) {
+            if ((output_it == outputs_.end()) || !is_source_presentable_locked(output_it->second, source_id)) {
                 return PresentResult::DroppedNotActive;
             }
             const auto &output = output_it->second;
@@ -1214,8 +1270,13 @@ Display::PresentResult Display::present_frame_sync(
                 .panel = output.panel.get(),
                 .buffer = output.buffer,
             };
+            compositor = output.compositor;
+        }
+        if (compositor) {
+            result = present_frame_to_compositor(*compositor, target, source_id, frame, data, timeout_ms);
+        } else {
+            result = present_frame_to_output(target, frame, data, timeout_ms);
         }
-        result = present_frame_to_output(target, frame, data, timeout_ms);
     }
 
     if (result == PresentResult::Presented) {
@@ -1246,7 +1307,8 @@ Display::PresentResult Display::present_buffer_frame_sync(
         }
         output_id = parsed_output_id.value();
         auto &output = outputs_.at(output_id);
-        if (output.info.slot != OutputSlot::Buffer) {
+        // Writing in place would bypass the layers of a compositing output
+        if ((output.info.slot != OutputSlot::Buffer) || output.compositor) {
             return PresentResult::Error;
         }
         if (output.active_source_id != source_id) {
@@ -1301,15 +1363,17 @@ Display::AsyncSubmitResult Display::present_frame_async(
     CompletionCallback on_complete, uint32_t timeout_ms
 )
 {
-    if (on_complete == nullptr) {
+    if ((on_complete == nullptr) && !data.is_shared()) {
         return {
             .frame_id = 0,
             .state = PresentSubmitState::Error,
         };
     }
 
-    AsyncFrame dropped_frame;
-    bool has_dropped_frame = false;
+    std::vector<AsyncFrame> merged_frames;
+    AsyncFrame async_frame;
+    std::optional<AsyncFrameMerge> merge;
+    uint32_t output_id = 0;
     uint32_t frame_id = 0;
     PresentSubmitState submit_state = PresentSubmitState::Queued;
     {
@@ -1329,7 +1393,7 @@ Display::AsyncSubmitResult Display::present_frame_async(
         }
 
         auto &output = outputs_.at(parsed_output_id.value());
-        if (output.active_source_id != source_id) {
+        if (!is_source_presentable_locked(output, source_id)) {
             return {
                 .frame_id = 0,
                 .state = PresentSubmitState::DroppedNotActive,
@@ -1342,12 +1406,16 @@ Display::AsyncSubmitResult Display::present_frame_async(
             };
         }
 
-        frame_id = allocate_frame_id_locked();
-        if (output.pending_frame.has_value()) {
-            dropped_frame = std::move(output.pending_frame.value());
-            has_dropped_frame = true;
+        if (!schedule_render_output_locked(parsed_output_id.value())) {
+            return {
+                .frame_id = 0,
+                .state = PresentSubmitState::Error,
+            };
         }
-        output.pending_frame = AsyncFrame{
+
+        output_id = parsed_output_id.value();
+        frame_id = allocate_frame_id_locked();
+        async_frame = AsyncFrame{
             .frame_id = frame_id,
             .source_id = source_id,
             .output_name = output.info.name,
@@ -1356,16 +1424,27 @@ Display::AsyncSubmitResult Display::present_frame_async(
             .timeout_ms = timeout_ms,
             .on_complete = std::move(on_complete),
         };
+        merge_covered_async_frames_locked(output, async_frame, merged_frames);
+        // Extend the last queued area when both form a rectangle, copying them into a buffer owned by the queue
+        merge = prepare_async_frame_merge_locked(output, async_frame);
+        if (!merge && !queue_async_frame_locked(output, std::move(async_frame))) {
+            frame_id = 0;
+            submit_state = PresentSubmitState::DroppedQueueFull;
+        }
+    }
 
-        if (!schedule_render_output_locked(parsed_output_id.value())) {
-            output.pending_frame.reset();
+    // The union buffer is allocated and filled without holding `mutex_`, other submits and the render task go on
+    if (merge) {
+        fill_async_frame_merge(merge.value(), async_frame);
+        std::lock_guard lock(mutex_);
+        submit_state = finish_async_frame_merge_locked(output_id, std::move(async_frame), merge.value(), merged_frames);
+        if (submit_state != PresentSubmitState::Queued) {
             frame_id = 0;
-            submit_state = PresentSubmitState::Error;
         }
     }
 
-    if (has_dropped_frame) {
-        complete_async_frame(std::move(dropped_frame), PresentResult::DroppedQueueFull);
+    for (auto &merged_frame : merged_frames) {
+        complete_async_frame(std::move(merged_frame), PresentResult::Merged);
     }
 
     return {
@@ -1374,6 +1453,19 @@ Display::AsyncSubmitResult Display::present_frame_async(
     };
 }
 
+std::expected<Display::DamageStats, std::string> Display::get_damage_stats(std::string_view output_name) const
+{
+    std::lock_guard lock(mutex_);
+    auto output_id = find_output_id_locked(output_name);
+    if (!output_id) {
+        return std::unexpected(output_id.error());
+    }
+    const auto &output = outputs_.at(output_id.value());
+    auto stats = output.damage_stats;
+    stats.queued_frames = static_cast<uint32_t>(output.pending_frames.size());
+    return stats;
+}
+
 std::expected<boost::json::array, std::string> Display::function_get_outputs()
 {
     return to_json_array(get_outputs());
@@ -2090,13 +2182,13 @@ void Display::render_output(uint32_t output_id)
                 return;
             }
             auto &output = output_it->second;
-            if (!output.pending_frame.has_value()) {
+            if (output.pending_frames.empty()) {
                 output.render_scheduled = false;
                 return;
             }
 
-            frame = std::move(output.pending_frame.value());
-            output.pending_frame.reset();
+            frame = std::move(output.pending_frames.front());
+            output.pending_frames.pop_front();
             output.inflight_frame_id = frame.frame_id;
             draw_mutex = output.draw_mutex;
             has_frame = true;
@@ -2113,11 +2205,12 @@ void Display::render_output(uint32_t output_id)
             std::lock_guard draw_lock(*draw_mutex);
             bool is_active = false;
             bool output_exists = false;
+            std::shared_ptr<Compositor> compositor;
             {
                 std::lock_guard lock(mutex_);
                 auto output_it = outputs_.find(output_id);
                 output_exists = output_it != outputs_.end();
-                is_active = output_exists && (output_it->second.active_source_id == frame.source_id);
+                is_active = output_exists && is_source_presentable_locked(output_it->second, frame.source_id);
                 if (is_active) {
                     const auto &output = output_it->second;
                     target = OutputDrawTarget{
@@ -2125,6 +2218,7 @@ void Display::render_output(uint32_t output_id)
                         .panel = output.panel.get(),
                         .buffer = output.buffer,
                     };
+                    compositor = output.compositor;
                 }
             }
 
@@ -2132,6 +2226,10 @@ void Display::render_output(uint32_t output_id)
                 result = PresentResult::Error;
             } else if (!is_active) {
                 result = PresentResult::DroppedNotActive;
+            } else if (compositor) {
+                result = present_frame_to_compositor(
+                             *compositor, target, frame.source_id, frame.frame, frame.data, frame.timeout_ms
+                         );
             } else {
                 result = present_frame_to_output(target, frame.frame, frame.data, frame.timeout_ms);
             }
@@ -2151,14 +2249,182 @@ void Display::render_output(uint32_t output_id)
     }
 }
 
+void Display::merge_async_frame_locked(
+    OutputContext &output, AsyncFrame &frame, std::vector<AsyncFrame> &merged_frames
+)
+{
+    // Areas combined by a previous merge were already counted
+    if (!frame.is_merged) {
+        output.damage_stats.merged_frames++;
+        output.damage_stats.merged_pixels += get_frame_pixels(frame.frame);
+    }
+    merged_frames.push_back(std::move(frame));
+}
+
+void Display::merge_covered_async_frames_locked(
+    OutputContext &output, const AsyncFrame &frame, std::vector<AsyncFrame> &merged_frames
+)
+{
+    // Queued areas repainted entirely by the new frame need no drawing. Frames of other sources are different
+    // layers of a compositing output, so they never merge
+    auto &pending_frames = output.pending_frames;
+    for (auto it = pending_frames.begin(); it != pending_frames.end();) {
+        if ((it->source_id != frame.source_id) || it->is_filling || !is_frame_area_contained(frame.frame, it->frame)) {
+            ++it;
+            continue;
+        }
+        merge_async_frame_locked(output, *it, merged_frames);
+        it = pending_frames.erase(it);
+    }
+}
+
+std::optional<Display::AsyncFrameMerge> Display::prepare_async_frame_merge_locked(
+    OutputContext &output, const AsyncFrame &frame
+)
+{
+    auto &pending_frames = output.pending_frames;
+    if (pending_frames.empty()) {
+        return std::nullopt;
+    }
+    auto &last_frame = pending_frames.back();
+    if ((last_frame.source_id != frame.source_id) || last_frame.is_filling) {
+        return std::nullopt;
+    }
+    auto union_area = get_frame_area_union(last_frame.frame, frame.frame);
+    if (!union_area) {
+        return std::nullopt;
+    }
+    // Larger unions are queued as separate areas, so the memory held by the queue stays bounded
+    const size_t union_bytes = get_frame_pixels(union_area.value()) * bytes_per_pixel(frame.frame.pixel_format);
+    if (union_bytes > BROOKESIA_SERVICE_DISPLAY_FRAME_MERGE_MAX_BYTES) {
+        return std::nullopt;
+    }
+
+    AsyncFrameMerge merge{
+        .frame_id = last_frame.frame_id,
+        .area = union_area.value(),
+        .queued_area = last_frame.frame,
+    };
+    // A stripe right below a union only appends its rows when the union buffer has room left
+    const bool is_appended = last_frame.is_merged && (union_area->x == last_frame.frame.x) &&
+                             (union_area->width == last_frame.frame.width) &&
+                             (frame.frame.y == last_frame.frame.y + last_frame.frame.height);
+    if (is_appended && (union_bytes <= last_frame.merge_capacity)) {
+        merge.union_data = last_frame.data;
+        merge.capacity = last_frame.merge_capacity;
+    } else {
+        // Doubling the capacity copies each byte of a run of stripes a bounded number of times
+        merge.queued_data = last_frame.data;
+        merge.capacity = std::min<size_t>(union_bytes * 2, BROOKESIA_SERVICE_DISPLAY_FRAME_MERGE_MAX_BYTES);
+        if (!last_frame.data.is_shared()) {
+            // Completing the frame returns borrowed data to its producer, so it waits until the copy is done
+            last_frame.fill_mutex = std::make_shared<std::mutex>();
+            merge.fill_lock = std::unique_lock(*last_frame.fill_mutex);
+        }
+    }
+    last_frame.is_filling = true;
+
+    return merge;
+}
+
+void Display::fill_async_frame_merge(AsyncFrameMerge &merge, const AsyncFrame &frame) const
+{
+    const size_t bpp = bytes_per_pixel(frame.frame.pixel_format);
+    if (merge.union_data.data_ptr == nullptr) {
+        merge.union_data = RawBuffer::allocate(merge.capacity);
+        if (auto *union_ptr = merge.union_data.to_ptr<uint8_t>(); union_ptr != nullptr) {
+            copy_frame_area(union_ptr, merge.area, merge.queued_data.data_ptr, merge.queued_area, bpp);
+        }
+    }
+    if (auto *union_ptr = merge.union_data.to_ptr<uint8_t>(); union_ptr != nullptr) {
+        copy_frame_area(union_ptr, merge.area, frame.data.data_ptr, frame.frame, bpp);
+    }
+
+    merge.queued_data = {};
+    if (merge.fill_lock.owns_lock()) {
+        merge.fill_lock.unlock();
+    }
+}
+
+Display::PresentSubmitState Display::finish_async_frame_merge_locked(
+    uint32_t output_id, AsyncFrame frame, AsyncFrameMerge &merge, std::vector<AsyncFrame> &merged_frames
+)
+{
+    auto output_it = outputs_.find(output_id);
+    if ((output_it == outputs_.end()) || !is_source_presentable_locked(output_it->second, frame.source_id)) {
+        return PresentSubmitState::DroppedNotActive;
+    }
+    auto &output = output_it->second;
+    auto &pending_frames = output.pending_frames;
+    auto queued_it = std::find_if(pending_frames.begin(), pending_frames.end(), [&merge](const AsyncFrame & queued) {
+        return queued.frame_id == merge.frame_id;
+    });
+
+    // The queued frame may have been drawn or dropped during the copy, then the new frame is queued on its own
+    if ((queued_it == pending_frames.end()) || (merge.union_data.data_ptr == nullptr)) {
+        if (queued_it != pending_frames.end()) {
+            queued_it->is_filling = false;
+        }
+        if (!schedule_render_output_locked(output_id)) {
+            return PresentSubmitState::Error;
+        }
+        return queue_async_frame_locked(output, std::move(frame)) ? PresentSubmitState::Queued :
+               PresentSubmitState::DroppedQueueFull;
+    }
+
+    auto union_data = std::move(merge.union_data);
+    union_data.data_size = get_frame_pixels(merge.area) * bytes_per_pixel(frame.frame.pixel_format);
+    AsyncFrame union_frame{
+        .frame_id = allocate_frame_id_locked(),
+        .source_id = frame.source_id,
+        .output_name = frame.output_name,
+        .frame = merge.area,
+        .data = std::move(union_data),
+        .timeout_ms = std::max(queued_it->timeout_ms, frame.timeout_ms),
+        .merge_capacity = merge.capacity,
+        .is_merged = true,
+    };
+    merge_async_frame_locked(output, *queued_it, merged_frames);
+    merge_async_frame_locked(output, frame, merged_frames);
+    *queued_it = std::move(union_frame);
+
+    return PresentSubmitState::Queued;
+}
+
+bool Display::queue_async_frame_locked(OutputContext &output, AsyncFrame frame)
+{
+    auto &stats = output.damage_stats;
+    if (output.pending_frames.size() >= BROOKESIA_SERVICE_DISPLAY_FRAME_QUEUE_DEPTH) {
+        stats.dropped_frames++;
+        stats.dropped_pixels += get_frame_pixels(frame.frame);
+        return false;
+    }
+    output.pending_frames.push_back(std::move(frame));
+    return true;
+}
+
+void Display::take_pending_frames_locked(
+    OutputContext &output, std::vector<AsyncFrame> &dropped_frames, uint32_t source_id
+)
+{
+    auto &pending_frames = output.pending_frames;
+    for (auto it = pending_frames.begin(); it != pending_frames.end();) {
+        if ((source_id != INVALID_SOURCE_ID) && (it->source_id != source_id)) {
+            ++it;
+            continue;
+        }
+        dropped_frames.push_back(std::move(*it));
+        it = pending_frames.erase(it);
+    }
+}
+
 void Display::drop_pending_frames_locked(std::vector<AsyncFrame> &dropped_frames)
 {
     for (auto &[_, output] : outputs_) {
-        if (!output.pending_frame.has_value()) {
+        if (output.pending_frames.empty()) {
             continue;
         }
-        dropped_frames.push_back(std::move(output.pending_frame.value()));
-        output.pending_frame.reset();
+        take_pending_frames_locked(output, dropped_frames);
         if (output.inflight_frame_id == 0) {
             output.render_scheduled = false;
         }
@@ -2167,6 +2433,11 @@ void Display::drop_pending_frames_locked(std::vector<AsyncFrame> &dropped_frames
 
 void Display::complete_async_frame(AsyncFrame frame, PresentResult result)
 {
+    // Return a shared buffer to its producer before notifying, so it can be reused for the next frame
+    if (frame.fill_mutex != nullptr) {
+        std::lock_guard fill_lock(*frame.fill_mutex);
+    }
+    frame.data = {};
     if (frame.on_complete != nullptr) {
         frame.on_complete(frame.frame_id, result);
     }
@@ -9,6 +9,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -1097,6 +1098,70 @@ BROOKESIA_TEST_CASE(buffer_output_async, "Test ServiceDisplay - buffer output as
     TEST_ASSERT_EQUAL_UINT16(0x0F0F, read_rgb565_pixel(output_buffer, stride_bytes, 0, 0));
 }
 
+BROOKESIA_TEST_CASE(
+    buffer_output_async_shared, "Test ServiceDisplay - buffer output async with shared buffer", "[service][display][buffer]"
+)
+{
+    TEST_ASSERT_TRUE_MESSAGE(startup(), "Failed to startup");
+    lib_utils::FunctionGuard shutdown_guard([]() {
+        shutdown();
+    });
+
+    constexpr uint32_t width = 16;
+    constexpr uint32_t height = 16;
+    constexpr size_t stride_bytes = width * 2;
+    std::vector<uint8_t> output_buffer(stride_bytes * height, 0);
+    auto output_id = DisplayService::get_instance().register_output(DisplayService::BufferOutputConfig{
+        .name = "BufferShared",
+        .width = width,
+        .height = height,
+        .pixel_format = PixelFormat::RGB565,
+        .buffer = service::RawBuffer(output_buffer.data(), output_buffer.size()),
+        .stride_bytes = stride_bytes,
+    });
+    TEST_ASSERT_TRUE(output_id.has_value());
+
+    const uint32_t source_id = register_source("buffer-shared-source", "test", {"BufferShared"});
+    TEST_ASSERT_TRUE(DisplayService::get_instance().set_active_source("BufferShared", "buffer-shared-source").has_value());
+
+    const DisplayService::FrameInfo frame = {
+        .x = 0,
+        .y = 0,
+        .width = width,
+        .height = height,
+        .pixel_format = PixelFormat::RGB565,
+    };
+    auto pool = service::RawBufferPool::create(stride_bytes * height, 1);
+    TEST_ASSERT_NOT_NULL(pool);
+    {
+        auto frame_data = pool->acquire(stride_bytes * height);
+        TEST_ASSERT_TRUE(frame_data.is_shared());
+        auto pixels = make_rgb565_frame(frame.width, frame.height, 0x0A0A);
+        std::copy(pixels.begin(), pixels.end(), frame_data.to_ptr<uint8_t>());
+
+        // No completion callback, the queued frame holds the buffer until it is rendered
+        auto result = DisplayService::get_instance().present_frame_async(
+                          source_id, "BufferShared", frame, frame_data, nullptr, DRAW_TIMEOUT_MS
+                      );
+        TEST_ASSERT_TRUE(result.state == PresentSubmitState::Queued);
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(DRAW_TIMEOUT_MS);
+    while ((pool->get_free_count() == 0) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    TEST_ASSERT_EQUAL(1, pool->get_free_count());
+    TEST_ASSERT_EQUAL_UINT16(0x0A0A, read_rgb565_pixel(output_buffer, stride_bytes, 0, 0));
+
+    // A borrowed buffer still requires a completion callback
+    auto pixels = make_rgb565_frame(frame.width, frame.height, 0x0B0B);
+    auto result = DisplayService::get_instance().present_frame_async(
+                      source_id, "BufferShared", frame, service::RawBuffer(pixels.data(), pixels.size()), nullptr,
+                      DRAW_TIMEOUT_MS
+                  );
+    TEST_ASSERT_TRUE(result.state == PresentSubmitState::Error);
+}
+
 BROOKESIA_TEST_CASE(buffer_output_invalid_inputs, "Test ServiceDisplay - buffer output invalid inputs", "[service][display][buffer]")
 {
     TEST_ASSERT_TRUE_MESSAGE(startup(), "Failed to startup");
@@ -1368,13 +1433,285 @@ BROOKESIA_TEST_CASE(async_latest_wins, "Test ServiceDisplay - async latest wins"
                     );
     TEST_ASSERT_TRUE(result_c.state == PresentSubmitState::Queued);
 
-    TEST_ASSERT_TRUE(collector.wait_for(result_b.frame_id, PresentResult::DroppedQueueFull, EVENT_TIMEOUT_MS));
+    TEST_ASSERT_TRUE(collector.wait_for(result_b.frame_id, PresentResult::Merged, EVENT_TIMEOUT_MS));
     esp_brookesia::test_apps::service_display::MockDisplayDevice::release_sync_draws(1);
     TEST_ASSERT_TRUE(collector.wait_for(result_a.frame_id, PresentResult::Presented, DRAW_TIMEOUT_MS));
     TEST_ASSERT_TRUE(wait_for_sync_draw_enter_count(2, DRAW_TIMEOUT_MS));
     esp_brookesia::test_apps::service_display::MockDisplayDevice::release_sync_draws(1);
     TEST_ASSERT_TRUE(collector.wait_for(result_c.frame_id, PresentResult::Presented, DRAW_TIMEOUT_MS));
     TEST_ASSERT_TRUE(wait_for_draw_count(2, DRAW_TIMEOUT_MS));
+
+    auto stats = DisplayService::get_instance().get_damage_stats(output0);
+    TEST_ASSERT_TRUE(stats.has_value());
+    TEST_ASSERT_EQUAL_UINT32(0, stats->queued_frames);
+    TEST_ASSERT_TRUE(stats->merged_frames == 1);
+    TEST_ASSERT_TRUE(stats->merged_pixels == static_cast<uint64_t>(frame.width) * frame.height);
+}
+
+BROOKESIA_TEST_CASE(async_damage_queue, "Test ServiceDisplay - async damage queue", "[service][display][async]")
+{
+    TEST_ASSERT_TRUE_MESSAGE(startup(), "Failed to startup");
+    lib_utils::FunctionGuard shutdown_guard([]() {
+        shutdown();
+    });
+
+    auto outputs = fetch_outputs();
+    const std::string output0 = outputs[0].name;
+    const uint32_t source_id = register_source("damage", "test", {output0});
+    TEST_ASSERT_TRUE(DisplayService::get_instance().set_active_source(output0, "damage").has_value());
+    esp_brookesia::test_apps::service_display::MockDisplayDevice::set_sync_draw_blocked(true);
+
+    AsyncCompletionCollector collector;
+    std::vector<std::vector<uint8_t>> frame_data;
+    auto present = [&](const DisplayService::FrameInfo & frame, uint16_t color) {
+        frame_data.push_back(make_rgb565_frame(frame.width, frame.height, color));
+        return DisplayService::get_instance().present_frame_async(
+                   source_id, output0, frame, service::RawBuffer(frame_data.back().data(), frame_data.back().size()),
+        [&collector](uint32_t frame_id, PresentResult present_result) {
+            collector.complete(frame_id, present_result);
+        },
+        DRAW_TIMEOUT_MS
+               );
+    };
+    auto make_frame = [](uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+        return DisplayService::FrameInfo{
+            .x = x,
+            .y = y,
+            .width = width,
+            .height = height,
+            .pixel_format = PixelFormat::RGB565,
+        };
+    };
+
+    // Keep the first frame in flight so the following ones stay queued
+    auto result_busy = present(make_frame(0, 0, 16, 16), 0x1111);
+    TEST_ASSERT_TRUE(result_busy.state == PresentSubmitState::Queued);
+    TEST_ASSERT_TRUE(wait_for_sync_draw_enter_count(1, DRAW_TIMEOUT_MS));
+
+    // Consecutive stripes are flushed as their union
+    auto result_top = present(make_frame(0, 32, 32, 8), 0x2222);
+    auto result_bottom = present(make_frame(0, 40, 32, 8), 0x3333);
+    TEST_ASSERT_TRUE(result_top.state == PresentSubmitState::Queued);
+    TEST_ASSERT_TRUE(result_bottom.state == PresentSubmitState::Queued);
+    TEST_ASSERT_TRUE(collector.wait_for(result_top.frame_id, PresentResult::Merged, EVENT_TIMEOUT_MS));
+    TEST_ASSERT_TRUE(collector.wait_for(result_bottom.frame_id, PresentResult::Merged, EVENT_TIMEOUT_MS));
+
+    // Disjoint areas fill the remaining slots, then submits are rejected
+    const size_t free_slots = BROOKESIA_SERVICE_DISPLAY_FRAME_QUEUE_DEPTH - 1;
+    for (size_t i = 0; i < free_slots; i++) {
+        auto result = present(make_frame(static_cast<uint32_t>(i) * 16, 64, 8, 8), 0x4444);
+        TEST_ASSERT_TRUE(result.state == PresentSubmitState::Queued);
+    }
+    auto result_full = present(make_frame(0, 80, 8, 8), 0x5555);
+    TEST_ASSERT_TRUE(result_full.state == PresentSubmitState::DroppedQueueFull);
+
+    auto stats = DisplayService::get_instance().get_damage_stats(output0);
+    TEST_ASSERT_TRUE(stats.has_value());
+    TEST_ASSERT_EQUAL_UINT32(BROOKESIA_SERVICE_DISPLAY_FRAME_QUEUE_DEPTH, stats->queued_frames);
+    TEST_ASSERT_TRUE(stats->merged_frames == 2);
+    TEST_ASSERT_TRUE(stats->merged_pixels == 2 * 32 * 8);
+    TEST_ASSERT_TRUE(stats->dropped_frames == 1);
+    TEST_ASSERT_TRUE(stats->dropped_pixels == 8 * 8);
+
+    esp_brookesia::test_apps::service_display::MockDisplayDevice::set_sync_draw_blocked(false);
+    TEST_ASSERT_TRUE(wait_for_draw_count(1 + BROOKESIA_SERVICE_DISPLAY_FRAME_QUEUE_DEPTH, DRAW_TIMEOUT_MS));
+    TEST_ASSERT_TRUE(collector.wait_for(result_busy.frame_id, PresentResult::Presented, DRAW_TIMEOUT_MS));
+
+    auto records = esp_brookesia::test_apps::service_display::MockDisplayDevice::get_draw_records();
+    TEST_ASSERT_EQUAL_size_t(1 + BROOKESIA_SERVICE_DISPLAY_FRAME_QUEUE_DEPTH, records.size());
+    TEST_ASSERT_EQUAL_UINT32(0, records[1].x1);
+    TEST_ASSERT_EQUAL_UINT32(32, records[1].y1);
+    TEST_ASSERT_EQUAL_UINT32(32, records[1].x2);
+    TEST_ASSERT_EQUAL_UINT32(48, records[1].y2);
+    TEST_ASSERT_EQUAL_UINT16(0x2222, read_rgb565_pixel(records[1].data, 32 * 2, 0, 7));
+    TEST_ASSERT_EQUAL_UINT16(0x3333, read_rgb565_pixel(records[1].data, 32 * 2, 31, 8));
+}
+
+BROOKESIA_TEST_CASE(
+    async_damage_merge_limit, "Test ServiceDisplay - async damage merge limit", "[service][display][async]"
+)
+{
+    TEST_ASSERT_TRUE_MESSAGE(startup(), "Failed to startup");
+    lib_utils::FunctionGuard shutdown_guard([]() {
+        shutdown();
+    });
+
+    auto outputs = fetch_outputs();
+    const std::string output0 = outputs[0].name;
+    const uint32_t source_id = register_source("merge", "test", {output0});
+    TEST_ASSERT_TRUE(DisplayService::get_instance().set_active_source(output0, "merge").has_value());
+    esp_brookesia::test_apps::service_display::MockDisplayDevice::set_sync_draw_blocked(true);
+
+    AsyncCompletionCollector collector;
+    std::vector<std::vector<uint8_t>> frame_data;
+    auto present = [&](const DisplayService::FrameInfo & frame, uint16_t color) {
+        frame_data.push_back(make_rgb565_frame(frame.width, frame.height, color));
+        return DisplayService::get_instance().present_frame_async(
+                   source_id, output0, frame, service::RawBuffer(frame_data.back().data(), frame_data.back().size()),
+        [&collector](uint32_t frame_id, PresentResult present_result) {
+            collector.complete(frame_id, present_result);
+        },
+        DRAW_TIMEOUT_MS
+               );
+    };
+    auto make_frame = [](uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+        return DisplayService::FrameInfo{
+            .x = x,
+            .y = y,
+            .width = width,
+            .height = height,
+            .pixel_format = PixelFormat::RGB565,
+        };
+    };
+
+    // Keep the first frame in flight so the following ones stay queued
+    auto result_busy = present(make_frame(0, 0, 16, 16), 0x1111);
+    TEST_ASSERT_TRUE(result_busy.state == PresentSubmitState::Queued);
+    TEST_ASSERT_TRUE(wait_for_sync_draw_enter_count(1, DRAW_TIMEOUT_MS));
+
+    // A stripe right below a union is appended to its buffer
+    auto result_top = present(make_frame(0, 32, 32, 8), 0x2222);
+    auto result_middle = present(make_frame(0, 40, 32, 8), 0x3333);
+    auto result_bottom = present(make_frame(0, 48, 32, 8), 0x4444);
+    TEST_ASSERT_TRUE(collector.wait_for(result_top.frame_id, PresentResult::Merged, EVENT_TIMEOUT_MS));
+    TEST_ASSERT_TRUE(collector.wait_for(result_middle.frame_id, PresentResult::Merged, EVENT_TIMEOUT_MS));
+    TEST_ASSERT_TRUE(collector.wait_for(result_bottom.frame_id, PresentResult::Merged, EVENT_TIMEOUT_MS));
+
+    // Stripes whose union exceeds the merge limit are queued separately
+    constexpr uint32_t stripe_width = 240;
+    constexpr uint32_t stripe_y = 96;
+    constexpr uint32_t stripe_height = BROOKESIA_SERVICE_DISPLAY_FRAME_MERGE_MAX_BYTES / (stripe_width * 2) / 2 + 1;
+    TEST_ASSERT_TRUE(stripe_y + 2 * stripe_height <= 240);
+    auto result_large_a = present(make_frame(0, stripe_y, stripe_width, stripe_height), 0x5555);
+    auto result_large_b = present(make_frame(0, stripe_y + stripe_height, stripe_width, stripe_height), 0x6666);
+    TEST_ASSERT_TRUE(result_large_a.state == PresentSubmitState::Queued);
+    TEST_ASSERT_TRUE(result_large_b.state == PresentSubmitState::Queued);
+
+    auto stats = DisplayService::get_instance().get_damage_stats(output0);
+    TEST_ASSERT_TRUE(stats.has_value());
+    TEST_ASSERT_EQUAL_UINT32(3, stats->queued_frames);
+    TEST_ASSERT_TRUE(stats->merged_frames == 3);
+    TEST_ASSERT_TRUE(stats->merged_pixels == 3 * 32 * 8);
+
+    esp_brookesia::test_apps::service_display::MockDisplayDevice::set_sync_draw_blocked(false);
+    TEST_ASSERT_TRUE(wait_for_draw_count(4, DRAW_TIMEOUT_MS));
+    TEST_ASSERT_TRUE(collector.wait_for(result_large_a.frame_id, PresentResult::Presented, DRAW_TIMEOUT_MS));
+    TEST_ASSERT_TRUE(collector.wait_for(result_large_b.frame_id, PresentResult::Presented, DRAW_TIMEOUT_MS));
+
+    auto records = esp_brookesia::test_apps::service_display::MockDisplayDevice::get_draw_records();
+    TEST_ASSERT_EQUAL_size_t(4, records.size());
+    TEST_ASSERT_EQUAL_UINT32(32, records[1].y1);
+    TEST_ASSERT_EQUAL_UINT32(56, records[1].y2);
+    TEST_ASSERT_EQUAL_UINT16(0x2222, read_rgb565_pixel(records[1].data, 32 * 2, 0, 7));
+    TEST_ASSERT_EQUAL_UINT16(0x3333, read_rgb565_pixel(records[1].data, 32 * 2, 31, 8));
+    TEST_ASSERT_EQUAL_UINT16(0x4444, read_rgb565_pixel(records[1].data, 32 * 2, 0, 23));
+    TEST_ASSERT_EQUAL_UINT32(stripe_y, records[2].y1);
+    TEST_ASSERT_EQUAL_UINT32(stripe_y + stripe_height, records[3].y1);
+}
+
+BROOKESIA_TEST_CASE(compositor_layers, "Test ServiceDisplay - compositor layers", "[service][display][compositor]")
+{
+    TEST_ASSERT_TRUE_MESSAGE(startup(), "Failed to startup");
+    lib_utils::FunctionGuard shutdown_guard([]() {
+        shutdown();
+    });
+
+    constexpr uint32_t width = 32;
+    constexpr uint32_t height = 32;
+    constexpr size_t stride_bytes = width * 2;
+    std::vector<uint8_t> output_buffer(stride_bytes * height, 0);
+    auto &display = DisplayService::get_instance();
+    auto output_id = display.register_output(DisplayService::BufferOutputConfig{
+        .name = "BufferComposite",
+        .width = width,
+        .height = height,
+        .pixel_format = PixelFormat::RGB565,
+        .buffer = service::RawBuffer(output_buffer.data(), output_buffer.size()),
+        .stride_bytes = stride_bytes,
+    });
+    TEST_ASSERT_TRUE(output_id.has_value());
+    TEST_ASSERT_FALSE(display.enable_compositor("BufferComposite", {.tile_size = 0}).has_value());
+    TEST_ASSERT_TRUE(display.enable_compositor("BufferComposite", {.tile_size = 16}).has_value());
+
+    const uint32_t base_id = register_source("composite-base", "test", {"BufferComposite"});
+    const uint32_t overlay_id = register_source("composite-overlay", "test", {"BufferComposite"});
+    const uint32_t hidden_id = register_source("composite-hidden", "test", {"BufferComposite"});
+    TEST_ASSERT_TRUE(display.set_layer("BufferComposite", "composite-base", {}).has_value());
+    DisplayService::LayerConfig overlay_layer = {
+        .z_order = 1,
+        .clip_x = 8,
+        .clip_y = 8,
+        .clip_width = 8,
+        .clip_height = 8,
+    };
+    TEST_ASSERT_TRUE(display.set_layer("BufferComposite", "composite-overlay", overlay_layer).has_value());
+    DisplayService::LayerConfig outside_layer = {
+        .clip_x = width,
+    };
+    TEST_ASSERT_FALSE(display.set_layer("BufferComposite", "composite-hidden", outside_layer).has_value());
+
+    constexpr uint16_t base_color = 0x001F;
+    constexpr uint16_t overlay_color = 0xF800;
+    const DisplayService::FrameInfo full_frame = {
+        .x = 0,
+        .y = 0,
+        .width = width,
+        .height = height,
+        .pixel_format = PixelFormat::RGB565,
+    };
+    const DisplayService::FrameInfo overlay_frame = {
+        .x = 8,
+        .y = 8,
+        .width = 8,
+        .height = 8,
+        .pixel_format = PixelFormat::RGB565,
+    };
+    auto base_data = make_rgb565_frame(full_frame.width, full_frame.height, base_color);
+    auto overlay_data = make_rgb565_frame(overlay_frame.width, overlay_frame.height, overlay_color);
+    auto present = [&](uint32_t source_id, const DisplayService::FrameInfo & frame, std::vector<uint8_t> &data) {
+        return display.present_frame_sync(
+                   source_id, "BufferComposite", frame, service::RawBuffer(data.data(), data.size())
+               );
+    };
+
+    TEST_ASSERT_TRUE(present(base_id, full_frame, base_data) == PresentResult::Presented);
+    TEST_ASSERT_TRUE(present(overlay_id, overlay_frame, overlay_data) == PresentResult::Presented);
+    TEST_ASSERT_TRUE(present(hidden_id, overlay_frame, overlay_data) == PresentResult::DroppedNotActive);
+    TEST_ASSERT_EQUAL_UINT16(base_color, read_rgb565_pixel(output_buffer, stride_bytes, 7, 8));
+    TEST_ASSERT_EQUAL_UINT16(overlay_color, read_rgb565_pixel(output_buffer, stride_bytes, 8, 8));
+    TEST_ASSERT_EQUAL_UINT16(overlay_color, read_rgb565_pixel(output_buffer, stride_bytes, 15, 15));
+    TEST_ASSERT_EQUAL_UINT16(base_color, read_rgb565_pixel(output_buffer, stride_bytes, 16, 15));
+    TEST_ASSERT_EQUAL_UINT16(base_color, read_rgb565_pixel(output_buffer, stride_bytes, 31, 31));
+
+    // Writing in place would bypass the layers
+    auto buffer_writer = [](DisplayService::BufferOutputView &) {
+        return true;
+    };
+    TEST_ASSERT_TRUE(
+        display.present_buffer_frame_sync(base_id, "BufferComposite", overlay_frame, buffer_writer) ==
+        PresentResult::Error
+    );
+
+    // Let the flush scheduled by the layer change settle, then only the tile under the overlay is recomposited
+    overlay_layer.alpha = 128;
+    TEST_ASSERT_TRUE(display.set_layer("BufferComposite", "composite-overlay", overlay_layer).has_value());
+    lib_utils::test_adapter::delay_ms(100);
+    auto stats_before = display.get_compositor_stats("BufferComposite");
+    TEST_ASSERT_TRUE(stats_before.has_value());
+    TEST_ASSERT_EQUAL_UINT32(2, stats_before->layer_count);
+    TEST_ASSERT_TRUE(present(overlay_id, overlay_frame, overlay_data) == PresentResult::Presented);
+    TEST_ASSERT_EQUAL_UINT16(0x800F, read_rgb565_pixel(output_buffer, stride_bytes, 8, 8));
+    TEST_ASSERT_EQUAL_UINT16(base_color, read_rgb565_pixel(output_buffer, stride_bytes, 16, 8));
+    auto stats_after = display.get_compositor_stats("BufferComposite");
+    TEST_ASSERT_TRUE(stats_after.has_value());
+    TEST_ASSERT_TRUE(stats_after->composed_tiles == stats_before->composed_tiles + 1);
+    TEST_ASSERT_TRUE(stats_after->flushed_pixels == stats_before->flushed_pixels + 16 * 16);
+
+    // Removing the overlay uncovers the base layer again
+    TEST_ASSERT_TRUE(display.remove_layer("BufferComposite", "composite-overlay").has_value());
+    TEST_ASSERT_TRUE(present(base_id, full_frame, base_data) == PresentResult::Presented);
+    TEST_ASSERT_EQUAL_UINT16(base_color, read_rgb565_pixel(output_buffer, stride_bytes, 8, 8));
+    TEST_ASSERT_TRUE(present(overlay_id, overlay_frame, overlay_data) == PresentResult::DroppedNotActive);
 }
 
 BROOKESIA_TEST_CASE(async_active_switch_drop, "Test ServiceDisplay - async active switch drop", "[service][display][async]")
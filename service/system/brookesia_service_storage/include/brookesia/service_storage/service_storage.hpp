@@ -7,6 +7,7 @@
 
 #include <expected>
 #include <filesystem>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -98,7 +99,7 @@ private:
     bool on_init() override;
     void on_deinit() override;
     void on_function_batch_start(const std::vector<FunctionCall> &calls) override;
-    void on_function_batch_end() override;
+    void on_function_batch_end(FunctionBatchResult &result) override;
 
     std::expected<std::filesystem::path, std::string> resolve_file_system_path(const std::string &path);
 
@@ -134,6 +135,11 @@ private:
     std::vector<std::filesystem::path> file_system_roots_;
     std::unordered_set<std::filesystem::path> validated_batch_directories_;
     bool batch_path_validation_cache_enabled_ = false;
+    // Writes of a KV set batch, committed once per namespace when the batch ends
+    std::map<std::string, KeyValueMap> batch_kv_writes_;
+    // Namespace of each deferred set, in call order, so a failed commit can be reported on its own calls
+    std::vector<std::string> batch_kv_write_namespaces_;
+    bool batch_kv_write_deferred_ = false;
 
     std::vector<FunctionSchema> get_function_schemas() override
     {
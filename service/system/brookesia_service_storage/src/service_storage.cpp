@@ -811,6 +811,9 @@ void Storage::on_deinit()
     file_system_roots_.clear();
     validated_batch_directories_.clear();
     batch_path_validation_cache_enabled_ = false;
+    batch_kv_writes_.clear();
+    batch_kv_write_namespaces_.clear();
+    batch_kv_write_deferred_ = false;
 }
 
 void Storage::on_function_batch_start(const std::vector<FunctionCall> &calls)
@@ -825,12 +828,43 @@ void Storage::on_function_batch_start(const std::vector<FunctionCall> &calls)
     batch_path_validation_cache_enabled_ =
         !calls.empty() && std::all_of(calls.begin(), calls.end(), is_cacheable_call);
     validated_batch_directories_.clear();
+
+    // A batch made only of KV sets never reads back its own writes, so they can be merged and committed once
+    const auto set_name = BROOKESIA_DESCRIBE_ENUM_TO_STR(Helper::FunctionId::KVSet);
+    batch_kv_write_deferred_ = kv_iface_ && !calls.empty() &&
+    std::all_of(calls.begin(), calls.end(), [&set_name](const auto & call) {
+        return call.name == set_name;
+    });
+    batch_kv_writes_.clear();
+    batch_kv_write_namespaces_.clear();
 }
 
-void Storage::on_function_batch_end()
+void Storage::on_function_batch_end(FunctionBatchResult &result)
 {
     batch_path_validation_cache_enabled_ = false;
     validated_batch_directories_.clear();
+
+    batch_kv_write_deferred_ = false;
+    for (const auto &[nspace, key_value_map] : batch_kv_writes_) {
+        if (kv_iface_->set(nspace, key_value_map)) {
+            continue;
+        }
+        // The calls of this namespace already reported success, turn their results into the commit failure
+        const auto error_message = get_last_error_or_default(*kv_iface_, (boost::format(
+                                       "Failed to set key-value map in namespace '%1%'"
+                                   ) % nspace).str());
+        result.success = false;
+        const auto call_count = std::min(batch_kv_write_namespaces_.size(), result.results.size());
+        for (size_t i = 0; i < call_count; i++) {
+            if (batch_kv_write_namespaces_[i] != nspace) {
+                continue;
+            }
+            result.results[i].success = false;
+            result.results[i].error_message = error_message;
+        }
+    }
+    batch_kv_writes_.clear();
+    batch_kv_write_namespaces_.clear();
 }
 
 std::expected<std::filesystem::path, std::string> Storage::resolve_file_system_path(const std::string &path)
@@ -876,6 +910,16 @@ std::expected<void, std::string> Storage::function_set(const std::string &nspace
                                ).str());
     }
 
+    if (batch_kv_write_deferred_ && is_in_function_batch()) {
+        // Deferred calls run in call order and the batch stops at the first failure, so the index matches the results
+        batch_kv_write_namespaces_.push_back(nspace);
+        auto &pending_key_value_map = batch_kv_writes_[nspace];
+        for (auto &[key, value] : parsed_key_value_map) {
+            pending_key_value_map.insert_or_assign(key, std::move(value));
+        }
+        return {};
+    }
+
     if (!kv_iface_->set(nspace, parsed_key_value_map)) {
         return std::unexpected(get_last_error_or_default(*kv_iface_, (boost::format(
                                    "Failed to set key-value map in namespace '%1%'"
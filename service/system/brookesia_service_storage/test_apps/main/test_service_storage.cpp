@@ -163,6 +163,126 @@ BROOKESIA_TEST_CASE(basic_set_and_get, "Test ServiceStorage - basic set and get"
     }
 }
 
+BROOKESIA_TEST_CASE(batched_set, "Test ServiceStorage - batched set", "[service][storage][batch]")
+{
+    BROOKESIA_LOGI("=== Test ServiceStorage - batched set ===");
+
+    TEST_ASSERT_TRUE_MESSAGE(startup(), "Failed to startup");
+    lib_utils::FunctionGuard shutdown_guard([]() {
+        shutdown();
+    });
+
+    auto storage_service = service_manager.get_service(storage_helper::get_name().data());
+    TEST_ASSERT_NOT_NULL_MESSAGE(storage_service.get(), "Storage service should be registered");
+
+    const std::string test_namespace = "test_batch";
+    const auto set_name = BROOKESIA_DESCRIBE_ENUM_TO_STR(storage_helper::FunctionId::KVSet);
+    const auto nspace_param_name = BROOKESIA_DESCRIBE_TO_STR(storage_helper::FunctionKVSetParam::Nspace);
+    const auto pairs_param_name = BROOKESIA_DESCRIBE_TO_STR(storage_helper::FunctionKVSetParam::KeyValuePairs);
+    auto make_set_call = [&](const storage_helper::KeyValueMap & pairs) {
+        return service::FunctionCall{
+            .name = set_name,
+            .parameters = {
+                {nspace_param_name, test_namespace},
+                {pairs_param_name, BROOKESIA_DESCRIBE_TO_JSON(pairs).as_object()},
+            },
+        };
+    };
+
+    // Sets of one namespace are merged and committed once, later pairs overriding earlier ones
+    auto batch_result = storage_service->call_functions_sync({
+        make_set_call({{"first_key", 1}, {"shared_key", std::string("old")}}),
+        make_set_call({{"second_key", true}, {"shared_key", std::string("new")}}),
+    });
+    TEST_ASSERT_TRUE_MESSAGE(batch_result.success, "Batched set should succeed");
+    TEST_ASSERT_TRUE_MESSAGE(batch_result.results.size() == 2, "Batched set should report every item");
+
+    const auto keys = BROOKESIA_DESCRIBE_TO_JSON(
+                          std::vector<std::string>({"first_key", "second_key", "shared_key"})
+                      ).as_array();
+    service::FunctionParameterMap get_parameters = {
+        {BROOKESIA_DESCRIBE_TO_STR(storage_helper::FunctionKVGetParam::Nspace), test_namespace},
+        {BROOKESIA_DESCRIBE_TO_STR(storage_helper::FunctionKVGetParam::Keys), keys},
+    };
+    auto get_result = storage_service->call_function_sync(
+                          BROOKESIA_DESCRIBE_ENUM_TO_STR(storage_helper::FunctionId::KVGet), std::move(get_parameters)
+                      );
+    TEST_ASSERT_TRUE_MESSAGE(get_result.success, get_result.error_message.c_str());
+    TEST_ASSERT_TRUE(get_result.has_data());
+    TEST_ASSERT_TRUE(validate_get_result(get_result.data.value(), {"first_key", "second_key", "shared_key"}));
+
+    storage_helper::KeyValueMap pairs;
+    TEST_ASSERT_TRUE(BROOKESIA_DESCRIBE_FROM_JSON(std::get<boost::json::object>(get_result.data.value()), pairs));
+    TEST_ASSERT_EQUAL_STRING("new", std::get<std::string>(pairs["shared_key"]).c_str());
+
+    service::FunctionParameterMap erase_parameters = {
+        {BROOKESIA_DESCRIBE_TO_STR(storage_helper::FunctionKVEraseParam::Nspace), test_namespace},
+        {BROOKESIA_DESCRIBE_TO_STR(storage_helper::FunctionKVEraseParam::Keys), keys},
+    };
+    auto erase_result = storage_service->call_function_sync(
+                            BROOKESIA_DESCRIBE_ENUM_TO_STR(storage_helper::FunctionId::KVErase), std::move(erase_parameters)
+                        );
+    TEST_ASSERT_TRUE_MESSAGE(erase_result.success, erase_result.error_message.c_str());
+}
+
+BROOKESIA_TEST_CASE(
+    batched_set_commit_failure,
+    "Test ServiceStorage - batched set commit failure",
+    "[service][storage][batch]"
+)
+{
+    BROOKESIA_LOGI("=== Test ServiceStorage - batched set commit failure ===");
+
+    TEST_ASSERT_TRUE_MESSAGE(startup(), "Failed to startup");
+    lib_utils::FunctionGuard shutdown_guard([]() {
+        shutdown();
+    });
+
+    auto storage_service = service_manager.get_service(storage_helper::get_name().data());
+    TEST_ASSERT_NOT_NULL_MESSAGE(storage_service.get(), "Storage service should be registered");
+
+    const std::string valid_namespace = "test_batch";
+    // Longer than any backend accepts (NVS namespaces, file names), so only the commit of this namespace fails
+    const std::string invalid_namespace(200, 'n');
+    const auto set_name = BROOKESIA_DESCRIBE_ENUM_TO_STR(storage_helper::FunctionId::KVSet);
+    auto make_set_call = [&](const std::string & nspace, const storage_helper::KeyValueMap & pairs) {
+        return service::FunctionCall{
+            .name = set_name,
+            .parameters = {
+                {BROOKESIA_DESCRIBE_TO_STR(storage_helper::FunctionKVSetParam::Nspace), nspace},
+                {
+                    BROOKESIA_DESCRIBE_TO_STR(storage_helper::FunctionKVSetParam::KeyValuePairs),
+                    BROOKESIA_DESCRIBE_TO_JSON(pairs).as_object()
+                },
+            },
+        };
+    };
+
+    auto batch_result = storage_service->call_functions_sync({
+        make_set_call(valid_namespace, {{"first_key", 1}}),
+        make_set_call(invalid_namespace, {{"second_key", 2}}),
+        make_set_call(invalid_namespace, {{"third_key", 3}}),
+    });
+    TEST_ASSERT_FALSE_MESSAGE(batch_result.success, "Batched set should report the failed commit");
+    TEST_ASSERT_TRUE_MESSAGE(batch_result.results.size() == 3, "Batched set should keep one result per call");
+    TEST_ASSERT_TRUE_MESSAGE(batch_result.results[0].success, "The valid namespace should be committed");
+    TEST_ASSERT_FALSE_MESSAGE(batch_result.results[1].success, "The invalid namespace should fail");
+    TEST_ASSERT_FALSE_MESSAGE(batch_result.results[2].success, "The invalid namespace should fail");
+    TEST_ASSERT_FALSE(batch_result.results[1].error_message.empty());
+
+    service::FunctionParameterMap erase_parameters = {
+        {BROOKESIA_DESCRIBE_TO_STR(storage_helper::FunctionKVEraseParam::Nspace), valid_namespace},
+        {
+            BROOKESIA_DESCRIBE_TO_STR(storage_helper::FunctionKVEraseParam::Keys),
+            BROOKESIA_DESCRIBE_TO_JSON(std::vector<std::string>({"first_key"})).as_array()
+        },
+    };
+    auto erase_result = storage_service->call_function_sync(
+                            BROOKESIA_DESCRIBE_ENUM_TO_STR(storage_helper::FunctionId::KVErase), std::move(erase_parameters)
+                        );
+    TEST_ASSERT_TRUE_MESSAGE(erase_result.success, erase_result.error_message.c_str());
+}
+
 #if !defined(ESP_PLATFORM)
 BROOKESIA_TEST_CASE(
     pc_absolute_mount_paths,
@@ -116,6 +116,8 @@ public:
         gui::LivePreviewOptions gui_live_preview_options = {};
         /** Poll interval used by startup live preview in milliseconds. */
         int32_t gui_live_preview_poll_interval_ms = 100;
+        /** Delay before batched GUI binding updates reach the widgets, e.g. 16 for one frame; 0 disables batching. */
+        int32_t gui_binding_commit_interval_ms = 0;
     };
 
     /**
@@ -164,9 +166,17 @@ public:
     struct AppStartOptions {
         std::optional<gui::ViewFrame> launch_origin_frame;
     };
+    using AppStartHandler = std::function<void(std::expected<void, std::string>)>;
 
     std::expected<void, std::string> start_app(AppId app_id);
     std::expected<void, std::string> start_app(AppId app_id, const AppStartOptions &options);
+    // Does not wait for the app to start, `handler` receives the result in the app task group. The error is
+    // returned without calling `handler` if the start could not be scheduled.
+    std::expected<void, std::string> start_app_async(
+        AppId app_id,
+        const AppStartOptions &options,
+        AppStartHandler handler = {}
+    );
     std::expected<void, std::string> stop_app(AppId app_id);
     std::expected<void, std::string> pause_app(AppId app_id);
     std::expected<void, std::string> resume_app(AppId app_id);
@@ -450,6 +460,11 @@ private:
     friend class SystemGuiAccess;
 
     class Impl;
+    lib_utils::Coroutine<std::expected<void, std::string>> co_start_app(
+        AppId app_id,
+        AppStartOptions options,
+        bool can_suspend
+    );
     std::expected<void, std::string> show_next_message_dialog();
     std::expected<MessageDialogRequestId, std::string> enqueue_message_dialog(
         AppId app_id,
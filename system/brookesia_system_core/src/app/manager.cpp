@@ -200,6 +200,9 @@ std::expected<void, std::string> System::Impl::dispatch_action(
         return std::unexpected(record_result.error());
     }
     auto &record = *record_result.value();
+    if (record.start_suspended) {
+        return std::unexpected("App start is in progress");
+    }
     if (record.info.manifest.kind == AppKind::Native) {
         if (!record.native_app || !record.context) {
             return std::unexpected("Native app is not available");
@@ -226,6 +229,9 @@ std::expected<void, std::string> System::Impl::dispatch_event(
         return std::unexpected(record_result.error());
     }
     auto &record = *record_result.value();
+    if (record.start_suspended) {
+        return std::unexpected("App start is in progress");
+    }
     if (record.info.manifest.kind == AppKind::Native) {
         return {};
     }
@@ -458,6 +464,9 @@ std::expected<void, std::string> System::uninstall_app(AppId app_id)
         return std::unexpected(record_result.error());
     }
     auto &record = *record_result.value();
+    if (record.start_suspended) {
+        return std::unexpected("App start is in progress");
+    }
     if (record.info.state == AppState::Running || record.info.state == AppState::Paused) {
         auto stop_result = stop_app(app_id);
         if (!stop_result) {
@@ -536,6 +545,7 @@ std::expected<void, std::string> System::start_app(AppId app_id, const AppStartO
 {
     BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
     if (impl_->should_schedule_app_task()) {
+#if defined(__EMSCRIPTEN__)
         return impl_->run_task_sync<std::expected<void, std::string>>(
                    SYSTEM_APP_TASK_GROUP,
         [this, app_id, options]() {
@@ -543,14 +553,74 @@ std::expected<void, std::string> System::start_app(AppId app_id, const AppStartO
         },
         std::unexpected("Failed to post app start task")
                );
+#else
+        // Only the caller waits, the start does not hold an app worker while it runs in the GUI task group
+        auto result_promise = std::make_shared<boost::promise<std::expected<void, std::string>>>();
+        auto result_future = result_promise->get_future();
+        auto post_result = start_app_async(
+                               app_id,
+                               options,
+        [result_promise](std::expected<void, std::string> result) {
+            result_promise->set_value(std::move(result));
+        }
+                           );
+        if (!post_result) {
+            return post_result;
+        }
+        result_future.wait();
+        if (!result_future.has_value()) {
+            return std::unexpected("App start task was dropped");
+        }
+        return result_future.get();
+#endif
     }
+    return Impl::run_coroutine_now<std::expected<void, std::string>>(
+               co_start_app(app_id, options, false),
+               std::unexpected("App start suspended unexpectedly")
+           );
+}
+
+std::expected<void, std::string> System::start_app_async(
+    AppId app_id,
+    const AppStartOptions &options,
+    AppStartHandler handler
+)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+    auto deliver_result = [handler = std::move(handler)](std::expected<void, std::string> result) {
+        if (handler) {
+            handler(std::move(result));
+        }
+    };
+#if !defined(__EMSCRIPTEN__)
+    if (impl_->task_scheduler_ && impl_->task_scheduler_->is_running()) {
+        auto coroutine = Impl::co_forward_result(co_start_app(app_id, options, true), std::move(deliver_result));
+        if (!impl_->task_scheduler_->co_spawn(std::move(coroutine), SYSTEM_APP_TASK_GROUP)) {
+            return std::unexpected("Failed to post app start task");
+        }
+        return {};
+    }
+#endif
+    deliver_result(start_app(app_id, options));
+    return {};
+}
+
+lib_utils::Coroutine<std::expected<void, std::string>> System::co_start_app(
+    AppId app_id,
+    AppStartOptions options,
+    bool can_suspend
+)
+{
     auto record_result = impl_->get_record(app_id);
     if (!record_result) {
-        return std::unexpected(record_result.error());
+        co_return std::unexpected(record_result.error());
     }
     auto &record = *record_result.value();
     if (record.info.state == AppState::Running) {
-        return {};
+        co_return std::expected<void, std::string> {};
+    }
+    if (record.start_suspended) {
+        co_return std::unexpected("App start is already in progress");
     }
     const auto start_profile_started_at = SteadyClock::now();
     auto log_start_profile = [&](const char *stage, SteadyTimePoint stage_started_at) {
@@ -594,8 +664,12 @@ std::expected<void, std::string> System::start_app(AppId app_id, const AppStartO
     });
 
     const auto gui_prepare_started_at = SteadyClock::now();
-    auto gui_prepare_result = impl_->run_task_sync<std::expected<void, std::string>>(
+    // While suspended, the app task group runs other tasks, `start_suspended` keeps them off this record
+    record.start_suspended = can_suspend;
+    auto gui_prepare_result = co_await impl_->co_run_task<std::expected<void, std::string>>(
+                                  can_suspend,
                                   SYSTEM_GUI_TASK_GROUP,
+                                  SYSTEM_APP_TASK_GROUP,
     [this, &record]() -> std::expected<void, std::string> {
         const auto gui_profile_started_at = SteadyClock::now();
         auto log_gui_profile = [&](const char *stage, SteadyTimePoint stage_started_at)
@@ -685,13 +759,14 @@ std::expected<void, std::string> System::start_app(AppId app_id, const AppStartO
     },
     std::unexpected("Failed to post app GUI prepare task")
                               );
+    record.start_suspended = false;
     log_start_profile("gui_prepare", gui_prepare_started_at);
     if (!gui_prepare_result) {
         record.info.state = AppState::Error;
         record.info.last_error = gui_prepare_result.error();
         on_app_start_failed(record.info, gui_prepare_result.error());
         show_lifecycle_error_dialog(*this, record.info, "start", LIFECYCLE_ON_START, gui_prepare_result.error());
-        return gui_prepare_result;
+        co_return gui_prepare_result;
     }
 
     std::expected<void, std::string> start_result = {};
@@ -760,8 +835,11 @@ std::expected<void, std::string> System::start_app(AppId app_id, const AppStartO
     }
 
     if (!start_result) {
-        auto rollback_result = impl_->run_task_sync<std::expected<void, std::string>>(
+        record.start_suspended = can_suspend;
+        auto rollback_result = co_await impl_->co_run_task<std::expected<void, std::string>>(
+                                   can_suspend,
                                    SYSTEM_GUI_TASK_GROUP,
+                                   SYSTEM_APP_TASK_GROUP,
         [this, &record]() -> std::expected<void, std::string> {
             impl_->clear_pending_gui_bindings(record.info.app_id);
             impl_->unload_gui(record);
@@ -770,6 +848,7 @@ std::expected<void, std::string> System::start_app(AppId app_id, const AppStartO
         },
         std::unexpected("Failed to post app GUI rollback task")
                                );
+        record.start_suspended = false;
         if (!rollback_result) {
             BROOKESIA_LOGW("Failed to rollback app GUI after start failure: %1%", rollback_result.error());
         }
@@ -777,7 +856,7 @@ std::expected<void, std::string> System::start_app(AppId app_id, const AppStartO
         record.info.last_error = start_result.error();
         on_app_start_failed(record.info, start_result.error());
         show_lifecycle_error_dialog(*this, record.info, "start", LIFECYCLE_ON_START, start_result.error());
-        return start_result;
+        co_return start_result;
     }
     record.info.state = AppState::Running;
     impl_->active_app_id_ = app_id;
@@ -801,7 +880,7 @@ std::expected<void, std::string> System::start_app(AppId app_id, const AppStartO
             on_app_start_failed(record.info, hook_result.error());
         }
         show_lifecycle_error_dialog(*this, record.info, "start", LIFECYCLE_ON_START, hook_result.error());
-        return hook_result;
+        co_return hook_result;
     }
     impl_->hide_transient_overlay(launch_transition);
     transition_cleanup.release();
@@ -839,7 +918,7 @@ std::expected<void, std::string> System::start_app(AppId app_id, const AppStartO
         record.info.manifest.id,
         elapsed_ms_since(start_profile_started_at)
     );
-    return {};
+    co_return std::expected<void, std::string> {};
 }
 
 std::expected<void, std::string> System::stop_app(AppId app_id)
@@ -859,6 +938,9 @@ std::expected<void, std::string> System::stop_app(AppId app_id)
         return std::unexpected(record_result.error());
     }
     auto &record = *record_result.value();
+    if (record.start_suspended) {
+        return std::unexpected("App start is in progress");
+    }
     if (record.info.state == AppState::Stopped || record.info.state == AppState::Installed) {
         on_hide_app_loading(app_id);
         std::vector<KeyboardRequestId> keyboard_requests;
@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <expected>
 #include <chrono>
@@ -22,6 +23,7 @@
 #include "boost/thread/future.hpp"
 #if defined(__EMSCRIPTEN__)
 #include "brookesia/gui_interface/wasm/gui_task_queue.hpp"
+#include "brookesia/lib_utils/coroutine.hpp"
 #endif
 #include "brookesia/system_core/service/gui.hpp"
 #include "brookesia/system_core/service/system.hpp"
@@ -73,6 +75,8 @@ public:
         bool runtime_loaded = false;
         bool runtime_started = false;
         bool preload_dom = false;
+        // Set while a start waits in another task group, other app tasks may run meanwhile
+        bool start_suspended = false;
     };
 
     struct PendingTimer {
@@ -170,6 +174,51 @@ public:
         return result_future.get();
     }
 
+    // Runs `fn` in `group` from a coroutine running in `return_group`. With `can_suspend` the coroutine moves to
+    // `group` and back, so no worker of `return_group` waits for `fn`. Otherwise this is `run_task_sync()`.
+    template <typename Result, typename Fn>
+    lib_utils::Coroutine<Result> co_run_task(
+        bool can_suspend,
+        lib_utils::TaskScheduler::Group group,
+        lib_utils::TaskScheduler::Group return_group,
+        Fn fn,
+        Result post_error_result
+    )
+    {
+        if (!can_suspend) {
+            co_return run_task_sync<Result>(group, std::move(fn), std::move(post_error_result));
+        }
+        if (!co_await task_scheduler_->switch_to(group)) {
+            co_return std::move(post_error_result);
+        }
+        auto result = fn();
+        // Only fails once the scheduler stopped, the coroutine then goes on like `run_task_sync()` would
+        (void)co_await task_scheduler_->switch_to(return_group);
+        co_return result;
+    }
+
+    template <typename Result, typename Handler>
+    static lib_utils::Coroutine<void> co_forward_result(lib_utils::Coroutine<Result> coroutine, Handler handler)
+    {
+        handler(co_await std::move(coroutine));
+    }
+
+    // Runs a coroutine that never suspends, such as one only using `co_run_task()` without `can_suspend`, on the
+    // calling thread
+    template <typename Result>
+    static Result run_coroutine_now(lib_utils::Coroutine<Result> coroutine, Result suspended_result)
+    {
+        auto result = std::make_shared<std::optional<Result>>();
+        auto root = co_forward_result(std::move(coroutine), [result](Result value) {
+            result->emplace(std::move(value));
+        }).detach();
+        root.resume();
+        if (!result->has_value()) {
+            return std::move(suspended_result);
+        }
+        return std::move(**result);
+    }
+
     std::expected<void, std::string> post_gui_task(lib_utils::TaskScheduler::OnceTask task);
     std::expected<void, std::string> post_gui_input_task(lib_utils::TaskScheduler::OnceTask task);
 
@@ -209,6 +258,7 @@ public:
     void stop_live_preview_poll();
     void stop_live_preview_poll_if_idle();
     bool ensure_live_preview_poll_started();
+    void schedule_gui_binding_commit();
     void unregister_app_gui_resources(AppRecord &record);
     std::expected<void, std::string> register_app_gui_resources(AppRecord &record);
     void unregister_app_icon_resource(AppRecord &record);
@@ -306,6 +356,7 @@ public:
     std::map<AppId, PendingBindingBuffer> pending_gui_bindings_;
     std::set<gui::DocumentId::Value> live_preview_document_ids_;
     std::optional<lib_utils::TaskScheduler::TaskId> live_preview_poll_task_id_;
+    std::atomic<bool> gui_binding_commit_scheduled_ = false;
     StorageLayout storage_layout_;
     std::map<std::string, AppStoragePaths> app_storage_paths_cache_;
     GuiThemeLanguage gui_theme_language_snapshot_ {
@@ -493,6 +493,28 @@ bool System::Impl::ensure_live_preview_poll_started()
     return true;
 }
 
+void System::Impl::schedule_gui_binding_commit()
+{
+    if (!task_scheduler_ || gui_binding_commit_scheduled_.exchange(true)) {
+        return;
+    }
+    // Every binding update queued until this task runs is applied together, once per node
+    auto commit_task = [this]() {
+        gui_binding_commit_scheduled_ = false;
+        if (gui_runtime_) {
+            gui_runtime_->commit_binding_updates();
+        }
+    };
+    const auto delay_ms = std::max<int32_t>(1, config_.gui_binding_commit_interval_ms);
+    if (!task_scheduler_->post_delayed(std::move(commit_task), delay_ms, nullptr, SYSTEM_GUI_TASK_GROUP)) {
+        gui_binding_commit_scheduled_ = false;
+        BROOKESIA_LOGW("Failed to schedule GUI binding commit, applying pending bindings now");
+        if (gui_runtime_) {
+            gui_runtime_->commit_binding_updates();
+        }
+    }
+}
+
 
 std::expected<void, std::string> System::Impl::ensure_gui_loaded(AppRecord &record)
 {
@@ -75,6 +75,12 @@ std::expected<void, std::string> System::init(Config config)
         }
                               );
         impl_->gui_runtime_->set_view_debug_enabled(config.enable_gui_view_debug);
+        if (config.gui_binding_commit_interval_ms > 0) {
+            impl_->gui_runtime_->set_binding_batch_pending_handler([this](gui::DocumentId) {
+                impl_->schedule_gui_binding_commit();
+            });
+            impl_->gui_runtime_->set_binding_batching_enabled(true);
+        }
     }
     impl_->config_ = std::move(config);
     auto storage_path_resolver = [this](
@@ -148,9 +154,15 @@ std::expected<void, std::string> System::init(Config config)
     if (impl_->config_.start_service_manager && !service_manager.start()) {
         return std::unexpected("Failed to start ServiceManager");
     }
-    impl_->system_service_binding_ = service_manager.bind(BROOKESIA_SYSTEM_CORE_SERVICE_NAME);
-    impl_->gui_service_binding_ = service_manager.bind(BROOKESIA_SYSTEM_CORE_GUI_SERVICE_NAME);
-    impl_->timer_service_binding_ = service_manager.bind(BROOKESIA_SYSTEM_CORE_TIMER_SERVICE_NAME);
+    // The system services are independent of each other, so they start concurrently
+    auto system_service_bindings = service_manager.bind_parallel({
+        BROOKESIA_SYSTEM_CORE_SERVICE_NAME,
+        BROOKESIA_SYSTEM_CORE_GUI_SERVICE_NAME,
+        BROOKESIA_SYSTEM_CORE_TIMER_SERVICE_NAME,
+    });
+    impl_->system_service_binding_ = std::move(system_service_bindings[0]);
+    impl_->gui_service_binding_ = std::move(system_service_bindings[1]);
+    impl_->timer_service_binding_ = std::move(system_service_bindings[2]);
     if (!impl_->system_service_binding_.is_valid() || !impl_->gui_service_binding_.is_valid() ||
             !impl_->timer_service_binding_.is_valid()) {
         return std::unexpected("Failed to bind system services");
@@ -32,24 +32,15 @@ std::string resolve_resource_file(std::string_view root, std::string_view path)
     return (std::filesystem::path(root) / file).generic_string();
 }
 
-std::string bool_to_binding(bool value)
-{
-    return value ? "true" : "false";
-}
-
-std::string int_to_binding(int32_t value)
-{
-    return std::to_string(value);
-}
-
+// Numbers and flags are pushed as typed values, so the runtime applies them without a text round trip
 void add_binding(
-    std::vector<gui::BindingValueUpdate> &updates,
+    std::vector<gui::TypedBindingValueUpdate> &updates,
     std::string_view path,
     std::string_view key,
-    std::string value
+    gui::DataValue value
 )
 {
-    updates.push_back(gui::BindingValueUpdate{
+    updates.push_back(gui::TypedBindingValueUpdate{
         .absolute_path = std::string(path),
         .key = std::string(key),
         .value = std::move(value),
@@ -225,27 +216,27 @@ System::Impl::show_app_launch_transition(
         const int32_t final_icon_x = (std::max(screen_width, final_icon_size) - final_icon_size) / 2;
         const int32_t final_icon_y = (std::max(screen_height, final_icon_size) - final_icon_size) / 2;
 
-        std::vector<gui::BindingValueUpdate> updates;
-        add_binding(updates, config.surface_path, "x", int_to_binding(origin.x));
-        add_binding(updates, config.surface_path, "y", int_to_binding(origin.y));
-        add_binding(updates, config.surface_path, "width", int_to_binding(origin.width));
-        add_binding(updates, config.surface_path, "height", int_to_binding(origin.height));
+        std::vector<gui::TypedBindingValueUpdate> updates;
+        add_binding(updates, config.surface_path, "x", origin.x);
+        add_binding(updates, config.surface_path, "y", origin.y);
+        add_binding(updates, config.surface_path, "width", origin.width);
+        add_binding(updates, config.surface_path, "height", origin.height);
         const bool has_icon = !record.registered_icon_resource_id.empty();
         if (has_icon)
         {
             add_binding(updates, config.icon_path, "src", record.registered_icon_resource_id);
         }
-        add_binding(updates, config.icon_path, "hidden", bool_to_binding(!has_icon));
+        add_binding(updates, config.icon_path, "hidden", !has_icon);
         add_binding(updates, config.fallback_label_path, "text", record.info.manifest.name.empty() ? "?" :
                     record.info.manifest.name.substr(0, 1));
-        add_binding(updates, config.fallback_label_path, "hidden", bool_to_binding(has_icon));
+        add_binding(updates, config.fallback_label_path, "hidden", has_icon);
 
         const auto icon_box_path = std::filesystem::path(config.icon_path).parent_path().generic_string();
-        add_binding(updates, icon_box_path, "x", int_to_binding(origin.x));
-        add_binding(updates, icon_box_path, "y", int_to_binding(origin.y));
-        add_binding(updates, icon_box_path, "width", int_to_binding(origin.width));
-        add_binding(updates, icon_box_path, "height", int_to_binding(origin.height));
-        gui_runtime_->set_binding_values(*document_result, updates);
+        add_binding(updates, icon_box_path, "x", origin.x);
+        add_binding(updates, icon_box_path, "y", origin.y);
+        add_binding(updates, icon_box_path, "width", origin.width);
+        add_binding(updates, icon_box_path, "height", origin.height);
+        gui_runtime_->set_typed_binding_values(*document_result, updates);
 
         const auto duration = std::max<int32_t>(config.duration_ms, 0);
         (void)gui_runtime_->start_view_animation_with_result(
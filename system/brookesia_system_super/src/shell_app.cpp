@@ -984,17 +984,22 @@ void ShellApp::handle_launcher_event(const gui::Event &event)
     auto start_app = [this, app_id]() {
         const auto request_started_at = launch_request_started_at_;
         const auto app_start_started_at = SteadyClock::now();
-        auto result = owner_.start_app(app_id, core::System::AppStartOptions{});
-        const auto now = SteadyClock::now();
-        SYSTEM_SUPER_PROFILE_LOGI(
-            "Shell app launch profile: app_id(%1%), start_app_ms(%2%), total_ms(%3%)",
-            app_id,
-            elapsed_ms_since(app_start_started_at, now),
-            request_started_at.has_value() ? elapsed_ms_since(*request_started_at, now) : 0
-        );
         launch_request_started_at_.reset();
-        if (!result) {
-            BROOKESIA_LOGW("Failed to launch app: app_id(%1%), error(%2%)", app_id, result.error());
+        auto on_started = [app_id, request_started_at, app_start_started_at](std::expected<void, std::string> result) {
+            const auto now = SteadyClock::now();
+            SYSTEM_SUPER_PROFILE_LOGI(
+                "Shell app launch profile: app_id(%1%), start_app_ms(%2%), total_ms(%3%)",
+                app_id,
+                elapsed_ms_since(app_start_started_at, now),
+                request_started_at.has_value() ? elapsed_ms_since(*request_started_at, now) : 0
+            );
+            if (!result) {
+                BROOKESIA_LOGW("Failed to launch app: app_id(%1%), error(%2%)", app_id, result.error());
+            }
+        };
+        auto post_result = owner_.start_app_async(app_id, core::System::AppStartOptions{}, on_started);
+        if (!post_result) {
+            on_started(std::unexpected(post_result.error()));
         }
     };
     auto app = owner_.get_app(app_id);
@@ -1640,18 +1640,24 @@ void ShellApp::start_app_after_launch(core::AppId app_id)
     }
 
     const auto app_start_started_at = SteadyClock::now();
-    auto result = owner_.start_app(app_id, core::System::AppStartOptions{});
-    const auto app_start_ended_at = SteadyClock::now();
-    finish_launch_overlay();
-    SYSTEM_SUPER_PROFILE_LOGI(
-        "Shell app launch profile: app_id(%1%), pre_start_ms(%2%), start_app_ms(%3%), total_ms(%4%)",
-        app_id,
-        request_started_at.has_value() ? elapsed_ms_since(*request_started_at, app_start_started_at) : 0,
-        elapsed_ms_since(app_start_started_at, app_start_ended_at),
-        request_started_at.has_value() ? elapsed_ms_since(*request_started_at, app_start_ended_at) : 0
-    );
-    if (!result) {
-        BROOKESIA_LOGW("Failed to launch app: app_id(%1%), error(%2%)", app_id, result.error());
+    auto on_started = [this, app_id, request_started_at, app_start_started_at](std::expected<void, std::string> result) {
+        const auto app_start_ended_at = SteadyClock::now();
+        finish_launch_overlay();
+        SYSTEM_SUPER_PROFILE_LOGI(
+            "Shell app launch profile: app_id(%1%), pre_start_ms(%2%), start_app_ms(%3%), total_ms(%4%)",
+            app_id,
+            request_started_at.has_value() ? elapsed_ms_since(*request_started_at, app_start_started_at) : 0,
+            elapsed_ms_since(app_start_started_at, app_start_ended_at),
+            request_started_at.has_value() ? elapsed_ms_since(*request_started_at, app_start_ended_at) : 0
+        );
+        if (!result) {
+            BROOKESIA_LOGW("Failed to launch app: app_id(%1%), error(%2%)", app_id, result.error());
+        }
+    };
+    // The launch overlay stays up until the app has started, without holding the app task group meanwhile
+    auto post_result = owner_.start_app_async(app_id, core::System::AppStartOptions{}, on_started);
+    if (!post_result) {
+        on_started(std::unexpected(post_result.error()));
     }
 }
 
@@ -2,7 +2,7 @@
 # ESP Platform
 #
 idf_component_register(
-    SRCS ${COMPONENT_SRCS_C} ${COMPONENT_SRCS_CPP}
+    SRCS ${COMPONENT_SRCS_C} ${COMPONENT_SRCS_CPP} ${COMPONENT_SRCS_ASM}
     INCLUDE_DIRS ${COMPONENT_INCLUDE_DIRS}
     PRIV_INCLUDE_DIRS ${COMPONENT_PRIVATE_INCLUDE_DIRS}
     REQUIRES ${COMPONENT_REQUIRES}
@@ -0,0 +1,427 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "brookesia/lib_utils/task_scheduler.hpp"
+
+namespace esp_brookesia::lib_utils {
+
+namespace detail {
+
+/**
+ * @brief State shared by every `Coroutine` promise type.
+ */
+class CoroutinePromiseBase {
+public:
+    struct FinalAwaiter {
+        bool await_ready() noexcept
+        {
+            return false;
+        }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            auto &promise = handle.promise();
+            if (promise.continuation_) {
+                return promise.continuation_;
+            }
+            // Nobody awaits a detached coroutine, so it releases its own frame
+            if (promise.is_detached_) {
+                handle.destroy();
+            }
+
+            return std::noop_coroutine();
+        }
+
+        void await_resume() noexcept {}
+    };
+
+    std::suspend_always initial_suspend() noexcept
+    {
+        return {};
+    }
+
+    FinalAwaiter final_suspend() noexcept
+    {
+        return {};
+    }
+
+    void unhandled_exception() noexcept
+    {
+        exception_ = std::current_exception();
+    }
+
+    /**
+     * @brief Get the outermost coroutine of the await chain if it is detached.
+     *
+     * @return Handle of the detached root, or a null handle if the root is owned by a `Coroutine` object.
+     */
+    std::coroutine_handle<> get_detached_root() const
+    {
+        auto promise = this;
+        while (promise->parent_ != nullptr) {
+            promise = promise->parent_;
+        }
+
+        return promise->is_detached_ ? promise->self_ : std::coroutine_handle<>();
+    }
+
+    void rethrow_if_exception() const
+    {
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+    }
+
+    std::coroutine_handle<> self_;
+    std::coroutine_handle<> continuation_;
+    const CoroutinePromiseBase *parent_ = nullptr;
+    bool is_detached_ = false;
+    std::exception_ptr exception_;
+};
+
+template <typename Promise>
+std::coroutine_handle<> get_detached_root(std::coroutine_handle<Promise> handle)
+{
+    if constexpr (std::is_base_of_v<CoroutinePromiseBase, Promise>) {
+        return handle.promise().get_detached_root();
+    } else {
+        return {};
+    }
+}
+
+template <typename T>
+class CoroutinePromise: public CoroutinePromiseBase {
+public:
+    Coroutine<T> get_return_object() noexcept;
+
+    template <typename U>
+    void return_value(U &&value)
+    {
+        value_.emplace(std::forward<U>(value));
+    }
+
+    T take_value()
+    {
+        rethrow_if_exception();
+        return std::move(*value_);
+    }
+
+private:
+    std::optional<T> value_;
+};
+
+template <>
+class CoroutinePromise<void>: public CoroutinePromiseBase {
+public:
+    Coroutine<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+
+    void take_value()
+    {
+        rethrow_if_exception();
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Lazily started coroutine returning `T`.
+ *
+ * The body does not run until the coroutine is awaited with `co_await` or started with
+ * `TaskScheduler::co_spawn()`. Exceptions thrown by the body are rethrown to the awaiting coroutine.
+ *
+ * @tparam T Result type, `void` by default.
+ */
+template <typename T>
+class [[nodiscard]] Coroutine {
+public:
+    using promise_type = detail::CoroutinePromise<T>;
+
+    explicit Coroutine(std::coroutine_handle<promise_type> handle) noexcept
+        : handle_(handle)
+    {}
+
+    Coroutine(const Coroutine &) = delete;
+    Coroutine &operator=(const Coroutine &) = delete;
+
+    Coroutine(Coroutine &&other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr))
+    {}
+
+    Coroutine &operator=(Coroutine &&other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    ~Coroutine()
+    {
+        reset();
+    }
+
+    /**
+     * @brief Check whether the object owns a coroutine.
+     */
+    bool is_valid() const noexcept
+    {
+        return static_cast<bool>(handle_);
+    }
+
+    /**
+     * @brief Give up ownership of the coroutine frame, marking it as detached.
+     *
+     * A detached coroutine destroys its own frame when it finishes.
+     *
+     * @return Handle of the coroutine, or a null handle if the object is empty.
+     */
+    std::coroutine_handle<> detach() noexcept
+    {
+        if (!handle_) {
+            return {};
+        }
+        handle_.promise().is_detached_ = true;
+
+        return std::exchange(handle_, nullptr);
+    }
+
+    class Awaiter {
+    public:
+        explicit Awaiter(std::coroutine_handle<promise_type> handle) noexcept
+            : handle_(handle)
+        {}
+
+        bool await_ready() const noexcept
+        {
+            return !handle_ || handle_.done();
+        }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> caller) noexcept
+        {
+            auto &promise = handle_.promise();
+            promise.continuation_ = caller;
+            if constexpr (std::is_base_of_v<detail::CoroutinePromiseBase, Promise>) {
+                promise.parent_ = &caller.promise();
+            }
+            return handle_;
+        }
+
+        T await_resume()
+        {
+            return handle_.promise().take_value();
+        }
+
+    private:
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    Awaiter operator co_await() && noexcept
+    {
+        return Awaiter(handle_);
+    }
+
+private:
+    void reset() noexcept
+    {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = nullptr;
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail {
+
+template <typename T>
+Coroutine<T> CoroutinePromise<T>::get_return_object() noexcept
+{
+    auto handle = std::coroutine_handle<CoroutinePromise<T>>::from_promise(*this);
+    self_ = handle;
+    return Coroutine<T>(handle);
+}
+
+inline Coroutine<void> CoroutinePromise<void>::get_return_object() noexcept
+{
+    auto handle = std::coroutine_handle<CoroutinePromise<void>>::from_promise(*this);
+    self_ = handle;
+    return Coroutine<void>(handle);
+}
+
+} // namespace detail
+
+/**
+ * @brief Copyable callable that resumes a suspended coroutine at most once.
+ *
+ * When the last copy is destroyed without resuming, for example because the scheduler was stopped before the
+ * posted task ran, the detached root of the await chain is destroyed so that its frames do not leak.
+ */
+class CoroutineResumer {
+public:
+    CoroutineResumer(std::coroutine_handle<> handle, std::coroutine_handle<> detached_root)
+        : state_(std::make_shared<State>(handle, detached_root))
+    {}
+
+    /**
+     * @brief Resume the coroutine, `on_resume` runs first and only if this call wins.
+     */
+    template <typename F>
+    void operator()(F &&on_resume) const
+    {
+        if (state_->is_done.exchange(true)) {
+            return;
+        }
+        std::forward<F>(on_resume)();
+        state_->handle.resume();
+    }
+
+    void operator()() const
+    {
+        (*this)([]() {});
+    }
+
+    /**
+     * @brief Give up resuming, the coroutine is neither resumed nor destroyed by this resumer.
+     */
+    void cancel() const
+    {
+        state_->is_done.store(true);
+    }
+
+private:
+    struct State {
+        State(std::coroutine_handle<> handle, std::coroutine_handle<> detached_root)
+            : handle(handle)
+            , detached_root(detached_root)
+        {}
+
+        ~State()
+        {
+            if (!is_done.load() && detached_root) {
+                detached_root.destroy();
+            }
+        }
+
+        std::coroutine_handle<> handle;
+        std::coroutine_handle<> detached_root;
+        std::atomic<bool> is_done{false};
+    };
+
+    std::shared_ptr<State> state_;
+};
+
+/**
+ * @brief Awaitable returned by `TaskScheduler::sleep()` and `TaskScheduler::switch_to()`.
+ *
+ * `co_await` yields `true` once the coroutine runs again on a scheduler worker, or `false` without suspending if
+ * the scheduler refused the task (e.g. it is not running).
+ */
+class SchedulerAwaiter {
+public:
+    SchedulerAwaiter(TaskScheduler &scheduler, TaskScheduler::Group group, int delay_ms, bool is_switch)
+        : scheduler_(scheduler)
+        , group_(std::move(group))
+        , delay_ms_(delay_ms)
+        , is_switch_(is_switch)
+    {}
+
+    bool await_ready() const;
+
+    template <typename Promise>
+    bool await_suspend(std::coroutine_handle<Promise> handle)
+    {
+        return suspend(handle, detail::get_detached_root(handle));
+    }
+
+    bool await_resume() const noexcept
+    {
+        return is_successful_;
+    }
+
+private:
+    bool suspend(std::coroutine_handle<> handle, std::coroutine_handle<> detached_root);
+
+    TaskScheduler &scheduler_;
+    TaskScheduler::Group group_;
+    int delay_ms_ = 0;
+    bool is_switch_ = false;
+    // Only cleared when scheduling fails, the resumed coroutine may read it before `suspend()` returns
+    bool is_successful_ = true;
+};
+
+/**
+ * @brief Awaitable adapting a callback based asynchronous operation.
+ *
+ * `starter` launches the operation and receives the completion callback, it returns `false` if the operation could
+ * not be started, in which case `co_await` yields `fallback` without suspending. The coroutine resumes on the
+ * thread that invokes the completion callback.
+ *
+ * @tparam T Result type delivered by the completion callback.
+ */
+template <typename T>
+class CallbackAwaiter {
+public:
+    using Completion = std::function<void(T)>;
+    using Starter = std::function<bool(Completion)>;
+
+    CallbackAwaiter(Starter starter, T fallback)
+        : starter_(std::move(starter))
+        , fallback_(std::move(fallback))
+    {}
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template <typename Promise>
+    bool await_suspend(std::coroutine_handle<Promise> handle)
+    {
+        CoroutineResumer resumer(handle, detail::get_detached_root(handle));
+        // `this` lives in the suspended coroutine frame, it must not be touched once the operation is started
+        auto completion = [this, resumer](T value) {
+            resumer([this, &value]() {
+                result_.emplace(std::move(value));
+            });
+        };
+        // The completion may resume (and finish) the coroutine before the starter returns, so call a local copy
+        auto starter = std::move(starter_);
+        if (!starter(std::move(completion))) {
+            resumer.cancel();
+            result_.emplace(std::move(fallback_));
+            return false;
+        }
+
+        return true;
+    }
+
+    T await_resume()
+    {
+        return std::move(*result_);
+    }
+
+private:
+    Starter starter_;
+    T fallback_;
+    std::optional<T> result_;
+};
+
+} // namespace esp_brookesia::lib_utils
@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "brookesia/lib_utils/describe_helpers.hpp"
+
+namespace esp_brookesia::lib_utils {
+
+/**
+ * @brief Pixel layouts handled by the conversion kernels.
+ */
+enum class PixelFormat : uint8_t {
+    RGB565,         ///< 16-bit, low byte first, as LVGL and the Display service store it
+    RGB565Swapped,  ///< 16-bit, high byte first, as SPI/I80 panels expect it
+    RGB888,         ///< 24-bit, bytes in B, G, R order
+    ARGB8888,       ///< 32-bit native word, bytes in B, G, R, A order on little-endian hosts
+    Max,
+};
+BROOKESIA_DESCRIBE_ENUM(PixelFormat, RGB565, RGB565Swapped, RGB888, ARGB8888, Max);
+
+/**
+ * @brief Clockwise rotation applied while converting a rectangle.
+ */
+enum class PixelRotation : uint8_t {
+    None,
+    Rotate90,
+    Rotate180,
+    Rotate270,
+    Max,
+};
+BROOKESIA_DESCRIBE_ENUM(PixelRotation, None, Rotate90, Rotate180, Rotate270, Max);
+
+/**
+ * @brief Get the size of one pixel, or 0 for an invalid format.
+ */
+size_t get_pixel_bytes(PixelFormat format);
+
+/**
+ * @brief Get the name of the vector kernels compiled in, `"sse2"`, `"neon"`, `"pie"` or `"scalar"`.
+ */
+const char *get_pixel_convert_kernel_name();
+
+/**
+ * @brief Convert a run of tightly packed pixels.
+ *
+ * Widening from RGB565 replicates the high bits into the low ones, so 0x1F becomes 0xFF. Narrowing truncates,
+ * and the alpha channel is set to 0xFF on output and ignored on input.
+ *
+ * @param[in] src Source pixels.
+ * @param[in] src_format Format of @p src.
+ * @param[out] dst Destination pixels, must not overlap @p src unless both formats are the same size.
+ * @param[in] dst_format Format of @p dst.
+ * @param[in] count Number of pixels.
+ * @return true on success, false if a format is invalid or a pointer is null.
+ */
+bool convert_pixels(const uint8_t *src, PixelFormat src_format, uint8_t *dst, PixelFormat dst_format, size_t count);
+
+/**
+ * @brief Strided image used by @ref convert_pixel_rect.
+ */
+struct PixelRect {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    size_t stride_bytes = 0;  ///< 0 means tightly packed
+    PixelFormat format = PixelFormat::RGB565;
+};
+
+/**
+ * @brief Convert a rectangle and optionally rotate it.
+ *
+ * @param[in] src Top-left pixel of the source rectangle.
+ * @param[in] src_rect Size, stride and format of the source.
+ * @param[out] dst Top-left pixel of the destination rectangle, must not overlap @p src.
+ * @param[in] dst_stride_bytes Stride of the destination, 0 means tightly packed.
+ * @param[in] dst_format Format of the destination.
+ * @param[in] rotation Rotation applied, the destination is `height x width` for 90 and 270 degrees.
+ * @return true on success.
+ */
+bool convert_pixel_rect(
+    const uint8_t *src, const PixelRect &src_rect, uint8_t *dst, size_t dst_stride_bytes, PixelFormat dst_format,
+    PixelRotation rotation = PixelRotation::None
+);
+
+} // namespace esp_brookesia::lib_utils
@@ -146,48 +146,59 @@ public:
     signal(signal &&other) noexcept
     {
         std::lock_guard<std::mutex> lock(other.mutex_);
-        slots_ = std::move(other.slots_);
+        slots_.store(other.slots_.exchange(nullptr, std::memory_order_acq_rel), std::memory_order_release);
     }
 
     signal &operator=(signal &&other) noexcept
     {
         if (this != &other) {
             std::scoped_lock lock(mutex_, other.mutex_);
-            slots_ = std::move(other.slots_);
+            slots_.store(other.slots_.exchange(nullptr, std::memory_order_acq_rel), std::memory_order_release);
         }
         return *this;
     }
 
     /**
      * @brief Register a slot and return a handle controlling its lifetime.
+     *
+     * The slot list is copied and republished, so the cost grows with the number of slots.
      */
     connection connect(slot_type slot)
     {
-        auto control = std::make_shared<signal_detail::SlotControl>();
-        auto entry = std::make_shared<Slot>(Slot{control, std::move(slot)});
+        auto entry = std::make_shared<Slot>(std::move(slot));
         std::lock_guard<std::mutex> lock(mutex_);
-        slots_.push_back(std::move(entry));
-        return connection{control};
+        auto current = slots_.load(std::memory_order_acquire);
+        auto updated = std::make_shared<SlotList>();
+        updated->reserve((current ? current->size() : 0) + 1);
+        if (current) {
+            for (const auto &item : *current) {
+                if (item->connected.load(std::memory_order_acquire)) {
+                    updated->push_back(item);
+                }
+            }
+        }
+        updated->push_back(entry);
+        slots_.store(std::move(updated), std::memory_order_release);
+        return connection{std::shared_ptr<signal_detail::SlotControl>(std::move(entry))};
     }
 
     /**
      * @brief Invoke every connected slot.
      *
-     * A snapshot of the slot list is taken under the lock so slots may safely
-     * connect/disconnect (including themselves) during emission, and so
-     * emission is safe against concurrent mutation from other threads.
+     * The slot list is an immutable snapshot published by `connect()`, so emission is a single atomic load without
+     * locking or allocation. Slots may safely connect/disconnect (including themselves) during emission, a slot
+     * disconnected meanwhile is skipped, one connected meanwhile is first invoked by the next emission.
      */
     void operator()(Args... args) const
     {
-        std::vector<std::shared_ptr<Slot>> snapshot;
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            snapshot = slots_;
+        auto snapshot = slots_.load(std::memory_order_acquire);
+        if (!snapshot) {
+            return;
         }
 
         bool stale = false;
-        for (const auto &entry : snapshot) {
-            if (entry->control->connected.load(std::memory_order_acquire)) {
+        for (const auto &entry : *snapshot) {
+            if (entry->connected.load(std::memory_order_acquire)) {
                 entry->fn(args...);
             } else {
                 stale = true;
@@ -205,10 +216,13 @@ public:
     void disconnect_all_slots()
     {
         std::lock_guard<std::mutex> lock(mutex_);
-        for (const auto &entry : slots_) {
-            entry->control->connected.store(false, std::memory_order_release);
+        auto current = slots_.exchange(nullptr, std::memory_order_acq_rel);
+        if (!current) {
+            return;
+        }
+        for (const auto &entry : *current) {
+            entry->connected.store(false, std::memory_order_release);
         }
-        slots_.clear();
     }
 
     /**
@@ -216,10 +230,14 @@ public:
      */
     std::size_t num_slots() const
     {
-        std::lock_guard<std::mutex> lock(mutex_);
+        auto snapshot = slots_.load(std::memory_order_acquire);
+        if (!snapshot) {
+            return 0;
+        }
+
         std::size_t count = 0;
-        for (const auto &entry : slots_) {
-            if (entry->control->connected.load(std::memory_order_acquire)) {
+        for (const auto &entry : *snapshot) {
+            if (entry->connected.load(std::memory_order_acquire)) {
                 ++count;
             }
         }
@@ -232,25 +250,44 @@ public:
     }
 
 private:
-    struct Slot {
-        std::shared_ptr<signal_detail::SlotControl> control;
+    // The slot doubles as the control block shared with its connections, one allocation per `connect()`
+    struct Slot: signal_detail::SlotControl {
+        explicit Slot(slot_type slot)
+            : fn(std::move(slot))
+        {}
+
         slot_type fn;
     };
+    using SlotList = std::vector<std::shared_ptr<Slot>>;
+    using SlotListPtr = std::shared_ptr<const SlotList>;
+
 
     void prune() const
     {
         std::lock_guard<std::mutex> lock(mutex_);
-        for (auto it = slots_.begin(); it != slots_.end();) {
-            if ((*it)->control->connected.load(std::memory_order_acquire)) {
-                ++it;
-            } else {
-                it = slots_.erase(it);
+        auto current = slots_.load(std::memory_order_acquire);
+        if (!current) {
+            return;
+        }
+
+        auto updated = std::make_shared<SlotList>();
+        updated->reserve(current->size());
+        for (const auto &entry : *current) {
+            if (entry->connected.load(std::memory_order_acquire)) {
+                updated->push_back(entry);
             }
         }
+        // Another emission may have pruned already
+        if (updated->size() == current->size()) {
+            return;
+        }
+        slots_.store(updated->empty() ? nullptr : SlotListPtr(std::move(updated)), std::memory_order_release);
     }
 
+    // Only serializes writers, emission never takes it
     mutable std::mutex mutex_;
-    mutable std::vector<std::shared_ptr<Slot>> slots_;
+    // Copy-on-write list, `nullptr` when empty
+    mutable std::atomic<SlotListPtr> slots_;
 };
 
 } // namespace esp_brookesia::lib_utils
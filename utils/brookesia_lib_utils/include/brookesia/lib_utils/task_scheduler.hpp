@@ -5,15 +5,22 @@
  */
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <new>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <map>
+#include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 #include "brookesia/lib_utils/macro_configs.h"
 
@@ -39,6 +46,9 @@
 namespace esp_brookesia::lib_utils {
 
 struct WasmTimerContext;
+class SchedulerAwaiter;
+template <typename T = void>
+class Coroutine;
 
 /**
  * @brief Asynchronous task scheduler built on top of `boost::asio::io_context`.
@@ -95,15 +105,96 @@ public:
         Finished   ///< Task finished execution or is no longer tracked.
     };
 
+    /**
+     * @brief Strategy used by worker threads to wait for new work.
+     */
+    enum class WorkerMode {
+        Polling,  ///< Poll the `io_context` and sleep `worker_poll_interval_ms` when idle.
+        Blocking, ///< Block in `io_context::run_one()` and wake up as soon as work is posted.
+        /**
+         * Each worker owns a local task deque and idle workers steal immediate tasks from busy ones. Serial groups
+         * stick to one worker and are never stolen, timer tasks are still dispatched through the `io_context`.
+         */
+        WorkStealing,
+    };
+
+    /**
+     * @brief Timer implementation used by delayed and periodic tasks.
+     */
+    enum class TimerBackend {
+        Asio,  ///< One `boost::asio::steady_timer` per task.
+        Wheel, ///< Shared hierarchical timer wheel; tasks due in the same tick fire from a single wake-up.
+    };
+
+    /**
+     * @brief Priority class of a task group.
+     *
+     * Immediate tasks of a higher class run before queued tasks of a lower class. Delayed and periodic tasks are
+     * dispatched by their timers and are not reordered.
+     */
+    enum class Priority {
+        Realtime,    ///< Latency critical work such as display refresh.
+        Interactive, ///< Work that directly follows user input.
+        Normal,      ///< Default class of tasks without a group or without a configured priority.
+        Background,  ///< Bulk work such as storage or network transfers.
+        Max,         ///< Sentinel value.
+    };
+
+    /**
+     * @brief Queue statistics of one priority class.
+     */
+    struct PriorityStatistics {
+        size_t queue_depth{0};     ///< Number of tasks currently waiting in this class.
+        size_t max_queue_depth{0}; ///< Largest observed number of waiting tasks.
+        size_t promoted_tasks{0};  ///< Number of tasks run ahead of higher classes by starvation protection.
+    };
+
     /**
      * @brief Aggregate counters for task execution.
      */
     struct Statistics {
-        size_t total_tasks{0};      ///< Total number of tasks ever scheduled.
-        size_t completed_tasks{0};  ///< Number of tasks that completed successfully.
-        size_t failed_tasks{0};     ///< Number of tasks that finished unsuccessfully.
-        size_t canceled_tasks{0};   ///< Number of tasks canceled before completion.
-        size_t suspended_tasks{0};  ///< Number of tasks currently suspended.
+        size_t total_tasks{0};          ///< Total number of tasks ever scheduled.
+        size_t completed_tasks{0};      ///< Number of tasks that completed successfully.
+        size_t failed_tasks{0};         ///< Number of tasks that finished unsuccessfully.
+        size_t canceled_tasks{0};       ///< Number of tasks canceled before completion.
+        size_t suspended_tasks{0};      ///< Number of tasks currently suspended.
+        size_t latency_samples{0};      ///< Number of immediate tasks sampled for post-to-execute latency.
+        uint64_t total_latency_us{0};   ///< Sum of sampled post-to-execute latencies, in microseconds.
+        uint64_t max_latency_us{0};     ///< Largest sampled post-to-execute latency, in microseconds.
+        size_t handle_allocations{0};   ///< Number of task handles allocated from the heap.
+        size_t handle_reuses{0};        ///< Number of task handles recycled from the handle pool.
+        size_t stolen_tasks{0};         ///< Number of tasks executed by a worker that stole them.
+        size_t closure_heap_fallbacks{0}; ///< Number of posted closures too large to be stored in their task handle.
+        std::vector<PriorityStatistics> priority_stats; ///< Queue statistics indexed by `Priority`.
+    };
+
+    /**
+     * @brief Upper bounds in microseconds of the latency histogram buckets.
+     *
+     * Bucket `i` counts samples not larger than `LATENCY_HISTOGRAM_BOUNDS_US[i]` and larger than the previous bound,
+     * one extra trailing bucket counts all larger samples.
+     */
+    static constexpr std::array<uint64_t, 9> LATENCY_HISTOGRAM_BOUNDS_US = {
+        50, 100, 500, 1000, 5000, 10000, 50000, 100000, 500000
+    };
+    static constexpr size_t LATENCY_HISTOGRAM_BUCKET_NUM = LATENCY_HISTOGRAM_BOUNDS_US.size() + 1;
+
+    /**
+     * @brief Timing statistics of the tasks of one group.
+     *
+     * Queue wait is the time from `post()` to execution for immediate tasks, and the time from timer expiry to
+     * execution for delayed and periodic tasks.
+     */
+    struct GroupStatistics {
+        Group group;                              ///< Group name, empty for tasks posted without a group.
+        size_t executed_tasks{0};                 ///< Number of measured executions.
+        std::vector<size_t> queue_wait_histogram; ///< Queue wait samples per `LATENCY_HISTOGRAM_BOUNDS_US` bucket.
+        uint64_t total_queue_wait_us{0};          ///< Sum of queue waits, in microseconds.
+        uint64_t max_queue_wait_us{0};            ///< Largest queue wait, in microseconds.
+        std::vector<size_t> execution_histogram;  ///< Execution time samples per `LATENCY_HISTOGRAM_BOUNDS_US` bucket.
+        uint64_t total_execution_us{0};           ///< Sum of execution times, in microseconds.
+        uint64_t max_execution_us{0};             ///< Largest execution time, in microseconds.
+        size_t periodic_overruns{0};              ///< Number of periodic executions longer than their interval.
     };
 
     /**
@@ -149,6 +240,36 @@ public:
             }
         };
         size_t worker_poll_interval_ms = 10;             ///< Worker polling interval in milliseconds.
+        /**
+         * @brief Wait strategy of the worker threads.
+         *
+         * `WorkerMode::Blocking` removes the idle polling delay between `post()` and execution.
+         * `worker_poll_interval_ms` is the idle sleep in `WorkerMode::Polling`. In `WorkerMode::WorkStealing` one
+         * idle worker waits in the `io_context` so that timer tasks run as soon as they are due, and the others
+         * check for timer tasks at least every `worker_poll_interval_ms`.
+         */
+        WorkerMode worker_mode = WorkerMode::Polling;
+        /**
+         * @brief Maximum number of released task handles kept for reuse.
+         *
+         * Finished tasks return their handle memory to this pool, so steady posting does not hit the heap.
+         * Set to `0` to disable pooling.
+         */
+        size_t handle_pool_size = 32;
+        /**
+         * @brief Timer implementation of delayed and periodic tasks.
+         *
+         * `TimerBackend::Wheel` rounds deadlines up to the next `timer_wheel_tick_ms`, trading timer resolution for
+         * a constant per-tick cost when many timers are active. It only wakes up at ticks with due timers.
+         */
+        TimerBackend timer_backend = TimerBackend::Asio;
+        size_t timer_wheel_tick_ms = 10;                ///< Tick length of the timer wheel in milliseconds.
+        /**
+         * @brief Longest time in milliseconds a queued task waits behind higher priority classes.
+         *
+         * Once the oldest task of a lower class has waited this long, it runs before newer higher priority tasks.
+         */
+        size_t priority_starvation_timeout_ms = 100;
         /**
          * @brief Optional global pre-execute callback applied to every task.
          *
@@ -188,12 +309,18 @@ public:
          * @brief Optional group post-execute callback applied to all tasks in the group.
          */
         PostExecuteCallback post_execute_callback = nullptr;
+        /**
+         * @brief Priority class of immediate tasks posted to this group.
+         *
+         * Child groups sharing a parent's serial context use the parent's priority in `WorkerMode::WorkStealing` mode.
+         */
+        Priority priority = Priority::Normal;
     };
 
     /**
      * @brief Construct an idle task scheduler.
      */
-    TaskScheduler() = default;
+    TaskScheduler();
     /**
      * @brief Stop the scheduler and release its resources.
      */
@@ -306,6 +433,25 @@ public:
      */
     bool dispatch(OnceTask task, TaskId *id = nullptr, const Group &group = "");
 
+    /**
+     * @brief Dispatch any callable for immediate execution when possible.
+     *
+     * Unlike the `OnceTask` overload, the callable is not wrapped in a `std::function`. It is stored in the pooled
+     * task handle when it fits, see `Statistics::closure_heap_fallbacks`.
+     *
+     * @param[in] task Callable to execute, invoked once without arguments.
+     * @param[out] id Optional pointer that receives the assigned task ID.
+     * @param[in] group Optional task group name.
+     *
+     * @return `true` if the task was scheduled successfully, or `false` otherwise.
+     */
+    template <typename F>
+    requires (!std::is_same_v<std::decay_t<F>, OnceTask> && std::is_invocable_v<std::decay_t<F> &>)
+    bool dispatch(F &&task, TaskId *id = nullptr, const Group &group = "")
+    {
+        return post_internal(TaskClosure(std::forward<F>(task)), id, group, true);
+    }
+
     /**
      * @brief Post a task to the scheduler queue.
      *
@@ -317,6 +463,25 @@ public:
      */
     bool post(OnceTask task, TaskId *id = nullptr, const Group &group = "");
 
+    /**
+     * @brief Post any callable to the scheduler queue.
+     *
+     * Unlike the `OnceTask` overload, the callable is not wrapped in a `std::function`. It is stored in the pooled
+     * task handle when it fits, see `Statistics::closure_heap_fallbacks`.
+     *
+     * @param[in] task Callable to execute, invoked once without arguments.
+     * @param[out] id Optional pointer that receives the assigned task ID.
+     * @param[in] group Optional task group name.
+     *
+     * @return `true` if the task was scheduled successfully, or `false` otherwise.
+     */
+    template <typename F>
+    requires (!std::is_same_v<std::decay_t<F>, OnceTask> && std::is_invocable_v<std::decay_t<F> &>)
+    bool post(F &&task, TaskId *id = nullptr, const Group &group = "")
+    {
+        return post_internal(TaskClosure(std::forward<F>(task)), id, group, false);
+    }
+
     /**
      * @brief Schedule a one-shot task to run after a delay.
      *
@@ -342,6 +507,42 @@ public:
      */
     bool post_periodic(PeriodicTask task, int interval_ms, TaskId *id = nullptr, const Group &group = "");
 
+    /**
+     * @brief Suspend the awaiting coroutine for a delay without blocking a worker.
+     *
+     * Usage: `co_await scheduler.sleep(100);`. The coroutine resumes on a scheduler worker, serialized
+     * with `group` when it is configured as a strand. Defined in `brookesia/lib_utils/coroutine.hpp`.
+     *
+     * @param[in] delay_ms Delay before resuming, in milliseconds.
+     * @param[in] group Optional task group name the coroutine resumes in.
+     * @return Awaitable yielding `true` after the delay, or `false` immediately when the resume could not be scheduled.
+     */
+    SchedulerAwaiter sleep(int delay_ms, const Group &group = "");
+
+    /**
+     * @brief Move the awaiting coroutine onto a task group.
+     *
+     * Usage: `co_await scheduler.switch_to("ui");`. No suspension happens when the calling thread already
+     * executes in the group, an empty group switches to any scheduler worker.
+     *
+     * @param[in] group Task group name.
+     * @return Awaitable yielding `true` once running in the group, or `false` when the switch could not be scheduled.
+     */
+    SchedulerAwaiter switch_to(const Group &group);
+
+    /**
+     * @brief Start a coroutine detached from the caller.
+     *
+     * The coroutine starts on a scheduler worker and releases its frame when it finishes. Exceptions escaping
+     * the coroutine are logged. Coroutines still suspended when the scheduler stops are destroyed without
+     * being resumed.
+     *
+     * @param[in] coroutine Coroutine to start.
+     * @param[in] group Optional task group name the coroutine starts in.
+     * @return `true` if the coroutine was scheduled successfully, or `false` otherwise.
+     */
+    bool co_spawn(Coroutine<void> coroutine, const Group &group = "");
+
     /**
      * @brief Post multiple one-shot tasks as a batch.
      *
@@ -503,6 +704,23 @@ public:
      */
     Statistics get_statistics() const;
 
+    /**
+     * @brief Get the timing statistics of ungrouped tasks, configured groups and groups that currently have tasks.
+     *
+     * Statistics of a group that was never configured are dropped once its last task is removed.
+     *
+     * @return Statistics of each group, ordered by group name.
+     */
+    std::vector<GroupStatistics> get_group_statistics() const;
+
+    /**
+     * @brief Get the timing statistics of one group.
+     *
+     * @param[in] group Group name, empty for tasks posted without a group.
+     * @return Statistics of the group, or `std::nullopt` if the group is neither configured nor active.
+     */
+    std::optional<GroupStatistics> get_group_statistics(const Group &group) const;
+
     /**
      * @brief Get a shared executor handle for the underlying `io_context`.
      *
@@ -534,36 +752,266 @@ public:
     }
 
     /**
-     * @brief Reset all accumulated statistics counters to zero.
+     * @brief Reset all accumulated statistics counters, including group statistics, to zero.
      */
     void reset_statistics();
 
 private:
     friend struct WasmTimerContext;
 
+#if !BROOKESIA_LIB_UTILS_USE_WASM_SINGLE_THREAD_SCHEDULER
+    // Timer of a delayed or periodic task, backed either by a `steady_timer` or by `TimerWheel`
+    class TaskTimer;
+
+    // Hierarchical timer wheel shared by all `TaskTimer` instances of a scheduler in `TimerBackend::Wheel` mode
+    class TimerWheel;
+
+    // Local task deque of a worker in `WorkerMode::WorkStealing` mode
+    class WorkerQueue;
+
+    // Serial executor of a group bound to one worker in `WorkerMode::WorkStealing` mode, replaces the asio strand
+    class AffinityStrand;
+
+    // Lock-free timing counters of one group, shared with the handles of its tasks
+    class GroupCounters;
+
+    // Per-priority FIFO queues with starvation protection, callers provide the locking
+    template <typename Item>
+    class PriorityDeque;
+
+    static constexpr size_t PRIORITY_NUM = static_cast<size_t>(Priority::Max);
+
+    // Live queue counters of one priority class, shared by all `PriorityDeque` instances of a scheduler
+    struct PriorityCounter {
+        std::atomic<size_t> queue_depth{0};
+        std::atomic<size_t> max_queue_depth{0};
+        std::atomic<size_t> promoted_tasks{0};
+    };
+
+    struct GroupTasks {
+        std::unordered_set<TaskId> task_ids;
+        // Taken when the group is created, so posting to an existing group needs no counters lookup
+        std::shared_ptr<GroupCounters> counters;
+    };
+#endif
+
+    // Move-only closure of an immediate task, stored inline when it fits so that a pooled handle needs no allocation
+    class TaskClosure {
+    public:
+        static constexpr size_t INLINE_SIZE = 64;
+
+        TaskClosure() = default;
+
+        template <typename F>
+        requires (!std::is_same_v<std::decay_t<F>, TaskClosure>)
+        explicit TaskClosure(F &&task)
+        {
+            using Callable = std::decay_t<F>;
+            if constexpr (is_stored_inline<Callable>()) {
+                new (storage_) Callable(std::forward<F>(task));
+                ops_ = &INLINE_OPS<Callable>;
+            } else {
+                *reinterpret_cast<Callable **>(storage_) = new Callable(std::forward<F>(task));
+                ops_ = &HEAP_OPS<Callable>;
+            }
+        }
+
+        TaskClosure(TaskClosure &&other) noexcept
+        {
+            move_from(other);
+        }
+
+        TaskClosure &operator=(TaskClosure &&other) noexcept
+        {
+            if (this != &other) {
+                reset();
+                move_from(other);
+            }
+            return *this;
+        }
+
+        TaskClosure(const TaskClosure &) = delete;
+        TaskClosure &operator=(const TaskClosure &) = delete;
+
+        ~TaskClosure()
+        {
+            reset();
+        }
+
+        void operator()()
+        {
+            ops_->invoke(storage_);
+        }
+
+        explicit operator bool() const
+        {
+            return ops_ != nullptr;
+        }
+
+        bool is_heap_allocated() const
+        {
+            return (ops_ != nullptr) && !ops_->is_inline;
+        }
+
+        void reset()
+        {
+            if (ops_ != nullptr) {
+                ops_->destroy(storage_);
+                ops_ = nullptr;
+            }
+        }
+
+    private:
+        struct Ops {
+            void (*invoke)(void *storage);
+            void (*move)(void *dst, void *src); // Move-constructs into `dst` and destroys `src`
+            void (*destroy)(void *storage);
+            bool is_inline;
+        };
+
+        template <typename Callable>
+        static constexpr bool is_stored_inline()
+        {
+            return (sizeof(Callable) <= INLINE_SIZE) && (alignof(Callable) <= alignof(std::max_align_t)) &&
+                   std::is_nothrow_move_constructible_v<Callable>;
+        }
+
+        template <typename Callable>
+        static constexpr Ops INLINE_OPS = {
+            .invoke = [](void *storage) {
+                (*static_cast<Callable *>(storage))();
+            },
+            .move = [](void *dst, void *src) {
+                new (dst) Callable(std::move(*static_cast<Callable *>(src)));
+                static_cast<Callable *>(src)->~Callable();
+            },
+            .destroy = [](void *storage) {
+                static_cast<Callable *>(storage)->~Callable();
+            },
+            .is_inline = true,
+        };
+
+        template <typename Callable>
+        static constexpr Ops HEAP_OPS = {
+            .invoke = [](void *storage) {
+                (**static_cast<Callable **>(storage))();
+            },
+            .move = [](void *dst, void *src) {
+                *static_cast<Callable **>(dst) = *static_cast<Callable **>(src);
+            },
+            .destroy = [](void *storage) {
+                delete *static_cast<Callable **>(storage);
+            },
+            .is_inline = false,
+        };
+
+        void move_from(TaskClosure &other) noexcept
+        {
+            if (other.ops_ != nullptr) {
+                other.ops_->move(storage_, other.storage_);
+                ops_ = std::exchange(other.ops_, nullptr);
+            }
+        }
+
+        alignas(std::max_align_t) unsigned char storage_[INLINE_SIZE];
+        const Ops *ops_ = nullptr;
+    };
+
     struct TaskHandle {
         TaskId id;
 #if BROOKESIA_LIB_UTILS_USE_WASM_SINGLE_THREAD_SCHEDULER
         std::atomic<uint64_t> generation {0};
 #else
-        std::shared_ptr<boost::asio::steady_timer> timer;
+        std::shared_ptr<TaskTimer> timer;
+        std::shared_ptr<GroupCounters> group_counters;
 #endif
         std::atomic<TaskState> state {TaskState::Running};
         TaskType type{TaskType::Immediate};
         bool repeat{false};
         int interval_ms{0};
         Group group; // Group that this task belongs to
-        std::shared_ptr<boost::promise<bool>> promise; // Promise for task completion
+        std::optional<boost::promise<bool>> promise; // Promise for task completion
         boost::shared_future<bool> future; // Shared future for task completion
         std::atomic<bool> is_executing{false}; // Flag to prevent parallel execution of periodic tasks
 
         // For suspend/resume support
         std::chrono::steady_clock::time_point suspend_time;
         std::chrono::milliseconds remaining_time{0};
+        std::chrono::steady_clock::time_point post_time; // Time when the task was handed to the executor
+        TaskClosure closure;              // Task closure for Immediate tasks, placed in the pooled handle block
         OnceTask saved_task;              // Saved task closure for Delayed tasks
         PeriodicTask saved_periodic_task;  // Saved task closure for Periodic tasks
     };
 
+#if !BROOKESIA_LIB_UTILS_USE_WASM_SINGLE_THREAD_SCHEDULER
+    // Number of task table shards, tasks are distributed by `id % TASK_SHARD_NUM`
+    static constexpr size_t TASK_SHARD_NUM = 8;
+    // Value of `io_waiter_index_` while no worker waits in the `io_context`
+    static constexpr size_t NO_IO_WAITER = static_cast<size_t>(-1);
+
+    // One slice of the task table with its own lock, so unrelated tasks do not contend
+    struct TaskShard {
+        mutable boost::mutex mutex;
+        std::unordered_map<TaskId, std::shared_ptr<TaskHandle>> tasks;
+    };
+
+    // Get the shard that owns a task ID
+    TaskShard &get_task_shard(TaskId id) const
+    {
+        return task_shards_[id % TASK_SHARD_NUM];
+    }
+
+    // Find a task handle by ID (thread-safe)
+    std::shared_ptr<TaskHandle> find_task(TaskId id) const;
+
+    // Collect the IDs of all tracked tasks (thread-safe)
+    std::vector<TaskId> get_all_task_ids() const;
+
+    // Collect the IDs of all tasks in a group, return `false` if the group is not found (thread-safe)
+    bool get_group_task_ids(const Group &group, std::vector<TaskId> &task_ids) const;
+
+    // Remove a task from the task table and its group (thread-safe)
+    void remove_task(const TaskHandle &handle);
+
+    // Queue a task on a worker, stealable tasks may be taken over by idle workers (thread-safe)
+    void push_worker_task(size_t worker_index, std::function<void()> task, bool is_stealable, Priority priority);
+
+    // Wake up one idle worker other than `busy_worker_index` so that it can steal work
+    void notify_idle_worker(size_t busy_worker_index);
+
+    // Wake up the worker waiting in the `io_context`, if any
+    void notify_io_waiter();
+
+    // Take a stealable task from another worker's queue
+    bool steal_worker_task(size_t worker_index, std::function<void()> &task);
+
+    // Worker loop of `WorkerMode::WorkStealing`
+    void run_work_stealing_worker(size_t worker_index, size_t poll_interval_ms);
+
+    // Get the serial executor of a group in `WorkerMode::WorkStealing` mode, or `nullptr` (thread-safe)
+    std::shared_ptr<AffinityStrand> find_affinity_strand(const Group &group) const;
+
+    // Get the priority class of a group (thread-safe)
+    Priority find_group_priority(const Group &group) const;
+
+    // Queue a task by priority and post a runner that executes the most urgent queued task, tasks of a serial group
+    // keep their posting order on `strand` (thread-safe)
+    void push_priority_task(
+        Priority priority, std::function<void()> task,
+        std::shared_ptr<boost::asio::strand<boost::asio::io_context::executor_type>> strand
+    );
+
+    // Execute the most urgent task queued by `push_priority_task()`
+    void run_priority_task();
+
+    // Cache of released `TaskHandle` memory blocks, shared with every allocator so it outlives pending handles
+    class TaskHandlePool;
+
+    // Allocator used with `std::allocate_shared()` to place task handles in `TaskHandlePool` blocks
+    template <typename T>
+    class TaskHandleAllocator;
+#endif
+
     // Generate next task ID
     TaskId next_id()
     {
@@ -579,23 +1027,35 @@ private:
     // Schedule a periodic task (supports return value control)
     void schedule_periodic(std::shared_ptr<TaskHandle> handle, PeriodicTask task);
 
-    // Internal method: cancel task (caller must have already acquired lock)
+    // Internal method: cancel task (caller must have already acquired the task shard lock)
     void cancel_internal(TaskId task_id);
 
-    // Internal method: suspend task (caller must have already acquired lock)
+    // Internal method: suspend task (caller must have already acquired the task shard lock)
     bool suspend_internal(TaskId task_id);
 
-    // Internal method: resume task (caller must have already acquired lock)
+    // Internal method: resume task (caller must have already acquired the task shard lock)
     bool resume_internal(TaskId task_id);
 
     // Internal method: wait for a set of tasks to complete
     bool wait_tasks_internal(const std::vector<TaskId> &task_ids, int timeout_ms);
 
-    // Internal method: remove task and maintain group relationships (caller must have already acquired lock)
+    // Internal method: remove task and maintain group relationships (caller must have already acquired the task
+    // shard lock)
     void remove_task_internal(TaskId task_id, const Group &group);
 
     // Internal method: post or dispatch task based on enable_immediate flag
-    bool post_internal(OnceTask task, TaskId *id, const Group &group, bool enable_immediate);
+    bool post_internal(TaskClosure task, TaskId *id, const Group &group, bool enable_immediate);
+
+    // Record the post-to-execute latency of an immediate task
+    void record_latency(const TaskHandle &handle);
+
+#if !BROOKESIA_LIB_UTILS_USE_WASM_SINGLE_THREAD_SCHEDULER
+    // Record the queue wait and execution time of one task execution in its group statistics
+    void record_execution(
+        const TaskHandle &handle, std::chrono::steady_clock::time_point ready_time,
+        std::chrono::steady_clock::time_point start_time
+    );
+#endif
 
     // Mark task as finished
     void mark_finished(std::shared_ptr<TaskHandle> handle, bool success);
@@ -616,18 +1076,52 @@ private:
     std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> io_work_guard_;
     boost::thread_group threads_;
 #endif
+#if BROOKESIA_LIB_UTILS_USE_WASM_SINGLE_THREAD_SCHEDULER
     std::map<TaskId, std::shared_ptr<TaskHandle>> tasks_;
     std::map<Group, std::unordered_set<TaskId>> groups_; // Mapping between groups and task IDs
+#else
+    // Lock order: `mutex_` is never held while acquiring a shard lock; a shard lock may be held while acquiring
+    // `groups_mutex_`.
+    mutable std::array<TaskShard, TASK_SHARD_NUM> task_shards_;
+    mutable boost::mutex groups_mutex_; // Guards `groups_` and `group_counters_`
+    std::map<Group, GroupTasks> groups_; // Mapping between active groups, their task IDs and counters
+    // Counters of configured groups, kept after the groups become empty until the scheduler stops
+    std::map<Group, std::shared_ptr<GroupCounters>> group_counters_;
+    // Counters of tasks posted without a group, allocated once so ungrouped posts never take `groups_mutex_`
+    std::shared_ptr<GroupCounters> ungrouped_counters_;
+    std::shared_ptr<TaskHandlePool> handle_pool_;
+    std::shared_ptr<TimerWheel> timer_wheel_; // Only created in `TimerBackend::Wheel` mode
+    WorkerMode worker_mode_ = WorkerMode::Polling;
+    std::vector<std::unique_ptr<WorkerQueue>> worker_queues_; // Only created in `WorkerMode::WorkStealing` mode
+    // Idle worker blocked in the `io_context` so that timer completions run without polling delay
+    std::atomic<size_t> io_waiter_index_{NO_IO_WAITER};
+    std::map<Group, std::shared_ptr<AffinityStrand>> affinity_strands_; // Serial executor for each group
+    std::atomic<size_t> next_worker_index_{0};
+    std::chrono::milliseconds priority_starvation_timeout_{0};
+    // Tasks are only routed through `priority_queue_` once a group with a non-default priority is configured
+    std::atomic<bool> is_priority_enabled_{false};
+    std::map<Group, Priority> group_priorities_; // Groups with a non-default priority
+    boost::mutex priority_queue_mutex_; // Guards `priority_queue_` and `priority_strand_tasks_`
+    std::unique_ptr<PriorityDeque<std::function<void()>>> priority_queue_;
+    // Pending tasks of serial groups in posting order, keyed by strand
+    std::map<const void *, std::deque<std::function<void()>>> priority_strand_tasks_;
+    mutable std::array<PriorityCounter, PRIORITY_NUM> priority_counters_;
+#endif
 #if !BROOKESIA_LIB_UTILS_USE_WASM_SINGLE_THREAD_SCHEDULER
     std::map<Group, std::shared_ptr<boost::asio::strand<boost::asio::io_context::executor_type>>> strands_; // Strand for each group
 #endif
-    mutable boost::mutex mutex_;
+    mutable boost::mutex mutex_; // Guards lifecycle, strands and execute callbacks
     std::atomic<TaskId> task_id_counter_{1};
     std::atomic<TaskId> total_tasks_{0};
     std::atomic<TaskId> completed_tasks_{0};
     std::atomic<TaskId> failed_tasks_{0};
     std::atomic<TaskId> canceled_tasks_{0};
     std::atomic<TaskId> suspended_tasks_{0};
+    std::atomic<size_t> latency_samples_{0};
+    std::atomic<uint64_t> total_latency_us_{0};
+    std::atomic<uint64_t> max_latency_us_{0};
+    std::atomic<size_t> stolen_tasks_{0};
+    std::atomic<size_t> closure_heap_fallbacks_{0};
     std::atomic<size_t> worker_wait_slot_count_{0};
     std::map<Group, PreExecuteCallback> pre_execute_callbacks_;   ///< Per-group pre-execute callbacks; key "" = global.
     std::map<Group, PostExecuteCallback> post_execute_callbacks_; ///< Per-group post-execute callbacks; key "" = global.
@@ -636,8 +1130,24 @@ private:
 // Describe macros for TaskScheduler types
 BROOKESIA_DESCRIBE_ENUM(TaskScheduler::TaskType, Immediate, Delayed, Periodic)
 BROOKESIA_DESCRIBE_ENUM(TaskScheduler::TaskState, Running, Suspended, Canceled, Finished)
-BROOKESIA_DESCRIBE_STRUCT(TaskScheduler::Statistics, (), (total_tasks, completed_tasks, failed_tasks, canceled_tasks, suspended_tasks))
-BROOKESIA_DESCRIBE_STRUCT(TaskScheduler::GroupConfig, (), (enable_serial_execution, parent_group))
-BROOKESIA_DESCRIBE_STRUCT(TaskScheduler::StartConfig, (), (worker_configs, worker_poll_interval_ms, pre_execute_callback, post_execute_callback))
+BROOKESIA_DESCRIBE_ENUM(TaskScheduler::WorkerMode, Polling, Blocking, WorkStealing)
+BROOKESIA_DESCRIBE_ENUM(TaskScheduler::TimerBackend, Asio, Wheel)
+BROOKESIA_DESCRIBE_ENUM(TaskScheduler::Priority, Realtime, Interactive, Normal, Background, Max)
+BROOKESIA_DESCRIBE_STRUCT(TaskScheduler::PriorityStatistics, (), (queue_depth, max_queue_depth, promoted_tasks))
+BROOKESIA_DESCRIBE_STRUCT(
+    TaskScheduler::GroupStatistics, (), (
+        group, executed_tasks, queue_wait_histogram, total_queue_wait_us, max_queue_wait_us, execution_histogram,
+        total_execution_us, max_execution_us, periodic_overruns
+    )
+)
+BROOKESIA_DESCRIBE_STRUCT(
+    TaskScheduler::Statistics, (), (
+        total_tasks, completed_tasks, failed_tasks, canceled_tasks, suspended_tasks, latency_samples,
+        total_latency_us, max_latency_us, handle_allocations, handle_reuses, stolen_tasks, closure_heap_fallbacks,
+        priority_stats
+    )
+)
+BROOKESIA_DESCRIBE_STRUCT(TaskScheduler::GroupConfig, (), (enable_serial_execution, parent_group, priority))
+BROOKESIA_DESCRIBE_STRUCT(TaskScheduler::StartConfig, (), (worker_configs, worker_poll_interval_ms, worker_mode, handle_pool_size, timer_backend, timer_wheel_tick_ms, priority_starvation_timeout_ms, pre_execute_callback, post_execute_callback))
 
 } // namespace esp_brookesia::lib_utils
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <exception>
+#include "brookesia/lib_utils/macro_configs.h"
+#if !BROOKESIA_UTILS_TASK_SCHEDULER_ENABLE_DEBUG_LOG
+#   define BROOKESIA_LOG_DISABLE_DEBUG_TRACE 1
+#endif
+#include "private/utils.hpp"
+#include "brookesia/lib_utils/check.hpp"
+#include "brookesia/lib_utils/coroutine.hpp"
+#include "brookesia/lib_utils/log.hpp"
+
+namespace esp_brookesia::lib_utils {
+
+namespace {
+
+Coroutine<void> run_detached(Coroutine<void> coroutine)
+{
+    try {
+        co_await std::move(coroutine);
+    } catch (const std::exception &e) {
+        BROOKESIA_LOGE("Detected exception in spawned coroutine: %1%", e.what());
+    } catch (...) {
+        BROOKESIA_LOGE("Detected unknown exception in spawned coroutine");
+    }
+}
+
+} // namespace
+
+bool SchedulerAwaiter::await_ready() const
+{
+    if (!is_switch_) {
+        return false;
+    }
+
+    return group_.empty() ? scheduler_.is_current_thread_worker() : scheduler_.is_current_thread_in_group(group_);
+}
+
+bool SchedulerAwaiter::suspend(std::coroutine_handle<> handle, std::coroutine_handle<> detached_root)
+{
+    CoroutineResumer resumer(handle, detached_root);
+    auto task = [resumer]() {
+        resumer();
+    };
+
+    auto result = (delay_ms_ > 0) ? scheduler_.post_delayed(std::move(task), delay_ms_, nullptr, group_) :
+                  scheduler_.post(std::move(task), nullptr, group_);
+    if (!result) {
+        resumer.cancel();
+        is_successful_ = false;
+        BROOKESIA_LOGE("Failed to schedule coroutine resume (group: %1%)", group_);
+        return false;
+    }
+
+    return true;
+}
+
+SchedulerAwaiter TaskScheduler::sleep(int delay_ms, const Group &group)
+{
+    return SchedulerAwaiter(*this, group, delay_ms, false);
+}
+
+SchedulerAwaiter TaskScheduler::switch_to(const Group &group)
+{
+    return SchedulerAwaiter(*this, group, 0, true);
+}
+
+bool TaskScheduler::co_spawn(Coroutine<void> coroutine, const Group &group)
+{
+    BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
+
+    BROOKESIA_CHECK_FALSE_RETURN(coroutine.is_valid(), false, "Invalid coroutine");
+    BROOKESIA_CHECK_FALSE_RETURN(is_running(), false, "Not running");
+
+    auto root = run_detached(std::move(coroutine)).detach();
+    CoroutineResumer resumer(root, root);
+    auto result = post([resumer]() {
+        resumer();
+    }, nullptr, group);
+    if (!result) {
+        // Nothing was scheduled, dropping the resumer releases the coroutine frames
+        BROOKESIA_LOGE("Failed to post coroutine (group: %1%)", group);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace esp_brookesia::lib_utils
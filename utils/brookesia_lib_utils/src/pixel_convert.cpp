@@ -0,0 +1,407 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#if defined(ESP_PLATFORM)
+#   include "sdkconfig.h"
+#endif
+#if defined(__SSE2__)
+#   include <emmintrin.h>
+#elif defined(__ARM_NEON) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#   include <arm_neon.h>
+#   define BROOKESIA_UTILS_PIXEL_CONVERT_NEON 1
+#elif defined(CONFIG_IDF_TARGET_ESP32S3) && CONFIG_IDF_TARGET_ESP32S3
+#   define BROOKESIA_UTILS_PIXEL_CONVERT_PIE 1
+#endif
+#include "brookesia/lib_utils/pixel_convert.hpp"
+
+#if BROOKESIA_UTILS_PIXEL_CONVERT_PIE
+// Implemented in `pixel_convert_esp32s3.S`, `count` is rounded down to 16 pixels and both pointers are 16-byte aligned
+extern "C" {
+void brookesia_utils_pie_rgb565_to_argb8888(const uint8_t *src, uint8_t *dst, size_t count);
+void brookesia_utils_pie_rgb565_swapped_to_argb8888(const uint8_t *src, uint8_t *dst, size_t count);
+void brookesia_utils_pie_swap_rgb565(const uint8_t *src, uint8_t *dst, size_t count);
+}
+#endif
+
+namespace esp_brookesia::lib_utils {
+
+namespace {
+
+constexpr size_t FORMAT_NUM = static_cast<size_t>(PixelFormat::Max);
+
+struct Color {
+    uint8_t r = 0;
+    uint8_t g = 0;
+    uint8_t b = 0;
+};
+
+using RowKernel = void (*)(const uint8_t *src, uint8_t *dst, size_t count);
+
+template<PixelFormat Format>
+constexpr size_t pixel_bytes()
+{
+    if constexpr ((Format == PixelFormat::RGB565) || (Format == PixelFormat::RGB565Swapped)) {
+        return 2;
+    } else if constexpr (Format == PixelFormat::RGB888) {
+        return 3;
+    } else {
+        return 4;
+    }
+}
+
+Color unpack_rgb565(uint16_t pixel)
+{
+    const uint8_t r = (pixel >> 11) & 0x1F;
+    const uint8_t g = (pixel >> 5) & 0x3F;
+    const uint8_t b = pixel & 0x1F;
+    return {
+        .r = static_cast<uint8_t>((r << 3) | (r >> 2)),
+        .g = static_cast<uint8_t>((g << 2) | (g >> 4)),
+        .b = static_cast<uint8_t>((b << 3) | (b >> 2)),
+    };
+}
+
+uint16_t pack_rgb565(const Color &color)
+{
+    return static_cast<uint16_t>(((color.r >> 3) << 11) | ((color.g >> 2) << 5) | (color.b >> 3));
+}
+
+template<PixelFormat Format>
+Color load_pixel(const uint8_t *src)
+{
+    if constexpr (Format == PixelFormat::RGB565) {
+        return unpack_rgb565(static_cast<uint16_t>(src[0] | (src[1] << 8)));
+    } else if constexpr (Format == PixelFormat::RGB565Swapped) {
+        return unpack_rgb565(static_cast<uint16_t>((src[0] << 8) | src[1]));
+    } else {
+        // RGB888 and ARGB8888 share the B, G, R byte order
+        return {.r = src[2], .g = src[1], .b = src[0]};
+    }
+}
+
+template<PixelFormat Format>
+void store_pixel(uint8_t *dst, const Color &color)
+{
+    if constexpr (Format == PixelFormat::RGB565) {
+        const uint16_t pixel = pack_rgb565(color);
+        dst[0] = static_cast<uint8_t>(pixel & 0xFF);
+        dst[1] = static_cast<uint8_t>(pixel >> 8);
+    } else if constexpr (Format == PixelFormat::RGB565Swapped) {
+        const uint16_t pixel = pack_rgb565(color);
+        dst[0] = static_cast<uint8_t>(pixel >> 8);
+        dst[1] = static_cast<uint8_t>(pixel & 0xFF);
+    } else {
+        dst[0] = color.b;
+        dst[1] = color.g;
+        dst[2] = color.r;
+        if constexpr (Format == PixelFormat::ARGB8888) {
+            dst[3] = 0xFF;
+        }
+    }
+}
+
+template<PixelFormat Src, PixelFormat Dst>
+void convert_row_scalar(const uint8_t *src, uint8_t *dst, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        store_pixel<Dst>(dst + i * pixel_bytes<Dst>(), load_pixel<Src>(src + i * pixel_bytes<Src>()));
+    }
+}
+
+template<>
+void convert_row_scalar<PixelFormat::RGB565, PixelFormat::RGB565Swapped>(const uint8_t *src, uint8_t *dst,
+        size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        // Read both bytes first, the conversion may run in place
+        const uint8_t low = src[2 * i];
+        const uint8_t high = src[2 * i + 1];
+        dst[2 * i] = high;
+        dst[2 * i + 1] = low;
+    }
+}
+
+template<>
+void convert_row_scalar<PixelFormat::RGB565Swapped, PixelFormat::RGB565>(const uint8_t *src, uint8_t *dst,
+        size_t count)
+{
+    convert_row_scalar<PixelFormat::RGB565, PixelFormat::RGB565Swapped>(src, dst, count);
+}
+
+#if defined(__SSE2__)
+constexpr const char *KERNEL_NAME = "sse2";
+
+__m128i swap_rgb565_bytes(__m128i pixels)
+{
+    return _mm_or_si128(_mm_slli_epi16(pixels, 8), _mm_srli_epi16(pixels, 8));
+}
+
+void store_argb8888_block(__m128i pixels, uint8_t *dst)
+{
+    const __m128i mask5 = _mm_set1_epi16(0x1F);
+    const __m128i mask6 = _mm_set1_epi16(0x3F);
+    const __m128i r5 = _mm_srli_epi16(pixels, 11);
+    const __m128i g6 = _mm_and_si128(_mm_srli_epi16(pixels, 5), mask6);
+    const __m128i b5 = _mm_and_si128(pixels, mask5);
+    const __m128i r8 = _mm_or_si128(_mm_slli_epi16(r5, 3), _mm_srli_epi16(r5, 2));
+    const __m128i g8 = _mm_or_si128(_mm_slli_epi16(g6, 2), _mm_srli_epi16(g6, 4));
+    const __m128i b8 = _mm_or_si128(_mm_slli_epi16(b5, 3), _mm_srli_epi16(b5, 2));
+    // Interleave the [B, G] and [R, A] halves of each pixel into 32-bit words
+    const __m128i bg = _mm_or_si128(b8, _mm_slli_epi16(g8, 8));
+    const __m128i ra = _mm_or_si128(r8, _mm_set1_epi16(static_cast<short>(0xFF00)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_unpacklo_epi16(bg, ra));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 16), _mm_unpackhi_epi16(bg, ra));
+}
+
+template<bool Swapped>
+void convert_rgb565_to_argb8888_simd(const uint8_t *src, uint8_t *dst, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 2));
+        if constexpr (Swapped) {
+            pixels = swap_rgb565_bytes(pixels);
+        }
+        store_argb8888_block(pixels, dst + i * 4);
+    }
+    constexpr auto src_format = Swapped ? PixelFormat::RGB565Swapped : PixelFormat::RGB565;
+    convert_row_scalar<src_format, PixelFormat::ARGB8888>(src + i * 2, dst + i * 4, count - i);
+}
+
+void swap_rgb565_simd(const uint8_t *src, uint8_t *dst, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 2));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2), swap_rgb565_bytes(pixels));
+    }
+    convert_row_scalar<PixelFormat::RGB565, PixelFormat::RGB565Swapped>(src + i * 2, dst + i * 2, count - i);
+}
+#elif BROOKESIA_UTILS_PIXEL_CONVERT_NEON
+constexpr const char *KERNEL_NAME = "neon";
+
+template<bool Swapped>
+void convert_rgb565_to_argb8888_simd(const uint8_t *src, uint8_t *dst, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        uint8x16_t bytes = vld1q_u8(src + i * 2);
+        if constexpr (Swapped) {
+            bytes = vrev16q_u8(bytes);
+        }
+        const uint16x8_t pixels = vreinterpretq_u16_u8(bytes);
+        const uint16x8_t r5 = vshrq_n_u16(pixels, 11);
+        const uint16x8_t g6 = vandq_u16(vshrq_n_u16(pixels, 5), vdupq_n_u16(0x3F));
+        const uint16x8_t b5 = vandq_u16(pixels, vdupq_n_u16(0x1F));
+        uint8x8x4_t argb;
+        argb.val[0] = vmovn_u16(vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2)));
+        argb.val[1] = vmovn_u16(vorrq_u16(vshlq_n_u16(g6, 2), vshrq_n_u16(g6, 4)));
+        argb.val[2] = vmovn_u16(vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2)));
+        argb.val[3] = vdup_n_u8(0xFF);
+        vst4_u8(dst + i * 4, argb);
+    }
+    constexpr auto src_format = Swapped ? PixelFormat::RGB565Swapped : PixelFormat::RGB565;
+    convert_row_scalar<src_format, PixelFormat::ARGB8888>(src + i * 2, dst + i * 4, count - i);
+}
+
+void swap_rgb565_simd(const uint8_t *src, uint8_t *dst, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        vst1q_u8(dst + i * 2, vrev16q_u8(vld1q_u8(src + i * 2)));
+    }
+    convert_row_scalar<PixelFormat::RGB565, PixelFormat::RGB565Swapped>(src + i * 2, dst + i * 2, count - i);
+}
+#elif BROOKESIA_UTILS_PIXEL_CONVERT_PIE
+constexpr const char *KERNEL_NAME = "pie";
+constexpr size_t PIE_BLOCK_PIXELS = 16;
+
+// Leading pixels converted by the scalar kernels until both pointers are 16-byte aligned, or `count` when they
+// never are at the same time
+template<size_t SrcBytes, size_t DstBytes>
+size_t get_pie_prefix(const uint8_t *src, const uint8_t *dst, size_t count)
+{
+    // The alignment of 2-byte source pixels repeats every 8 pixels
+    for (size_t i = 0; (i < 8) && (i < count); i++) {
+        const auto address = reinterpret_cast<uintptr_t>(src + i * SrcBytes) |
+                             reinterpret_cast<uintptr_t>(dst + i * DstBytes);
+        if ((address & 0xF) == 0) {
+            return i;
+        }
+    }
+    return count;
+}
+
+template<bool Swapped>
+void convert_rgb565_to_argb8888_simd(const uint8_t *src, uint8_t *dst, size_t count)
+{
+    constexpr auto src_format = Swapped ? PixelFormat::RGB565Swapped : PixelFormat::RGB565;
+    const size_t prefix = get_pie_prefix<2, 4>(src, dst, count);
+    convert_row_scalar<src_format, PixelFormat::ARGB8888>(src, dst, prefix);
+    const size_t block_count = (count - prefix) / PIE_BLOCK_PIXELS * PIE_BLOCK_PIXELS;
+    if constexpr (Swapped) {
+        brookesia_utils_pie_rgb565_swapped_to_argb8888(src + prefix * 2, dst + prefix * 4, block_count);
+    } else {
+        brookesia_utils_pie_rgb565_to_argb8888(src + prefix * 2, dst + prefix * 4, block_count);
+    }
+    const size_t i = prefix + block_count;
+    convert_row_scalar<src_format, PixelFormat::ARGB8888>(src + i * 2, dst + i * 4, count - i);
+}
+
+void swap_rgb565_simd(const uint8_t *src, uint8_t *dst, size_t count)
+{
+    const size_t prefix = get_pie_prefix<2, 2>(src, dst, count);
+    convert_row_scalar<PixelFormat::RGB565, PixelFormat::RGB565Swapped>(src, dst, prefix);
+    const size_t block_count = (count - prefix) / PIE_BLOCK_PIXELS * PIE_BLOCK_PIXELS;
+    brookesia_utils_pie_swap_rgb565(src + prefix * 2, dst + prefix * 2, block_count);
+    const size_t i = prefix + block_count;
+    convert_row_scalar<PixelFormat::RGB565, PixelFormat::RGB565Swapped>(src + i * 2, dst + i * 2, count - i);
+}
+#else
+constexpr const char *KERNEL_NAME = "scalar";
+#endif
+
+// Stack buffer of the rotated conversion, a row is converted in chunks of this size
+constexpr size_t ROTATE_CHUNK_BYTES = 256;
+
+template<PixelFormat Src, size_t... Dst>
+constexpr std::array<RowKernel, FORMAT_NUM> make_kernel_row(std::index_sequence<Dst...>)
+{
+    return {convert_row_scalar<Src, static_cast<PixelFormat>(Dst)>...};
+}
+
+template<size_t... Src>
+constexpr std::array<std::array<RowKernel, FORMAT_NUM>, FORMAT_NUM> make_kernel_table(std::index_sequence<Src...>)
+{
+    return {make_kernel_row<static_cast<PixelFormat>(Src)>(std::make_index_sequence<FORMAT_NUM>())...};
+}
+
+std::array<std::array<RowKernel, FORMAT_NUM>, FORMAT_NUM> build_kernel_table()
+{
+    auto table = make_kernel_table(std::make_index_sequence<FORMAT_NUM>());
+#if defined(__SSE2__) || BROOKESIA_UTILS_PIXEL_CONVERT_NEON || BROOKESIA_UTILS_PIXEL_CONVERT_PIE
+    auto set_kernel = [&table](PixelFormat src, PixelFormat dst, RowKernel kernel) {
+        table[static_cast<size_t>(src)][static_cast<size_t>(dst)] = kernel;
+    };
+    set_kernel(PixelFormat::RGB565, PixelFormat::ARGB8888, convert_rgb565_to_argb8888_simd<false>);
+    set_kernel(PixelFormat::RGB565Swapped, PixelFormat::ARGB8888, convert_rgb565_to_argb8888_simd<true>);
+    set_kernel(PixelFormat::RGB565, PixelFormat::RGB565Swapped, swap_rgb565_simd);
+    set_kernel(PixelFormat::RGB565Swapped, PixelFormat::RGB565, swap_rgb565_simd);
+#endif
+    return table;
+}
+
+const auto &get_kernel_table()
+{
+    static const auto table = build_kernel_table();
+    return table;
+}
+
+bool is_format_valid(PixelFormat format)
+{
+    return static_cast<size_t>(format) < FORMAT_NUM;
+}
+
+} // namespace
+
+size_t get_pixel_bytes(PixelFormat format)
+{
+    switch (format) {
+    case PixelFormat::RGB565:
+    case PixelFormat::RGB565Swapped:
+        return 2;
+    case PixelFormat::RGB888:
+        return 3;
+    case PixelFormat::ARGB8888:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+const char *get_pixel_convert_kernel_name()
+{
+    return KERNEL_NAME;
+}
+
+bool convert_pixels(const uint8_t *src, PixelFormat src_format, uint8_t *dst, PixelFormat dst_format, size_t count)
+{
+    if ((src == nullptr) || (dst == nullptr) || !is_format_valid(src_format) || !is_format_valid(dst_format)) {
+        return false;
+    }
+    if (src_format == dst_format) {
+        std::memmove(dst, src, count * get_pixel_bytes(src_format));
+        return true;
+    }
+    get_kernel_table()[static_cast<size_t>(src_format)][static_cast<size_t>(dst_format)](src, dst, count);
+    return true;
+}
+
+bool convert_pixel_rect(
+    const uint8_t *src, const PixelRect &src_rect, uint8_t *dst, size_t dst_stride_bytes, PixelFormat dst_format,
+    PixelRotation rotation
+)
+{
+    if ((src == nullptr) || (dst == nullptr) || !is_format_valid(src_rect.format) || !is_format_valid(dst_format) ||
+            (static_cast<size_t>(rotation) >= static_cast<size_t>(PixelRotation::Max))) {
+        return false;
+    }
+
+    const uint32_t width = src_rect.width;
+    const uint32_t height = src_rect.height;
+    const size_t src_bpp = get_pixel_bytes(src_rect.format);
+    const size_t dst_bpp = get_pixel_bytes(dst_format);
+    const bool is_transposed = (rotation == PixelRotation::Rotate90) || (rotation == PixelRotation::Rotate270);
+    const size_t src_stride = (src_rect.stride_bytes == 0) ? width * src_bpp : src_rect.stride_bytes;
+    const size_t dst_stride = (dst_stride_bytes == 0) ? (is_transposed ? height : width) * dst_bpp :
+                              dst_stride_bytes;
+
+    if (rotation == PixelRotation::None) {
+        for (uint32_t y = 0; y < height; y++) {
+            convert_pixels(src + y * src_stride, src_rect.format, dst + y * dst_stride, dst_format, width);
+        }
+        return true;
+    }
+
+    // Convert each row chunk with the vector kernels first, then scatter its pixels to their rotated place
+    alignas(16) std::array<uint8_t, ROTATE_CHUNK_BYTES> chunk;
+    const uint32_t chunk_pixels = static_cast<uint32_t>(ROTATE_CHUNK_BYTES / dst_bpp);
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t chunk_x = 0; chunk_x < width; chunk_x += chunk_pixels) {
+            const uint32_t chunk_width = std::min(chunk_pixels, width - chunk_x);
+            convert_pixels(
+                src + y * src_stride + chunk_x * src_bpp, src_rect.format, chunk.data(), dst_format, chunk_width
+            );
+            for (uint32_t i = 0; i < chunk_width; i++) {
+                const uint32_t x = chunk_x + i;
+                size_t dst_x = 0;
+                size_t dst_y = 0;
+                switch (rotation) {
+                case PixelRotation::Rotate90:
+                    dst_x = height - 1 - y;
+                    dst_y = x;
+                    break;
+                case PixelRotation::Rotate180:
+                    dst_x = width - 1 - x;
+                    dst_y = height - 1 - y;
+                    break;
+                default:
+                    dst_x = y;
+                    dst_y = width - 1 - x;
+                    break;
+                }
+                std::memcpy(dst + dst_y * dst_stride + dst_x * dst_bpp, chunk.data() + i * dst_bpp, dst_bpp);
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace esp_brookesia::lib_utils
@@ -3,11 +3,17 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <algorithm>
+#include <deque>
 #include <exception>
+#include <limits>
+#include <list>
+#include <new>
 #include "brookesia/lib_utils/macro_configs.h"
 #if !BROOKESIA_UTILS_TASK_SCHEDULER_ENABLE_DEBUG_LOG
 #   define BROOKESIA_LOG_DISABLE_DEBUG_TRACE 1
 #endif
+#include "boost/thread/condition_variable.hpp"
 #include "private/utils.hpp"
 #include "brookesia/lib_utils/check.hpp"
 #include "brookesia/lib_utils/describe_helpers.hpp"
@@ -22,8 +28,958 @@ namespace {
 thread_local const TaskScheduler *tls_current_worker_scheduler = nullptr;
 thread_local const TaskScheduler *tls_worker_wait_slot_scheduler = nullptr;
 thread_local size_t tls_worker_wait_slot_count = 0;
+// Index of the current worker thread, only valid when `tls_current_worker_scheduler` is set.
+thread_local size_t tls_worker_index = 0;
+// Points to the `AffinityStrand` whose tasks are currently running on this thread (if any).
+thread_local const void *tls_current_affinity_strand = nullptr;
 } // namespace
 
+class TaskScheduler::TaskHandlePool {
+public:
+    ~TaskHandlePool()
+    {
+        for (auto block : free_blocks_) {
+            ::operator delete(block);
+        }
+    }
+
+    void set_capacity(size_t capacity)
+    {
+        boost::lock_guard lock(mutex_);
+        capacity_ = capacity;
+        while (free_blocks_.size() > capacity_) {
+            ::operator delete(free_blocks_.back());
+            free_blocks_.pop_back();
+        }
+        // Reserve up front so that returning a block never allocates
+        free_blocks_.reserve(capacity_);
+    }
+
+    void *allocate(size_t size)
+    {
+        {
+            boost::lock_guard lock(mutex_);
+            // All blocks come from the same `allocate_shared()` instantiation, so the first size is the only one
+            if (block_size_ == 0) {
+                block_size_ = size;
+            }
+            if ((size == block_size_) && !free_blocks_.empty()) {
+                auto block = free_blocks_.back();
+                free_blocks_.pop_back();
+                reuses_.fetch_add(1, std::memory_order_relaxed);
+                return block;
+            }
+        }
+
+        auto block = ::operator new(size);
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+
+        return block;
+    }
+
+    void deallocate(void *block, size_t size)
+    {
+        {
+            boost::lock_guard lock(mutex_);
+            if ((size == block_size_) && (free_blocks_.size() < capacity_)) {
+                free_blocks_.push_back(block);
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+    size_t get_allocations() const
+    {
+        return allocations_.load(std::memory_order_relaxed);
+    }
+
+    size_t get_reuses() const
+    {
+        return reuses_.load(std::memory_order_relaxed);
+    }
+
+    void reset_statistics()
+    {
+        allocations_ = 0;
+        reuses_ = 0;
+    }
+
+private:
+    boost::mutex mutex_;
+    size_t capacity_ = 0;
+    size_t block_size_ = 0;
+    std::vector<void *> free_blocks_;
+    std::atomic<size_t> allocations_{0};
+    std::atomic<size_t> reuses_{0};
+};
+
+template <typename T>
+class TaskScheduler::TaskHandleAllocator {
+public:
+    using value_type = T;
+
+    explicit TaskHandleAllocator(std::shared_ptr<TaskHandlePool> pool)
+        : pool_(std::move(pool))
+    {}
+
+    template <typename U>
+    TaskHandleAllocator(const TaskHandleAllocator<U> &other)
+        : pool_(other.pool_)
+    {}
+
+    T *allocate(size_t n)
+    {
+        return static_cast<T *>(pool_->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *block, size_t n)
+    {
+        pool_->deallocate(block, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const TaskHandleAllocator<U> &other) const
+    {
+        return pool_ == other.pool_;
+    }
+
+    template <typename U>
+    bool operator!=(const TaskHandleAllocator<U> &other) const
+    {
+        return pool_ != other.pool_;
+    }
+
+private:
+    template <typename U>
+    friend class TaskHandleAllocator;
+
+    std::shared_ptr<TaskHandlePool> pool_;
+};
+
+class TaskScheduler::GroupCounters {
+public:
+    void record(uint64_t queue_wait_us, uint64_t execution_us, bool is_overrun)
+    {
+        executed_tasks_.fetch_add(1, std::memory_order_relaxed);
+        queue_wait_.record(queue_wait_us);
+        execution_.record(execution_us);
+        if (is_overrun) {
+            periodic_overruns_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    GroupStatistics get_statistics(const Group &group) const
+    {
+        GroupStatistics stats{
+            .group = group,
+            .executed_tasks = executed_tasks_.load(std::memory_order_relaxed),
+            .periodic_overruns = periodic_overruns_.load(std::memory_order_relaxed),
+        };
+        queue_wait_.get(stats.queue_wait_histogram, stats.total_queue_wait_us, stats.max_queue_wait_us);
+        execution_.get(stats.execution_histogram, stats.total_execution_us, stats.max_execution_us);
+
+        return stats;
+    }
+
+    void reset()
+    {
+        executed_tasks_ = 0;
+        queue_wait_.reset();
+        execution_.reset();
+        periodic_overruns_ = 0;
+    }
+
+private:
+    struct Histogram {
+        void record(uint64_t value_us)
+        {
+            const auto bound_it = std::lower_bound(
+                                      LATENCY_HISTOGRAM_BOUNDS_US.begin(), LATENCY_HISTOGRAM_BOUNDS_US.end(), value_us
+                                  );
+            buckets[std::distance(LATENCY_HISTOGRAM_BOUNDS_US.begin(), bound_it)].fetch_add(1, std::memory_order_relaxed);
+            total_us.fetch_add(value_us, std::memory_order_relaxed);
+            auto current_max_us = max_us.load(std::memory_order_relaxed);
+            while ((value_us > current_max_us) &&
+                    !max_us.compare_exchange_weak(current_max_us, value_us, std::memory_order_relaxed)) {
+            }
+        }
+
+        void get(std::vector<size_t> &histogram, uint64_t &total, uint64_t &max) const
+        {
+            histogram.resize(LATENCY_HISTOGRAM_BUCKET_NUM);
+            for (size_t i = 0; i < LATENCY_HISTOGRAM_BUCKET_NUM; i++) {
+                histogram[i] = buckets[i].load(std::memory_order_relaxed);
+            }
+            total = total_us.load(std::memory_order_relaxed);
+            max = max_us.load(std::memory_order_relaxed);
+        }
+
+        void reset()
+        {
+            for (auto &bucket : buckets) {
+                bucket = 0;
+            }
+            total_us = 0;
+            max_us = 0;
+        }
+
+        std::array<std::atomic<size_t>, LATENCY_HISTOGRAM_BUCKET_NUM> buckets{};
+        std::atomic<uint64_t> total_us{0};
+        std::atomic<uint64_t> max_us{0};
+    };
+
+    std::atomic<size_t> executed_tasks_{0};
+    Histogram queue_wait_;
+    Histogram execution_;
+    std::atomic<size_t> periodic_overruns_{0};
+};
+
+template <typename Item>
+class TaskScheduler::PriorityDeque {
+public:
+    PriorityDeque(std::array<PriorityCounter, PRIORITY_NUM> &counters, std::chrono::milliseconds starvation_timeout)
+        : counters_(counters)
+        , starvation_timeout_(starvation_timeout)
+    {}
+
+    ~PriorityDeque()
+    {
+        take_all();
+    }
+
+    void push(Priority priority, Item item)
+    {
+        const auto index = get_index(priority);
+        queues_[index].push_back({std::move(item), std::chrono::steady_clock::now()});
+
+        auto &counter = counters_[index];
+        const auto depth = counter.queue_depth.fetch_add(1, std::memory_order_relaxed) + 1;
+        auto max_depth = counter.max_queue_depth.load(std::memory_order_relaxed);
+        while ((depth > max_depth) &&
+                !counter.max_queue_depth.compare_exchange_weak(max_depth, depth, std::memory_order_relaxed)) {
+        }
+    }
+
+    bool pop(Item &item)
+    {
+        const auto index = select_index();
+        if (index == PRIORITY_NUM) {
+            return false;
+        }
+        item = std::move(queues_[index].front().item);
+        queues_[index].pop_front();
+        counters_[index].queue_depth.fetch_sub(1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    // Take the newest item accepted by `filter`, starting from the most urgent class
+    template <typename Filter>
+    bool pop_back_if(Filter filter, Item &item)
+    {
+        for (size_t index = 0; index < PRIORITY_NUM; index++) {
+            auto &queue = queues_[index];
+            for (auto it = queue.rbegin(); it != queue.rend(); ++it) {
+                if (filter(it->item)) {
+                    item = std::move(it->item);
+                    queue.erase(std::next(it).base());
+                    counters_[index].queue_depth.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    bool empty() const
+    {
+        for (const auto &queue : queues_) {
+            if (!queue.empty()) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Remove all items, they are returned so that callers can destroy them outside of their lock
+    std::vector<Item> take_all()
+    {
+        std::vector<Item> items;
+        for (size_t index = 0; index < PRIORITY_NUM; index++) {
+            counters_[index].queue_depth.fetch_sub(queues_[index].size(), std::memory_order_relaxed);
+            for (auto &entry : queues_[index]) {
+                items.push_back(std::move(entry.item));
+            }
+            queues_[index].clear();
+        }
+
+        return items;
+    }
+
+private:
+    struct Entry {
+        Item item;
+        std::chrono::steady_clock::time_point enqueue_time;
+    };
+
+    static size_t get_index(Priority priority)
+    {
+        const auto index = static_cast<size_t>(priority);
+        return (index < PRIORITY_NUM) ? index : static_cast<size_t>(Priority::Normal);
+    }
+
+    // Pick the most urgent non-empty class, unless a lower class has waited longer than the starvation timeout
+    size_t select_index()
+    {
+        size_t selected = 0;
+        while ((selected < PRIORITY_NUM) && queues_[selected].empty()) {
+            selected++;
+        }
+        if (selected >= PRIORITY_NUM - 1) {
+            return selected;
+        }
+
+        size_t starved = PRIORITY_NUM;
+        std::chrono::steady_clock::time_point oldest_time;
+        std::chrono::steady_clock::time_point now;
+        for (size_t index = selected + 1; index < PRIORITY_NUM; index++) {
+            if (queues_[index].empty()) {
+                continue;
+            }
+            if (now == std::chrono::steady_clock::time_point()) {
+                now = std::chrono::steady_clock::now();
+            }
+            const auto enqueue_time = queues_[index].front().enqueue_time;
+            if (((now - enqueue_time) >= starvation_timeout_) && ((starved == PRIORITY_NUM) || (enqueue_time < oldest_time))) {
+                starved = index;
+                oldest_time = enqueue_time;
+            }
+        }
+        if (starved != PRIORITY_NUM) {
+            counters_[starved].promoted_tasks.fetch_add(1, std::memory_order_relaxed);
+            return starved;
+        }
+
+        return selected;
+    }
+
+    std::array<PriorityCounter, PRIORITY_NUM> &counters_;
+    const std::chrono::milliseconds starvation_timeout_;
+    std::array<std::deque<Entry>, PRIORITY_NUM> queues_;
+};
+
+class TaskScheduler::WorkerQueue {
+public:
+    struct Item {
+        std::function<void()> task;
+        bool is_stealable = true;
+    };
+
+    WorkerQueue(std::array<PriorityCounter, PRIORITY_NUM> &counters, std::chrono::milliseconds starvation_timeout)
+        : items_(counters, starvation_timeout)
+    {}
+
+    void push(Item item, Priority priority)
+    {
+        {
+            boost::lock_guard lock(mutex_);
+            items_.push(priority, std::move(item));
+        }
+        cv_.notify_one();
+    }
+
+    bool pop(std::function<void()> &task)
+    {
+        boost::lock_guard lock(mutex_);
+        Item item;
+        if (!items_.pop(item)) {
+            return false;
+        }
+        task = std::move(item.task);
+
+        return true;
+    }
+
+    // Take the newest stealable task of the most urgent class. Tasks of serial groups are only handed over while the
+    // owner is blocked in a wait, their `AffinityStrand` still guarantees that they never run concurrently.
+    bool steal(std::function<void()> &task)
+    {
+        boost::lock_guard lock(mutex_);
+        const bool is_blocked = (blocked_count_.load() > 0);
+        auto is_stealable = [is_blocked](const Item & item) {
+            return item.is_stealable || is_blocked;
+        };
+        Item item;
+        if (!items_.pop_back_if(is_stealable, item)) {
+            return false;
+        }
+        task = std::move(item.task);
+
+        return true;
+    }
+
+    void wait(size_t timeout_ms)
+    {
+        boost::unique_lock lock(mutex_);
+        if (!items_.empty()) {
+            return;
+        }
+        is_idle_ = true;
+        cv_.wait_for(lock, boost::chrono::milliseconds(timeout_ms));
+        is_idle_ = false;
+    }
+
+    void notify()
+    {
+        cv_.notify_one();
+    }
+
+    bool is_idle() const
+    {
+        return is_idle_.load();
+    }
+
+    // Nested waits are counted, so the queue stays blocked until the outermost wait returns
+    void set_blocked(bool is_blocked)
+    {
+        if (is_blocked) {
+            blocked_count_.fetch_add(1);
+        } else {
+            blocked_count_.fetch_sub(1);
+        }
+    }
+
+    bool is_blocked() const
+    {
+        return blocked_count_.load() > 0;
+    }
+
+    bool empty()
+    {
+        boost::lock_guard lock(mutex_);
+        return items_.empty();
+    }
+
+    void clear()
+    {
+        std::vector<Item> items;
+        {
+            boost::lock_guard lock(mutex_);
+            items = items_.take_all();
+        }
+    }
+
+private:
+    boost::mutex mutex_;
+    boost::condition_variable cv_;
+    PriorityDeque<Item> items_;
+    std::atomic<bool> is_idle_{false};
+    std::atomic<size_t> blocked_count_{0};
+};
+
+class TaskScheduler::AffinityStrand: public std::enable_shared_from_this<AffinityStrand> {
+public:
+    AffinityStrand(TaskScheduler &scheduler, size_t worker_index, Priority priority)
+        : scheduler_(scheduler)
+        , worker_index_(worker_index)
+        , priority_(priority)
+    {}
+
+    void set_priority(Priority priority)
+    {
+        priority_.store(priority);
+    }
+
+    void post(std::function<void()> task)
+    {
+        bool need_schedule = false;
+        {
+            boost::lock_guard lock(mutex_);
+            tasks_.push_back(std::move(task));
+            need_schedule = !is_scheduled_;
+            is_scheduled_ = true;
+        }
+        if (need_schedule) {
+            schedule_drain();
+        }
+    }
+
+    bool running_in_this_thread() const
+    {
+        return tls_current_affinity_strand == this;
+    }
+
+    void clear()
+    {
+        std::deque<std::function<void()>> tasks;
+        {
+            boost::lock_guard lock(mutex_);
+            tasks.swap(tasks_);
+            is_scheduled_ = false;
+        }
+    }
+
+private:
+    // Upper bound of tasks run per drain, so one busy group cannot monopolize its worker
+    static constexpr size_t DRAIN_BATCH_SIZE = 16;
+
+    void schedule_drain()
+    {
+        scheduler_.push_worker_task(worker_index_, [self = shared_from_this()]() {
+            self->drain();
+        }, false, priority_.load());
+    }
+
+    void drain()
+    {
+        auto previous_strand = tls_current_affinity_strand;
+        tls_current_affinity_strand = this;
+        lib_utils::FunctionGuard restore_guard([previous_strand]() {
+            tls_current_affinity_strand = previous_strand;
+        });
+
+        for (size_t i = 0; i < DRAIN_BATCH_SIZE; i++) {
+            std::function<void()> task;
+            {
+                boost::lock_guard lock(mutex_);
+                if (tasks_.empty()) {
+                    is_scheduled_ = false;
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            BROOKESIA_CHECK_EXCEPTION_EXECUTE(task(), {}, {BROOKESIA_LOGE("Serial task execution failed");});
+        }
+
+        // Let other work on this worker run before continuing
+        schedule_drain();
+    }
+
+    TaskScheduler &scheduler_;
+    const size_t worker_index_;
+    std::atomic<Priority> priority_;
+    boost::mutex mutex_;
+    std::deque<std::function<void()>> tasks_;
+    bool is_scheduled_ = false;
+};
+
+class TaskScheduler::TimerWheel: public std::enable_shared_from_this<TimerWheel> {
+public:
+    using Handler = std::function<void(const boost::system::error_code &)>;
+    using Strand = boost::asio::strand<boost::asio::io_context::executor_type>;
+    using Slot = std::list<TaskTimer *>;
+
+    TimerWheel(boost::asio::io_context &io_context, std::chrono::milliseconds tick)
+        : io_context_(io_context)
+        , tick_(std::max(tick, std::chrono::milliseconds(1)))
+        , start_time_(std::chrono::steady_clock::now())
+    {
+        driver_.emplace(io_context_);
+    }
+
+    // Set the expiry of `timer`, a pending wait is aborted like `steady_timer::expires_after()` does
+    void set_expiry(TaskTimer &timer, std::chrono::steady_clock::time_point expiry);
+
+    std::chrono::steady_clock::time_point get_expiry(const TaskTimer &timer) const;
+
+    // Add `timer` to the wheel, `handler` is posted to the timer's executor once its tick is reached
+    void schedule(TaskTimer &timer, Handler handler);
+
+    // Remove `timer` from the wheel, return its pending handler (if any) so the caller can abort it
+    Handler remove(TaskTimer &timer);
+
+    // Drop all pending timers and release the driver timer, must be called before the io_context is destroyed
+    void shutdown();
+
+    void post_handler(const std::shared_ptr<Strand> &strand, Handler handler, const boost::system::error_code &ec)
+    {
+        auto task = [handler = std::move(handler), ec]() {
+            handler(ec);
+        };
+        if (strand) {
+            boost::asio::post(*strand, std::move(task));
+        } else {
+            boost::asio::post(io_context_, std::move(task));
+        }
+    }
+
+private:
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOT_NUM = 1 << SLOT_BITS;
+    static constexpr uint64_t SLOT_MASK = SLOT_NUM - 1;
+    static constexpr size_t LEVEL_NUM = 3;
+
+    using DueHandler = std::pair<std::shared_ptr<Strand>, Handler>;
+
+    uint64_t get_tick(std::chrono::steady_clock::time_point time, bool round_up) const
+    {
+        if (time <= start_time_) {
+            return 0;
+        }
+        const auto elapsed = (time - start_time_).count();
+        const auto tick = tick_.count();
+
+        return static_cast<uint64_t>(round_up ? ((elapsed + tick - 1) / tick) : (elapsed / tick));
+    }
+
+    void place_locked(TaskTimer &timer);
+    Handler remove_locked(TaskTimer &timer);
+    void cascade_locked(Slot &slot);
+    // Earliest tick with due timers or a cascade of non-empty upper slots, only valid while `timer_count_ > 0`
+    uint64_t get_next_event_tick_locked() const;
+    void advance_locked(uint64_t target_tick, std::vector<DueHandler> &due_handlers);
+    void arm_driver_locked();
+    void on_tick(const boost::system::error_code &ec);
+
+    boost::asio::io_context &io_context_;
+    const std::chrono::steady_clock::duration tick_;
+    const std::chrono::steady_clock::time_point start_time_;
+    mutable boost::mutex mutex_;
+    // Single timer waking the wheel up at the next tick with work, empty ticks are skipped
+    std::optional<boost::asio::steady_timer> driver_;
+    bool is_driver_armed_ = false;
+    uint64_t armed_tick_ = 0;
+    bool is_stopped_ = false;
+    uint64_t current_tick_ = 0;
+    size_t timer_count_ = 0;
+    // Level `n` slots cover `SLOT_NUM^n` ticks each, timers beyond the last level wait in `overflow_`
+    std::array<std::array<Slot, SLOT_NUM>, LEVEL_NUM> levels_;
+    Slot overflow_;
+};
+
+class TaskScheduler::TaskTimer {
+public:
+    using Handler = TimerWheel::Handler;
+    using Strand = TimerWheel::Strand;
+
+    TaskTimer(
+        boost::asio::io_context &io_context, std::shared_ptr<Strand> strand, std::shared_ptr<TimerWheel> wheel,
+        std::shared_ptr<AffinityStrand> affinity_strand
+    )
+        : strand_(std::move(strand))
+        , wheel_(std::move(wheel))
+        , affinity_strand_(std::move(affinity_strand))
+    {
+        if (!wheel_) {
+            if (strand_) {
+                asio_timer_.emplace(*strand_);
+            } else {
+                asio_timer_.emplace(io_context);
+            }
+        }
+    }
+
+    ~TaskTimer()
+    {
+        if (wheel_) {
+            cancel();
+        }
+    }
+
+    TaskTimer(const TaskTimer &) = delete;
+    TaskTimer &operator=(const TaskTimer &) = delete;
+
+    void expires_after(std::chrono::milliseconds duration)
+    {
+        if (asio_timer_) {
+            asio_timer_->expires_after(duration);
+        } else {
+            wheel_->set_expiry(*this, std::chrono::steady_clock::now() + duration);
+        }
+    }
+
+    std::chrono::steady_clock::time_point expiry() const
+    {
+        return asio_timer_ ? asio_timer_->expiry() : wheel_->get_expiry(*this);
+    }
+
+    template <typename WaitHandler>
+    void async_wait(WaitHandler &&handler)
+    {
+        if (affinity_strand_) {
+            // The timer completes on the io_context, then hands the handler over to the group's worker
+            async_wait_internal([affinity_strand = affinity_strand_, handler = Handler(std::forward<WaitHandler>(handler))](
+            const boost::system::error_code & ec) {
+                affinity_strand->post([handler, ec]() {
+                    handler(ec);
+                });
+            });
+        } else {
+            async_wait_internal(std::forward<WaitHandler>(handler));
+        }
+    }
+
+    void cancel()
+    {
+        if (asio_timer_) {
+            asio_timer_->cancel();
+            return;
+        }
+        auto handler = wheel_->remove(*this);
+        if (handler) {
+            wheel_->post_handler(strand_, std::move(handler), boost::asio::error::operation_aborted);
+        }
+    }
+
+private:
+    friend class TimerWheel;
+
+    template <typename WaitHandler>
+    void async_wait_internal(WaitHandler &&handler)
+    {
+        if (asio_timer_) {
+            asio_timer_->async_wait(std::forward<WaitHandler>(handler));
+        } else {
+            wheel_->schedule(*this, Handler(std::forward<WaitHandler>(handler)));
+        }
+    }
+
+    const std::shared_ptr<Strand> strand_;
+    const std::shared_ptr<TimerWheel> wheel_;
+    const std::shared_ptr<AffinityStrand> affinity_strand_; // Only used in `WorkerMode::WorkStealing` mode
+    std::optional<boost::asio::steady_timer> asio_timer_; // Only used in `TimerBackend::Asio` mode
+
+    // Wheel state, guarded by the wheel mutex
+    std::chrono::steady_clock::time_point expiry_;
+    Handler handler_;
+    uint64_t deadline_tick_ = 0;
+    TimerWheel::Slot *slot_ = nullptr;
+    TimerWheel::Slot::iterator slot_it_;
+};
+
+void TaskScheduler::TimerWheel::set_expiry(TaskTimer &timer, std::chrono::steady_clock::time_point expiry)
+{
+    Handler aborted_handler;
+    {
+        boost::lock_guard lock(mutex_);
+        aborted_handler = remove_locked(timer);
+        timer.expiry_ = expiry;
+    }
+    if (aborted_handler) {
+        post_handler(timer.strand_, std::move(aborted_handler), boost::asio::error::operation_aborted);
+    }
+}
+
+std::chrono::steady_clock::time_point TaskScheduler::TimerWheel::get_expiry(const TaskTimer &timer) const
+{
+    boost::lock_guard lock(mutex_);
+    return timer.expiry_;
+}
+
+void TaskScheduler::TimerWheel::schedule(TaskTimer &timer, Handler handler)
+{
+    Handler aborted_handler;
+    bool is_expired = true;
+    {
+        boost::lock_guard lock(mutex_);
+        if (is_stopped_) {
+            return;
+        }
+        aborted_handler = remove_locked(timer);
+
+        const auto now = std::chrono::steady_clock::now();
+        if (timer.expiry_ > now) {
+            is_expired = false;
+            if (timer_count_ == 0) {
+                // The driver is idle, catch up without walking the skipped ticks
+                current_tick_ = std::max(current_tick_, get_tick(now, false));
+            }
+            // Round up, so a timer never fires before its expiry, like `steady_timer` in `TimerBackend::Asio` mode
+            timer.deadline_tick_ = std::max(get_tick(timer.expiry_, true), current_tick_ + 1);
+            timer.handler_ = std::move(handler);
+            place_locked(timer);
+            timer_count_++;
+            arm_driver_locked();
+        }
+    }
+    if (aborted_handler) {
+        post_handler(timer.strand_, std::move(aborted_handler), boost::asio::error::operation_aborted);
+    }
+    // Already expired, fire without waiting for the next tick
+    if (is_expired) {
+        post_handler(timer.strand_, std::move(handler), boost::system::error_code());
+    }
+}
+
+TaskScheduler::TimerWheel::Handler TaskScheduler::TimerWheel::remove(TaskTimer &timer)
+{
+    boost::lock_guard lock(mutex_);
+    return remove_locked(timer);
+}
+
+void TaskScheduler::TimerWheel::shutdown()
+{
+    std::vector<Handler> dropped_handlers;
+    {
+        boost::lock_guard lock(mutex_);
+        is_stopped_ = true;
+        auto drop_slot = [&dropped_handlers](Slot & slot) {
+            for (auto timer : slot) {
+                timer->slot_ = nullptr;
+                dropped_handlers.push_back(std::move(timer->handler_));
+            }
+            slot.clear();
+        };
+        for (auto &level : levels_) {
+            for (auto &slot : level) {
+                drop_slot(slot);
+            }
+        }
+        drop_slot(overflow_);
+        timer_count_ = 0;
+        driver_.reset();
+    }
+    // The dropped handlers own task handles, release them outside the lock since their timers lock it again
+    dropped_handlers.clear();
+}
+
+void TaskScheduler::TimerWheel::place_locked(TaskTimer &timer)
+{
+    const auto deadline = timer.deadline_tick_;
+    Slot *slot = &overflow_;
+    for (size_t level = 0; level < LEVEL_NUM; level++) {
+        const auto shift = level * SLOT_BITS;
+        if (((deadline >> shift) - (current_tick_ >> shift)) < SLOT_NUM) {
+            slot = &levels_[level][(deadline >> shift) & SLOT_MASK];
+            break;
+        }
+    }
+    timer.slot_ = slot;
+    timer.slot_it_ = slot->insert(slot->end(), &timer);
+}
+
+TaskScheduler::TimerWheel::Handler TaskScheduler::TimerWheel::remove_locked(TaskTimer &timer)
+{
+    if (timer.slot_ == nullptr) {
+        return nullptr;
+    }
+    timer.slot_->erase(timer.slot_it_);
+    timer.slot_ = nullptr;
+    timer_count_--;
+
+    return std::move(timer.handler_);
+}
+
+void TaskScheduler::TimerWheel::cascade_locked(Slot &slot)
+{
+    Slot timers;
+    timers.swap(slot);
+    for (auto timer : timers) {
+        place_locked(*timer);
+    }
+}
+
+uint64_t TaskScheduler::TimerWheel::get_next_event_tick_locked() const
+{
+    // Level 0 holds the timers due within the next `SLOT_NUM` ticks, each upper level slot is cascaded at the first
+    // tick it covers
+    uint64_t next_tick = std::numeric_limits<uint64_t>::max();
+    for (size_t level = 0; level < LEVEL_NUM; level++) {
+        const auto shift = level * SLOT_BITS;
+        const auto base = current_tick_ >> shift;
+        for (uint64_t offset = 1; offset < SLOT_NUM; offset++) {
+            const auto tick = (base + offset) << shift;
+            if (tick >= next_tick) {
+                break;
+            }
+            if (!levels_[level][(base + offset) & SLOT_MASK].empty()) {
+                next_tick = tick;
+                break;
+            }
+        }
+    }
+    if (!overflow_.empty()) {
+        constexpr auto overflow_shift = LEVEL_NUM * SLOT_BITS;
+        next_tick = std::min(next_tick, ((current_tick_ >> overflow_shift) + 1) << overflow_shift);
+    }
+
+    return next_tick;
+}
+
+void TaskScheduler::TimerWheel::advance_locked(uint64_t target_tick, std::vector<DueHandler> &due_handlers)
+{
+    while ((current_tick_ < target_tick) && (timer_count_ > 0)) {
+        // Jump over the ticks without due timers or cascades in one step
+        const auto tick = get_next_event_tick_locked();
+        if (tick > target_tick) {
+            break;
+        }
+        current_tick_ = tick;
+        // Refill the lower levels from the higher ones whenever a lower level wraps around
+        if ((tick & SLOT_MASK) == 0) {
+            if (((tick >> SLOT_BITS) & SLOT_MASK) == 0) {
+                if (((tick >> (2 * SLOT_BITS)) & SLOT_MASK) == 0) {
+                    cascade_locked(overflow_);
+                }
+                cascade_locked(levels_[2][(tick >> (2 * SLOT_BITS)) & SLOT_MASK]);
+            }
+            cascade_locked(levels_[1][(tick >> SLOT_BITS) & SLOT_MASK]);
+        }
+
+        // All timers of this tick are collected at once and fire from the same wake-up
+        auto &slot = levels_[0][tick & SLOT_MASK];
+        for (auto timer : slot) {
+            timer->slot_ = nullptr;
+            due_handlers.emplace_back(timer->strand_, std::move(timer->handler_));
+        }
+        timer_count_ -= slot.size();
+        slot.clear();
+    }
+    current_tick_ = std::max(current_tick_, target_tick);
+}
+
+void TaskScheduler::TimerWheel::arm_driver_locked()
+{
+    if (is_stopped_ || (timer_count_ == 0)) {
+        return;
+    }
+
+    const auto next_tick = get_next_event_tick_locked();
+    if (is_driver_armed_ && (armed_tick_ <= next_tick)) {
+        return;
+    }
+
+    // Re-arming aborts the pending wait, whose handler then returns without touching the wheel
+    is_driver_armed_ = true;
+    armed_tick_ = next_tick;
+    driver_->expires_at(start_time_ + tick_ * next_tick);
+    driver_->async_wait([self = shared_from_this()](const boost::system::error_code & ec) {
+        self->on_tick(ec);
+    });
+}
+
+void TaskScheduler::TimerWheel::on_tick(const boost::system::error_code &ec)
+{
+    if (ec == boost::asio::error::operation_aborted) {
+        return;
+    }
+
+    std::vector<DueHandler> due_handlers;
+    {
+        boost::lock_guard lock(mutex_);
+        is_driver_armed_ = false;
+        if (is_stopped_) {
+            return;
+        }
+        advance_locked(get_tick(std::chrono::steady_clock::now(), false), due_handlers);
+        arm_driver_locked();
+    }
+
+    for (auto &[strand, handler] : due_handlers) {
+        post_handler(strand, std::move(handler), boost::system::error_code());
+    }
+}
+
+TaskScheduler::TaskScheduler()
+    : ungrouped_counters_(std::make_shared<GroupCounters>())
+    , handle_pool_(std::make_shared<TaskHandlePool>())
+{
+}
+
 bool TaskScheduler::is_current_thread_worker() const
 {
     return tls_current_worker_scheduler == this;
@@ -31,6 +987,11 @@ bool TaskScheduler::is_current_thread_worker() const
 
 bool TaskScheduler::is_current_thread_in_group(const Group &group) const
 {
+    auto affinity_strand = find_affinity_strand(group);
+    if (affinity_strand) {
+        return affinity_strand->running_in_this_thread();
+    }
+
     std::shared_ptr<boost::asio::strand<boost::asio::io_context::executor_type>> strand;
     {
         boost::lock_guard lock(mutex_);
@@ -125,6 +1086,10 @@ bool TaskScheduler::start(const StartConfig &config)
     lib_utils::FunctionGuard stop_guard([this, &lock]() {
         BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
         if (!is_running()) {
+            if (timer_wheel_) {
+                timer_wheel_->shutdown();
+                timer_wheel_.reset();
+            }
             io_work_guard_.reset();
             io_context_.reset();
             return;
@@ -150,8 +1115,38 @@ bool TaskScheduler::start(const StartConfig &config)
         "Failed to warm up asio timer service"
     );
     asio_warmup_timer.reset();
+    if (config.timer_backend == TimerBackend::Wheel) {
+        BROOKESIA_CHECK_EXCEPTION_RETURN(
+            timer_wheel_ = std::make_shared<TimerWheel>(
+                               *io_context_, std::chrono::milliseconds(config.timer_wheel_tick_ms)
+                           ), false, "Failed to create timer wheel"
+        );
+    }
 
     reset_statistics();
+    handle_pool_->set_capacity(config.handle_pool_size);
+
+    priority_starvation_timeout_ = std::chrono::milliseconds(config.priority_starvation_timeout_ms);
+    BROOKESIA_CHECK_EXCEPTION_RETURN(
+        priority_queue_ = std::make_unique<PriorityDeque<std::function<void()>>>(
+                              priority_counters_, priority_starvation_timeout_
+                          ), false, "Failed to create priority queue"
+    );
+
+    worker_mode_ = config.worker_mode;
+    if (worker_mode_ == WorkerMode::WorkStealing) {
+        BROOKESIA_CHECK_FALSE_RETURN(
+            !config.worker_configs.empty(), false, "Work stealing mode requires at least one worker"
+        );
+        worker_queues_.clear();
+        for (size_t i = 0; i < config.worker_configs.size(); i++) {
+            BROOKESIA_CHECK_EXCEPTION_RETURN(
+                worker_queues_.push_back(std::make_unique<WorkerQueue>(
+                                             priority_counters_, priority_starvation_timeout_
+                                         )), false, "Failed to create worker queue"
+            );
+        }
+    }
 
     // Save global callbacks from config (empty-string key = fires for every task)
     pre_execute_callbacks_.clear();
@@ -165,9 +1160,11 @@ bool TaskScheduler::start(const StartConfig &config)
 
     is_running_.store(true);
 
-    for (const auto &thread_config : config.worker_configs) {
+    for (size_t worker_index = 0; worker_index < config.worker_configs.size(); worker_index++) {
+        const auto &thread_config = config.worker_configs[worker_index];
         auto thread_func =
-        [this, name = thread_config.name, poll_interval_ms = config.worker_poll_interval_ms] {
+        [this, name = thread_config.name, poll_interval_ms = config.worker_poll_interval_ms,
+                worker_mode = config.worker_mode, worker_index] {
             BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
 
             BROOKESIA_LOGD("Worker thread (%1%) started", name);
@@ -175,10 +1172,23 @@ bool TaskScheduler::start(const StartConfig &config)
             // Mark this thread as owned by this scheduler for execution-context
             // queries and synchronous wait-slot accounting.
             tls_current_worker_scheduler = this;
+            tls_worker_index = worker_index;
+
+            if (worker_mode == WorkerMode::WorkStealing) {
+                run_work_stealing_worker(worker_index, poll_interval_ms);
+                BROOKESIA_LOGD("Worker thread (%1%) stopped", name);
+                return;
+            }
 
             while (!boost::this_thread::interruption_requested() && !io_context_->stopped())
             {
                 try {
+                    if (worker_mode == WorkerMode::Blocking) {
+                        // The work guard keeps `run_one()` blocked until a handler is ready or
+                        // `stop()` stops the io_context, so no polling delay is added.
+                        io_context_->run_one();
+                        continue;
+                    }
                     size_t executed = io_context_->poll();
                     if (executed == 0) {
                         boost::this_thread::sleep_for(boost::chrono::milliseconds(poll_interval_ms));
@@ -215,9 +1225,9 @@ void TaskScheduler::stop()
     }
 
     // Cancel all pending tasks
-    {
-        boost::lock_guard<boost::mutex> lock(mutex_);
-        for (auto& [id, handle] : tasks_) {
+    for (auto &shard : task_shards_) {
+        boost::lock_guard<boost::mutex> lock(shard.mutex);
+        for (auto& [id, handle] : shard.tasks) {
             handle->state = TaskState::Canceled;
             if (handle->timer) {
                 handle->timer->cancel();
@@ -244,13 +1254,43 @@ void TaskScheduler::stop()
     threads_.join_all();
 
     // Clean up resources
+    for (auto &shard : task_shards_) {
+        boost::lock_guard<boost::mutex> lock(shard.mutex);
+        shard.tasks.clear();
+    }
     {
-        boost::lock_guard<boost::mutex> lock(mutex_);
-        tasks_.clear();
+        boost::lock_guard<boost::mutex> lock(groups_mutex_);
         groups_.clear();
+        group_counters_.clear();
+    }
+    for (auto &worker_queue : worker_queues_) {
+        worker_queue->clear();
+    }
+    {
+        std::vector<std::function<void()>> priority_tasks;
+        std::map<const void *, std::deque<std::function<void()>>> priority_strand_tasks;
+        {
+            boost::lock_guard<boost::mutex> lock(priority_queue_mutex_);
+            priority_tasks = priority_queue_->take_all();
+            priority_strand_tasks.swap(priority_strand_tasks_);
+        }
+    }
+    {
+        boost::lock_guard<boost::mutex> lock(mutex_);
+        is_priority_enabled_.store(false);
+        group_priorities_.clear();
+        for (auto& [group, affinity_strand] : affinity_strands_) {
+            affinity_strand->clear();
+        }
+        affinity_strands_.clear();
+        worker_queues_.clear();
         strands_.clear();
         pre_execute_callbacks_.clear();
         post_execute_callbacks_.clear();
+        if (timer_wheel_) {
+            timer_wheel_->shutdown();
+            timer_wheel_.reset();
+        }
         io_work_guard_.reset();
         io_context_.reset();
     }
@@ -263,7 +1303,7 @@ void TaskScheduler::stop()
     );
 }
 
-bool TaskScheduler::post_internal(OnceTask task, TaskId *id, const Group &group, bool enable_immediate)
+bool TaskScheduler::post_internal(TaskClosure task, TaskId *id, const Group &group, bool enable_immediate)
 {
     BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
 
@@ -274,31 +1314,39 @@ bool TaskScheduler::post_internal(OnceTask task, TaskId *id, const Group &group,
     auto handle = create_handle(TaskType::Immediate, false, 0, group);
     BROOKESIA_CHECK_NULL_RETURN(handle, false, "Failed to create task handle");
 
-    auto task_wrapper = [this, handle, task = std::move(task)]() {
+    // Keep the closure in the pooled handle, so the posted wrapper stays small enough for asio's recycled handler memory
+    if (task.is_heap_allocated()) {
+        closure_heap_fallbacks_.fetch_add(1, std::memory_order_relaxed);
+    }
+    handle->closure = std::move(task);
+    auto task_wrapper = [this, handle]() {
         BROOKESIA_LOG_TRACE_GUARD_WITH_THIS();
 
         if (handle->state == TaskState::Canceled) {
             BROOKESIA_LOGD("Task[%1%] is canceled, skipping execution", handle->id);
-            boost::lock_guard<boost::mutex> lock(mutex_);
-            remove_task_internal(handle->id, handle->group);
+            remove_task(*handle);
             return;
         }
 
         BROOKESIA_LOGD("Executing Task[%1%]", handle->id);
 
+        record_latency(*handle);
+
         // Invoke pre-execute callback when task is about to execute
         invoke_pre_execute_callback(handle->id, handle->type, handle->group);
 
         bool success = false;
+        const auto start_time = std::chrono::steady_clock::now();
         // Will be executed when the function exits
         lib_utils::FunctionGuard exit_guard(
-        [this, handle, &success]() {
+        [this, handle, &success, start_time]() {
+            record_execution(*handle, handle->post_time, start_time);
             invoke_post_execute_callback(handle->id, handle->type, success, handle->group);
             mark_finished(handle, success);
         }
         );
 
-        BROOKESIA_CHECK_EXCEPTION_EXECUTE(task(), {
+        BROOKESIA_CHECK_EXCEPTION_EXECUTE(handle->closure(), {
             success = false;
             return;
         }, {BROOKESIA_LOGE("Task[%1%] execution failed", handle->id);});
@@ -306,17 +1354,53 @@ bool TaskScheduler::post_internal(OnceTask task, TaskId *id, const Group &group,
         success = true;
     };
 
+    if (worker_mode_ == WorkerMode::WorkStealing) {
+        handle->post_time = std::chrono::steady_clock::now();
+        auto affinity_strand = find_affinity_strand(group);
+        if (affinity_strand) {
+            if (enable_immediate && affinity_strand->running_in_this_thread()) {
+                task_wrapper();
+            } else {
+                affinity_strand->post(std::move(task_wrapper));
+            }
+        } else if (enable_immediate && is_current_thread_worker()) {
+            task_wrapper();
+        } else {
+            // Workers keep their own tasks for locality, other threads spread tasks round-robin
+            const auto worker_index = is_current_thread_worker() ? tls_worker_index :
+                                      (next_worker_index_.fetch_add(1, std::memory_order_relaxed) % worker_queues_.size());
+            push_worker_task(worker_index, std::move(task_wrapper), true, find_group_priority(group));
+        }
+
+        if (id) {
+            *id = handle->id;
+        }
+
+        return true;
+    }
+
     // Check if group has strand configured
     std::shared_ptr<boost::asio::strand<boost::asio::io_context::executor_type>> strand;
+    auto priority = Priority::Normal;
     {
         boost::lock_guard<boost::mutex> lock(mutex_);
         auto strand_it = strands_.find(group);
         if (strand_it != strands_.end()) {
             strand = strand_it->second;
         }
+        auto priority_it = group_priorities_.find(group);
+        if (priority_it != group_priorities_.end()) {
+            priority = priority_it->second;
+        }
     }
 
-    if (strand) {
+    handle->post_time = std::chrono::steady_clock::now();
+    // Tasks that `dispatch()` would run inline skip the priority queue
+    const bool is_inline = enable_immediate &&
+                           (strand ? strand->running_in_this_thread() : io_context_->get_executor().running_in_this_thread());
+    if (is_priority_enabled_.load() && !is_inline) {
+        push_priority_task(priority, std::move(task_wrapper), strand);
+    } else if (strand) {
         if (enable_immediate) {
             boost::asio::dispatch(*strand, std::move(task_wrapper));
         } else {
@@ -339,12 +1423,12 @@ bool TaskScheduler::post_internal(OnceTask task, TaskId *id, const Group &group,
 
 bool TaskScheduler::dispatch(OnceTask task, TaskId *id, const Group &group)
 {
-    return post_internal(std::move(task), id, group, true);
+    return post_internal(TaskClosure(std::move(task)), id, group, true);
 }
 
 bool TaskScheduler::post(OnceTask task, TaskId *id, const Group &group)
 {
-    return post_internal(std::move(task), id, group, false);
+    return post_internal(TaskClosure(std::move(task)), id, group, false);
 }
 
 bool TaskScheduler::post_delayed(OnceTask task, int delay_ms, TaskId *id, const Group &group)
@@ -430,7 +1514,7 @@ void TaskScheduler::cancel(TaskId id)
         return;
     }
 
-    boost::lock_guard<boost::mutex> lock(mutex_);
+    boost::lock_guard<boost::mutex> lock(get_task_shard(id).mutex);
     cancel_internal(id);
 }
 
@@ -445,20 +1529,19 @@ void TaskScheduler::cancel_group(const Group &group)
         return;
     }
 
-    boost::lock_guard<boost::mutex> lock(mutex_);
-    auto group_it = groups_.find(group);
-    if (group_it == groups_.end()) {
+    // Copy task IDs to avoid iterator invalidation
+    std::vector<TaskId> task_ids;
+    if (!get_group_task_ids(group, task_ids)) {
         BROOKESIA_LOGD("Group %1% not found", group);
         return;
     }
 
-    // Copy task IDs to avoid iterator invalidation
-    std::vector<TaskId> task_ids(group_it->second.begin(), group_it->second.end());
-
     // Cancel all tasks in the group
     size_t canceled_count = 0;
     for (auto id : task_ids) {
-        if (tasks_.find(id) != tasks_.end()) {
+        auto &shard = get_task_shard(id);
+        boost::lock_guard<boost::mutex> lock(shard.mutex);
+        if (shard.tasks.find(id) != shard.tasks.end()) {
             cancel_internal(id);
             canceled_count++;
         }
@@ -477,17 +1560,12 @@ void TaskScheduler::cancel_all()
         return;
     }
 
-    boost::lock_guard<boost::mutex> lock(mutex_);
-
     // Copy task IDs to avoid iterator invalidation
-    std::vector<TaskId> task_ids;
-    task_ids.reserve(tasks_.size());
-    for (const auto& [id, handle] : tasks_) {
-        task_ids.push_back(id);
-    }
+    auto task_ids = get_all_task_ids();
 
     // Cancel all tasks
     for (auto id : task_ids) {
+        boost::lock_guard<boost::mutex> lock(get_task_shard(id).mutex);
         cancel_internal(id);
     }
 
@@ -502,7 +1580,7 @@ bool TaskScheduler::suspend(TaskId id)
 
     BROOKESIA_CHECK_FALSE_RETURN(is_running(), false, "Not running");
 
-    boost::lock_guard<boost::mutex> lock(mutex_);
+    boost::lock_guard<boost::mutex> lock(get_task_shard(id).mutex);
     return suspend_internal(id);
 }
 
@@ -514,20 +1592,17 @@ size_t TaskScheduler::suspend_group(const Group &group)
 
     BROOKESIA_CHECK_FALSE_RETURN(is_running(), 0, "Not running");
 
-    boost::lock_guard<boost::mutex> lock(mutex_);
-    auto group_it = groups_.find(group);
-    if (group_it == groups_.end()) {
+    // Copy task IDs to avoid iterator invalidation
+    std::vector<TaskId> task_ids;
+    if (!get_group_task_ids(group, task_ids)) {
         BROOKESIA_LOGD("Group %1% not found", group);
         return 0;
     }
 
-    // Copy task IDs to avoid iterator invalidation
-    std::vector<TaskId> task_ids(group_it->second.begin(), group_it->second.end());
-
     // Suspend all tasks in the group
     size_t suspended_count = 0;
     for (auto id : task_ids) {
-        if (suspend_internal(id)) {
+        if (suspend(id)) {
             suspended_count++;
         }
     }
@@ -543,19 +1618,13 @@ size_t TaskScheduler::suspend_all()
 
     BROOKESIA_CHECK_FALSE_RETURN(is_running(), 0, "Not running");
 
-    boost::lock_guard<boost::mutex> lock(mutex_);
-
     // Copy task IDs to avoid iterator invalidation
-    std::vector<TaskId> task_ids;
-    task_ids.reserve(tasks_.size());
-    for (const auto& [id, handle] : tasks_) {
-        task_ids.push_back(id);
-    }
+    auto task_ids = get_all_task_ids();
 
     // Suspend all tasks
     size_t suspended_count = 0;
     for (auto id : task_ids) {
-        if (suspend_internal(id)) {
+        if (suspend(id)) {
             suspended_count++;
         }
     }
@@ -573,7 +1642,7 @@ bool TaskScheduler::resume(TaskId id)
 
     BROOKESIA_CHECK_FALSE_RETURN(is_running(), false, "Not running");
 
-    boost::lock_guard<boost::mutex> lock(mutex_);
+    boost::lock_guard<boost::mutex> lock(get_task_shard(id).mutex);
     return resume_internal(id);
 }
 
@@ -585,20 +1654,17 @@ size_t TaskScheduler::resume_group(const Group &group)
 
     BROOKESIA_CHECK_FALSE_RETURN(is_running(), 0, "Not running");
 
-    boost::lock_guard<boost::mutex> lock(mutex_);
-    auto group_it = groups_.find(group);
-    if (group_it == groups_.end()) {
+    // Copy task IDs to avoid iterator invalidation
+    std::vector<TaskId> task_ids;
+    if (!get_group_task_ids(group, task_ids)) {
         BROOKESIA_LOGD("Group %1% not found", group);
         return 0;
     }
 
-    // Copy task IDs to avoid iterator invalidation
-    std::vector<TaskId> task_ids(group_it->second.begin(), group_it->second.end());
-
     // Resume all tasks in the group
     size_t resumed_count = 0;
     for (auto id : task_ids) {
-        if (resume_internal(id)) {
+        if (resume(id)) {
             resumed_count++;
         }
     }
@@ -614,19 +1680,13 @@ size_t TaskScheduler::resume_all()
 
     BROOKESIA_CHECK_FALSE_RETURN(is_running(), 0, "Not running");
 
-    boost::lock_guard<boost::mutex> lock(mutex_);
-
     // Copy task IDs to avoid iterator invalidation
-    std::vector<TaskId> task_ids;
-    task_ids.reserve(tasks_.size());
-    for (const auto& [id, handle] : tasks_) {
-        task_ids.push_back(id);
-    }
+    auto task_ids = get_all_task_ids();
 
     // Resume all tasks
     size_t resumed_count = 0;
     for (auto id : task_ids) {
-        if (resume_internal(id)) {
+        if (resume(id)) {
             resumed_count++;
         }
     }
@@ -646,14 +1706,28 @@ bool TaskScheduler::wait(TaskId id, int timeout_ms)
 
     boost::shared_future<bool> future;
     {
-        boost::lock_guard<boost::mutex> lock(mutex_);
-        auto it = tasks_.find(id);
-        if (it == tasks_.end()) {
+        auto handle = find_task(id);
+        if (!handle) {
             BROOKESIA_LOGD("Task[%1%] not found (already finished)", id);
             return true; // Task already finished
         }
-        future = it->second->future;
+        future = handle->future;
+    }
+
+    // While a work stealing worker blocks here, let the others take over the serial groups bound to it
+    WorkerQueue *blocked_queue = nullptr;
+    if ((worker_mode_ == WorkerMode::WorkStealing) && is_current_thread_worker()) {
+        blocked_queue = worker_queues_[tls_worker_index].get();
+        blocked_queue->set_blocked(true);
+        if (!blocked_queue->empty()) {
+            notify_idle_worker(tls_worker_index);
+        }
     }
+    lib_utils::FunctionGuard blocked_guard([blocked_queue]() {
+        if (blocked_queue) {
+            blocked_queue->set_blocked(false);
+        }
+    });
 
     if (timeout_ms >= 0) {
         // Wait with timeout
@@ -685,14 +1759,9 @@ bool TaskScheduler::wait_group(const Group &group, int timeout_ms)
     std::vector<TaskId> task_ids;
 
     // Get all task IDs in the group
-    {
-        boost::lock_guard<boost::mutex> lock(mutex_);
-        auto group_it = groups_.find(group);
-        if (group_it == groups_.end()) {
-            BROOKESIA_LOGD("Group %1% not found or empty", group);
-            return true;
-        }
-        task_ids.assign(group_it->second.begin(), group_it->second.end());
+    if (!get_group_task_ids(group, task_ids)) {
+        BROOKESIA_LOGD("Group %1% not found or empty", group);
+        return true;
     }
 
     bool result = wait_tasks_internal(task_ids, timeout_ms);
@@ -712,19 +1781,11 @@ bool TaskScheduler::wait_all(int timeout_ms)
 
     BROOKESIA_CHECK_FALSE_RETURN(is_running(), false, "Not running");
 
-    std::vector<TaskId> task_ids;
-
     // Get all current task IDs
-    {
-        boost::lock_guard<boost::mutex> lock(mutex_);
-        if (tasks_.empty()) {
-            BROOKESIA_LOGD("No tasks to wait for");
-            return true;
-        }
-        task_ids.reserve(tasks_.size());
-        for (const auto& [id, handle] : tasks_) {
-            task_ids.push_back(id);
-        }
+    auto task_ids = get_all_task_ids();
+    if (task_ids.empty()) {
+        BROOKESIA_LOGD("No tasks to wait for");
+        return true;
     }
 
     bool result = wait_tasks_internal(task_ids, timeout_ms);
@@ -744,10 +1805,11 @@ bool TaskScheduler::restart_timer(TaskId id)
 
     BROOKESIA_CHECK_FALSE_RETURN(is_running(), false, "Not running");
 
-    boost::lock_guard<boost::mutex> lock(mutex_);
+    auto &shard = get_task_shard(id);
+    boost::lock_guard<boost::mutex> lock(shard.mutex);
 
-    auto it = tasks_.find(id);
-    if (it == tasks_.end()) {
+    auto it = shard.tasks.find(id);
+    if (it == shard.tasks.end()) {
         BROOKESIA_LOGW("Task[%1%] not found", id);
         return false;
     }
@@ -801,46 +1863,43 @@ bool TaskScheduler::restart_timer(TaskId id)
 
 TaskScheduler::TaskType TaskScheduler::get_type(TaskId id) const
 {
-    boost::lock_guard<boost::mutex> lock(mutex_);
-    auto it = tasks_.find(id);
-    if (it == tasks_.end()) {
+    auto handle = find_task(id);
+    if (!handle) {
         return TaskType::Immediate;
     }
-    return it->second->type;
+    return handle->type;
 }
 
 TaskScheduler::TaskState TaskScheduler::get_state(TaskId id) const
 {
-    boost::lock_guard<boost::mutex> lock(mutex_);
-    auto it = tasks_.find(id);
-    if (it == tasks_.end()) {
+    auto handle = find_task(id);
+    if (!handle) {
         return TaskState::Finished;
     }
 
-    return it->second->state.load();
+    return handle->state.load();
 }
 
 TaskScheduler::Group TaskScheduler::get_group(TaskId id) const
 {
-    boost::lock_guard<boost::mutex> lock(mutex_);
-    auto it = tasks_.find(id);
-    if (it == tasks_.end()) {
+    auto handle = find_task(id);
+    if (!handle) {
         return "";
     }
-    return it->second->group;
+    return handle->group;
 }
 
 size_t TaskScheduler::get_group_task_count(const Group &group) const
 {
-    boost::lock_guard<boost::mutex> lock(mutex_);
+    boost::lock_guard<boost::mutex> lock(groups_mutex_);
     auto it = groups_.find(group);
 
-    return (it != groups_.end()) ? it->second.size() : 0;
+    return (it != groups_.end()) ? it->second.task_ids.size() : 0;
 }
 
 std::vector<TaskScheduler::Group> TaskScheduler::get_active_groups() const
 {
-    boost::lock_guard<boost::mutex> lock(mutex_);
+    boost::lock_guard<boost::mutex> lock(groups_mutex_);
     std::vector<Group> result;
     result.reserve(groups_.size());
     for (const auto& [group, ids] : groups_) {
@@ -858,10 +1917,63 @@ TaskScheduler::Statistics TaskScheduler::get_statistics() const
     stats.failed_tasks = failed_tasks_.load();
     stats.canceled_tasks = canceled_tasks_.load();
     stats.suspended_tasks = suspended_tasks_.load();
+    stats.latency_samples = latency_samples_.load();
+    stats.total_latency_us = total_latency_us_.load();
+    stats.max_latency_us = max_latency_us_.load();
+    stats.handle_allocations = handle_pool_->get_allocations();
+    stats.handle_reuses = handle_pool_->get_reuses();
+    stats.stolen_tasks = stolen_tasks_.load();
+    stats.closure_heap_fallbacks = closure_heap_fallbacks_.load();
+    stats.priority_stats.resize(PRIORITY_NUM);
+    for (size_t i = 0; i < PRIORITY_NUM; i++) {
+        stats.priority_stats[i].queue_depth = priority_counters_[i].queue_depth.load();
+        stats.priority_stats[i].max_queue_depth = priority_counters_[i].max_queue_depth.load();
+        stats.priority_stats[i].promoted_tasks = priority_counters_[i].promoted_tasks.load();
+    }
 
     return stats;
 }
 
+std::vector<TaskScheduler::GroupStatistics> TaskScheduler::get_group_statistics() const
+{
+    std::map<Group, std::shared_ptr<GroupCounters>> group_counters;
+    {
+        boost::lock_guard lock(groups_mutex_);
+        group_counters = group_counters_;
+        for (const auto &[group, group_tasks] : groups_) {
+            group_counters.emplace(group, group_tasks.counters);
+        }
+    }
+
+    std::vector<GroupStatistics> result;
+    result.reserve(group_counters.size() + 1);
+    result.push_back(ungrouped_counters_->get_statistics(""));
+    for (const auto &[group, counters] : group_counters) {
+        result.push_back(counters->get_statistics(group));
+    }
+
+    return result;
+}
+
+std::optional<TaskScheduler::GroupStatistics> TaskScheduler::get_group_statistics(const Group &group) const
+{
+    if (group.empty()) {
+        return ungrouped_counters_->get_statistics(group);
+    }
+
+    boost::lock_guard lock(groups_mutex_);
+    auto group_it = groups_.find(group);
+    if (group_it != groups_.end()) {
+        return group_it->second.counters->get_statistics(group);
+    }
+    auto counters_it = group_counters_.find(group);
+    if (counters_it != group_counters_.end()) {
+        return counters_it->second->get_statistics(group);
+    }
+
+    return std::nullopt;
+}
+
 void TaskScheduler::reset_statistics()
 {
     total_tasks_ = 0;
@@ -869,6 +1981,236 @@ void TaskScheduler::reset_statistics()
     failed_tasks_ = 0;
     canceled_tasks_ = 0;
     suspended_tasks_ = 0;
+    latency_samples_ = 0;
+    total_latency_us_ = 0;
+    max_latency_us_ = 0;
+    handle_pool_->reset_statistics();
+    stolen_tasks_ = 0;
+    closure_heap_fallbacks_ = 0;
+    {
+        ungrouped_counters_->reset();
+        boost::lock_guard lock(groups_mutex_);
+        for (auto &[group, counters] : group_counters_) {
+            counters->reset();
+        }
+        for (auto &[group, group_tasks] : groups_) {
+            group_tasks.counters->reset();
+        }
+    }
+    // Queue depths track live queues and are not reset
+    for (auto &counter : priority_counters_) {
+        counter.max_queue_depth = counter.queue_depth.load();
+        counter.promoted_tasks = 0;
+    }
+}
+
+void TaskScheduler::record_latency(const TaskHandle &handle)
+{
+    const auto latency_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::steady_clock::now() - handle.post_time
+                            ).count());
+
+    latency_samples_.fetch_add(1, std::memory_order_relaxed);
+    total_latency_us_.fetch_add(latency_us, std::memory_order_relaxed);
+    auto max_latency_us = max_latency_us_.load(std::memory_order_relaxed);
+    while ((latency_us > max_latency_us) &&
+            !max_latency_us_.compare_exchange_weak(max_latency_us, latency_us, std::memory_order_relaxed)) {
+    }
+}
+
+void TaskScheduler::record_execution(
+    const TaskHandle &handle, std::chrono::steady_clock::time_point ready_time,
+    std::chrono::steady_clock::time_point start_time
+)
+{
+    if (!handle.group_counters) {
+        return;
+    }
+
+    const auto end_time = std::chrono::steady_clock::now();
+    const auto to_us = [](std::chrono::steady_clock::duration duration) {
+        return static_cast<uint64_t>(std::max<int64_t>(
+                                         std::chrono::duration_cast<std::chrono::microseconds>(duration).count(), 0
+                                     ));
+    };
+    const auto execution_us = to_us(end_time - start_time);
+    const bool is_overrun = (handle.type == TaskType::Periodic) &&
+                            (execution_us > static_cast<uint64_t>(handle.interval_ms) * 1000);
+    handle.group_counters->record(to_us(start_time - ready_time), execution_us, is_overrun);
+}
+
+void TaskScheduler::push_worker_task(
+    size_t worker_index, std::function<void()> task, bool is_stealable, Priority priority
+)
+{
+    auto &worker_queue = *worker_queues_[worker_index];
+    worker_queue.push({std::move(task), is_stealable}, priority);
+
+    // Pairs with the fence of the worker publishing itself as the io waiter, so one of both sees the other
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const bool is_io_waiter = (io_waiter_index_.load() == worker_index);
+    if (is_io_waiter) {
+        notify_io_waiter();
+    }
+    // The target worker is busy, wake up an idle one to steal the task
+    if ((is_stealable && !is_io_waiter && !worker_queue.is_idle()) || worker_queue.is_blocked()) {
+        notify_idle_worker(worker_index);
+    }
+}
+
+void TaskScheduler::notify_idle_worker(size_t busy_worker_index)
+{
+    for (size_t i = 0; i < worker_queues_.size(); i++) {
+        if ((i != busy_worker_index) && worker_queues_[i]->is_idle()) {
+            worker_queues_[i]->notify();
+            return;
+        }
+    }
+
+    const auto io_waiter_index = io_waiter_index_.load();
+    if ((io_waiter_index != NO_IO_WAITER) && (io_waiter_index != busy_worker_index)) {
+        notify_io_waiter();
+    }
+}
+
+void TaskScheduler::notify_io_waiter()
+{
+    // Any completion makes `run_one_for()` return, the waiter then looks at its queue and steals
+    boost::asio::post(*io_context_, []() {});
+}
+
+bool TaskScheduler::steal_worker_task(size_t worker_index, std::function<void()> &task)
+{
+    const auto worker_num = worker_queues_.size();
+    for (size_t i = 1; i < worker_num; i++) {
+        if (worker_queues_[(worker_index + i) % worker_num]->steal(task)) {
+            stolen_tasks_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TaskScheduler::run_work_stealing_worker(size_t worker_index, size_t poll_interval_ms)
+{
+    // Number of local tasks run in a row before timer handlers on the io_context get a chance
+    constexpr size_t LOCAL_TASK_BURST = 8;
+
+    auto &worker_queue = *worker_queues_[worker_index];
+    size_t local_task_count = 0;
+    while (!boost::this_thread::interruption_requested() && !io_context_->stopped()) {
+        try {
+            std::function<void()> task;
+            if ((local_task_count < LOCAL_TASK_BURST) && worker_queue.pop(task)) {
+                local_task_count++;
+                task();
+                continue;
+            }
+            local_task_count = 0;
+
+            if (io_context_->poll_one() > 0) {
+                continue;
+            }
+            if (worker_queue.pop(task) || steal_worker_task(worker_index, task)) {
+                task();
+                continue;
+            }
+
+            // One idle worker waits in the io_context, so timer completions run as soon as they are posted. It is
+            // woken through the io_context when tasks are pushed to it, the wait stays bounded since another
+            // worker's `poll_one()` may take that wake-up.
+            size_t no_io_waiter = NO_IO_WAITER;
+            if (io_waiter_index_.compare_exchange_strong(no_io_waiter, worker_index)) {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (worker_queue.empty()) {
+                    io_context_->run_one_for(std::chrono::milliseconds(poll_interval_ms));
+                }
+                io_waiter_index_.store(NO_IO_WAITER);
+                continue;
+            }
+            worker_queue.wait(poll_interval_ms);
+        } catch (const boost::thread_interrupted &) {
+            BROOKESIA_LOGD("Worker thread (%1%) interrupted", worker_index);
+            break;
+        } catch (const std::exception &e) {
+            BROOKESIA_LOGE("Worker thread (%1%) poll error: %2%", worker_index, e.what());
+        }
+    }
+}
+
+std::shared_ptr<TaskScheduler::AffinityStrand> TaskScheduler::find_affinity_strand(const Group &group) const
+{
+    if (group.empty()) {
+        return nullptr;
+    }
+
+    boost::lock_guard lock(mutex_);
+    auto it = affinity_strands_.find(group);
+
+    return (it != affinity_strands_.end()) ? it->second : nullptr;
+}
+
+TaskScheduler::Priority TaskScheduler::find_group_priority(const Group &group) const
+{
+    if (!is_priority_enabled_.load() || group.empty()) {
+        return Priority::Normal;
+    }
+
+    boost::lock_guard lock(mutex_);
+    auto it = group_priorities_.find(group);
+
+    return (it != group_priorities_.end()) ? it->second : Priority::Normal;
+}
+
+void TaskScheduler::push_priority_task(
+    Priority priority, std::function<void()> task,
+    std::shared_ptr<boost::asio::strand<boost::asio::io_context::executor_type>> strand
+)
+{
+    {
+        boost::lock_guard lock(priority_queue_mutex_);
+        if (strand) {
+            // Runners may hand tasks to the strand out of order, so the queued entry only grants a turn and the
+            // strand itself takes its tasks in posting order
+            priority_strand_tasks_[strand.get()].push_back(std::move(task));
+            task = [this, strand]() {
+                boost::asio::dispatch(*strand, [this, strand]() {
+                    std::function<void()> strand_task;
+                    {
+                        boost::lock_guard lock(priority_queue_mutex_);
+                        auto it = priority_strand_tasks_.find(strand.get());
+                        if (it == priority_strand_tasks_.end()) {
+                            return;
+                        }
+                        strand_task = std::move(it->second.front());
+                        it->second.pop_front();
+                        if (it->second.empty()) {
+                            priority_strand_tasks_.erase(it);
+                        }
+                    }
+                    strand_task();
+                });
+            };
+        }
+        priority_queue_->push(priority, std::move(task));
+    }
+    // Runners are interchangeable, each one executes whatever is most urgent when it gets to run
+    boost::asio::post(*io_context_, [this]() {
+        run_priority_task();
+    });
+}
+
+void TaskScheduler::run_priority_task()
+{
+    std::function<void()> task;
+    {
+        boost::lock_guard lock(priority_queue_mutex_);
+        if (!priority_queue_->pop(task)) {
+            return;
+        }
+    }
+    task();
 }
 
 bool TaskScheduler::configure_group(const Group &group, const GroupConfig &config)
@@ -880,9 +2222,37 @@ bool TaskScheduler::configure_group(const Group &group, const GroupConfig &confi
     BROOKESIA_CHECK_FALSE_RETURN(is_running(), false, "Not running");
     BROOKESIA_CHECK_FALSE_RETURN(!group.empty(), false, "Group name cannot be empty");
 
+    {
+        // Keep the statistics of configured groups after their tasks drain, reusing the counters of an active group
+        boost::lock_guard<boost::mutex> groups_lock(groups_mutex_);
+        auto &counters = group_counters_[group];
+        if (!counters) {
+            auto group_it = groups_.find(group);
+            counters = (group_it != groups_.end()) ? group_it->second.counters : std::make_shared<GroupCounters>();
+        }
+    }
+
     boost::lock_guard<boost::mutex> lock(mutex_);
 
-    if (!config.parent_group.empty()) {
+    if (worker_mode_ == WorkerMode::WorkStealing) {
+        // Serial groups are bound to one worker instead of an asio strand
+        if (!config.parent_group.empty()) {
+            auto parent_it = affinity_strands_.find(config.parent_group);
+            BROOKESIA_CHECK_FALSE_RETURN(
+                parent_it != affinity_strands_.end(), false, "Parent group '%1%' not found", config.parent_group
+            );
+            affinity_strands_[group] = parent_it->second;
+        } else if (config.enable_serial_execution) {
+            auto strand_it = affinity_strands_.find(group);
+            if (strand_it == affinity_strands_.end()) {
+                const auto worker_index = next_worker_index_.fetch_add(1) % worker_queues_.size();
+                affinity_strands_[group] = std::make_shared<AffinityStrand>(*this, worker_index, config.priority);
+                BROOKESIA_LOGD("Bound group '%1%' to worker %2%", group, worker_index);
+            } else {
+                strand_it->second->set_priority(config.priority);
+            }
+        }
+    } else if (!config.parent_group.empty()) {
         // Use parent group's strand
         auto parent_it = strands_.find(config.parent_group);
         BROOKESIA_CHECK_FALSE_RETURN(
@@ -897,6 +2267,13 @@ bool TaskScheduler::configure_group(const Group &group, const GroupConfig &confi
         BROOKESIA_LOGD("Created strand for group '%1%'", group);
     }
 
+    if (config.priority != Priority::Normal) {
+        group_priorities_[group] = config.priority;
+        is_priority_enabled_.store(true);
+    } else {
+        group_priorities_.erase(group);
+    }
+
     // Register optional per-group callbacks supplied through the config
     if (config.pre_execute_callback) {
         pre_execute_callbacks_[group] = config.pre_execute_callback;
@@ -960,7 +2337,8 @@ std::shared_ptr<TaskScheduler::TaskHandle> TaskScheduler::create_handle(
 
     std::shared_ptr<TaskHandle> handle;
     BROOKESIA_CHECK_EXCEPTION_RETURN(
-        handle = std::make_shared<TaskHandle>(), nullptr, "Failed to create task handle"
+        handle = std::allocate_shared<TaskHandle>(TaskHandleAllocator<TaskHandle>(handle_pool_)), nullptr,
+        "Failed to create task handle"
     );
 
     handle->id = next_id();
@@ -969,30 +2347,52 @@ std::shared_ptr<TaskScheduler::TaskHandle> TaskScheduler::create_handle(
     handle->interval_ms = interval_ms;
     handle->group = group;
 
-    // Get strand for group if configured, and create timer with strand executor
-    std::shared_ptr<boost::asio::strand<boost::asio::io_context::executor_type>> strand;
     {
-        boost::lock_guard lock(mutex_);
-        tasks_[handle->id] = handle;
+        auto &shard = get_task_shard(handle->id);
+        boost::lock_guard lock(shard.mutex);
+        shard.tasks[handle->id] = handle;
         // If group is specified, add to group mapping
-        if (!group.empty()) {
-            groups_[group].insert(handle->id);
-            // Check if group has strand configured
-            auto strand_it = strands_.find(group);
-            if (strand_it != strands_.end()) {
-                strand = strand_it->second;
+        if (group.empty()) {
+            handle->group_counters = ungrouped_counters_;
+        } else {
+            boost::lock_guard groups_lock(groups_mutex_);
+            auto [group_it, is_new_group] = groups_.try_emplace(group);
+            auto &group_tasks = group_it->second;
+            if (is_new_group) {
+                // Configured groups keep their counters across periods without tasks
+                auto counters_it = group_counters_.find(group);
+                group_tasks.counters = (counters_it != group_counters_.end()) ? counters_it->second :
+                                       std::make_shared<GroupCounters>();
             }
+            group_tasks.task_ids.insert(handle->id);
+            handle->group_counters = group_tasks.counters;
         }
         total_tasks_++;
     }
 
-    // Create timer with strand executor if available, otherwise use io_context executor
-    if (strand) {
-        handle->timer = std::make_shared<boost::asio::steady_timer>(*strand);
-    } else {
-        handle->timer = std::make_shared<boost::asio::steady_timer>(*io_context_);
+    // Create timer with the group strand executor if configured, otherwise use io_context executor. Immediate
+    // tasks never use a timer.
+    if (type != TaskType::Immediate) {
+        std::shared_ptr<boost::asio::strand<boost::asio::io_context::executor_type>> strand;
+        std::shared_ptr<TimerWheel> timer_wheel;
+        std::shared_ptr<AffinityStrand> affinity_strand;
+        {
+            boost::lock_guard lock(mutex_);
+            auto strand_it = group.empty() ? strands_.end() : strands_.find(group);
+            if (strand_it != strands_.end()) {
+                strand = strand_it->second;
+            }
+            auto affinity_it = group.empty() ? affinity_strands_.end() : affinity_strands_.find(group);
+            if (affinity_it != affinity_strands_.end()) {
+                affinity_strand = affinity_it->second;
+            }
+            timer_wheel = timer_wheel_;
+        }
+        handle->timer = std::make_shared<TaskTimer>(
+                            *io_context_, std::move(strand), std::move(timer_wheel), std::move(affinity_strand)
+                        );
     }
-    handle->promise = std::make_shared<boost::promise<bool>>();
+    handle->promise.emplace();
     handle->future = handle->promise->get_future().share();
 
     BROOKESIA_LOGD("Created Task[%1%] (group: %2%)", handle->id, group);
@@ -1027,18 +2427,21 @@ void TaskScheduler::schedule_once(std::shared_ptr<TaskHandle> handle, OnceTask t
                 BROOKESIA_LOGD("Task[%1%] timer was restarted, not removing", handle->id);
                 return;
             }
-            boost::lock_guard<boost::mutex> lock(mutex_);
-            remove_task_internal(handle->id, handle->group);
+            remove_task(*handle);
             return;
         }
 
+        const auto ready_time = handle->timer->expiry();
+
         // Invoke pre-execute callback when task is about to execute
         invoke_pre_execute_callback(handle->id, handle->type, handle->group);
 
         bool success = false;
+        const auto start_time = std::chrono::steady_clock::now();
         // Will be executed when the function exits
         lib_utils::FunctionGuard exit_guard(
-        [this, handle, &success]() {
+        [this, handle, &success, ready_time, start_time]() {
+            record_execution(*handle, ready_time, start_time);
             invoke_post_execute_callback(handle->id, handle->type, success, handle->group);
             mark_finished(handle, success);
         }
@@ -1079,8 +2482,7 @@ void TaskScheduler::schedule_periodic(std::shared_ptr<TaskHandle> handle, Period
                 BROOKESIA_LOGD("Periodic Task[%1%] timer was restarted, not removing", handle->id);
                 return;
             }
-            boost::lock_guard<boost::mutex> lock(mutex_);
-            remove_task_internal(handle->id, handle->group);
+            remove_task(*handle);
             return;
         }
 
@@ -1097,13 +2499,18 @@ void TaskScheduler::schedule_periodic(std::shared_ptr<TaskHandle> handle, Period
             return;
         }
 
+        // Read before the task re-arms the timer for its next period
+        const auto ready_time = handle->timer->expiry();
+
         // Invoke pre-execute callback when task is about to execute
         invoke_pre_execute_callback(handle->id, handle->type, handle->group);
 
         bool success = false;
+        const auto start_time = std::chrono::steady_clock::now();
         // Will be executed when the function exits
         lib_utils::FunctionGuard exit_guard(
-        [this, handle, &success]() {
+        [this, handle, &success, ready_time, start_time]() {
+            record_execution(*handle, ready_time, start_time);
             // Clear execution flag when task completes
             handle->is_executing.store(false);
             invoke_post_execute_callback(handle->id, handle->type, success, handle->group);
@@ -1136,8 +2543,9 @@ void TaskScheduler::cancel_internal(TaskId task_id)
 
     BROOKESIA_LOGD("Params: task_id(Task[%1%])", task_id);
 
-    auto it = tasks_.find(task_id);
-    if (it == tasks_.end()) {
+    auto &shard = get_task_shard(task_id);
+    auto it = shard.tasks.find(task_id);
+    if (it == shard.tasks.end()) {
         BROOKESIA_LOGD("Task[%1%] not found", task_id);
         return;
     }
@@ -1169,8 +2577,9 @@ bool TaskScheduler::suspend_internal(TaskId task_id)
 
     BROOKESIA_LOGD("Params: task_id(Task[%1%])", task_id);
 
-    auto it = tasks_.find(task_id);
-    if (it == tasks_.end()) {
+    auto &shard = get_task_shard(task_id);
+    auto it = shard.tasks.find(task_id);
+    if (it == shard.tasks.end()) {
         BROOKESIA_LOGW("Task[%1%] not found", task_id);
         return false;
     }
@@ -1214,8 +2623,9 @@ bool TaskScheduler::resume_internal(TaskId task_id)
 
     BROOKESIA_LOGD("Params: task_id(Task[%1%])", task_id);
 
-    auto it = tasks_.find(task_id);
-    if (it == tasks_.end()) {
+    auto &shard = get_task_shard(task_id);
+    auto it = shard.tasks.find(task_id);
+    if (it == shard.tasks.end()) {
         BROOKESIA_LOGW("Task[%1%] not found", task_id);
         return false;
     }
@@ -1295,8 +2705,7 @@ bool TaskScheduler::resume_internal(TaskId task_id)
             }
 
             if (ec || handle->state == TaskState::Canceled) {
-                boost::lock_guard<boost::mutex> lock(mutex_);
-                remove_task_internal(handle->id, handle->group);
+                remove_task(*handle);
                 return;
             }
 
@@ -1364,25 +2773,69 @@ void TaskScheduler::remove_task_internal(TaskId task_id, const Group &group)
 
     // Remove from group
     if (!group.empty()) {
+        boost::lock_guard<boost::mutex> lock(groups_mutex_);
         auto group_it = groups_.find(group);
         if (group_it != groups_.end()) {
-            group_it->second.erase(task_id);
-            if (group_it->second.empty()) {
+            group_it->second.task_ids.erase(task_id);
+            // Counters of unconfigured groups are released together with the group
+            if (group_it->second.task_ids.empty()) {
                 groups_.erase(group_it);
             }
         }
     }
 
     // Clean up task handle
-    auto it = tasks_.find(task_id);
-    if (it != tasks_.end()) {
+    auto &shard = get_task_shard(task_id);
+    auto it = shard.tasks.find(task_id);
+    if (it != shard.tasks.end()) {
         // Ensure timer is canceled and cleaned up
         if (it->second && it->second->timer) {
             it->second->timer->cancel();
             it->second->timer.reset();
         }
-        tasks_.erase(it);
+        shard.tasks.erase(it);
+    }
+}
+
+void TaskScheduler::remove_task(const TaskHandle &handle)
+{
+    boost::lock_guard<boost::mutex> lock(get_task_shard(handle.id).mutex);
+    remove_task_internal(handle.id, handle.group);
+}
+
+std::shared_ptr<TaskScheduler::TaskHandle> TaskScheduler::find_task(TaskId id) const
+{
+    auto &shard = get_task_shard(id);
+    boost::lock_guard<boost::mutex> lock(shard.mutex);
+    auto it = shard.tasks.find(id);
+
+    return (it != shard.tasks.end()) ? it->second : nullptr;
+}
+
+std::vector<TaskScheduler::TaskId> TaskScheduler::get_all_task_ids() const
+{
+    std::vector<TaskId> task_ids;
+    for (auto &shard : task_shards_) {
+        boost::lock_guard<boost::mutex> lock(shard.mutex);
+        task_ids.reserve(task_ids.size() + shard.tasks.size());
+        for (const auto& [id, handle] : shard.tasks) {
+            task_ids.push_back(id);
+        }
+    }
+
+    return task_ids;
+}
+
+bool TaskScheduler::get_group_task_ids(const Group &group, std::vector<TaskId> &task_ids) const
+{
+    boost::lock_guard<boost::mutex> lock(groups_mutex_);
+    auto group_it = groups_.find(group);
+    if (group_it == groups_.end()) {
+        return false;
     }
+    task_ids.assign(group_it->second.task_ids.begin(), group_it->second.task_ids.end());
+
+    return true;
 }
 
 void TaskScheduler::mark_finished(std::shared_ptr<TaskHandle> handle, bool success)
@@ -1399,7 +2852,7 @@ void TaskScheduler::mark_finished(std::shared_ptr<TaskHandle> handle, bool succe
         failed_tasks_++;
     }
 
-    boost::lock_guard<boost::mutex> lock(mutex_);
+    boost::lock_guard<boost::mutex> lock(get_task_shard(handle->id).mutex);
 
     if (handle->promise) {
         try {
@@ -1421,11 +2874,10 @@ boost::shared_future<bool> TaskScheduler::get_future(TaskId id)
 
     BROOKESIA_LOGD("Params: id(Task[%1%])", id);
 
-    boost::lock_guard<boost::mutex> lock(mutex_);
-    auto it = tasks_.find(id);
-    BROOKESIA_CHECK_FALSE_RETURN(it != tasks_.end(), boost::shared_future<bool>(), "Task[%1%] not found", id);
+    auto handle = find_task(id);
+    BROOKESIA_CHECK_NULL_RETURN(handle, boost::shared_future<bool>(), "Task[%1%] not found", id);
 
-    return it->second->future;
+    return handle->future;
 }
 
 void TaskScheduler::invoke_pre_execute_callback(TaskId task_id, TaskType task_type, const Group &group)
@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "unity.h"
+#include "unity_test_utils.h"
+
+// Some resources are lazy allocated in the driver, the threadhold is left for that case
+#define TEST_MEMORY_LEAK_THRESHOLD (0)
+
+void setUp(void)
+{
+    unity_utils_record_free_mem();
+}
+
+void tearDown(void)
+{
+    esp_reent_cleanup();    //clean up some of the newlib's lazy allocations
+    unity_utils_evaluate_leaks_direct(TEST_MEMORY_LEAK_THRESHOLD);
+}
+
+extern "C" void app_main(void)
+{
+    /**
+     *  ________  __    __  __    __   ______         ______   __    __   ______   _______   _______
+     * |        \|  \  |  \|  \  |  \ /      \       /      \ |  \  |  \ /      \ |       \ |       \
+     * | $$$$$$$$| $$  | $$| $$\ | $$|  $$$$$$\     |  $$$$$$\| $$  | $$|  $$$$$$\| $$$$$$$\| $$$$$$$\
+     * | $$__    | $$  | $$| $$$\| $$| $$   \$$     | $$ __\$$| $$  | $$| $$__| $$| $$__| $$| $$  | $$
+     * | $$  \   | $$  | $$| $$$$\ $$| $$           | $$|    \| $$  | $$| $$    $$| $$    $$| $$  | $$
+     * | $$$$$   | $$  | $$| $$\$$ $$| $$   __      | $$ \$$$$| $$  | $$| $$$$$$$$| $$$$$$$\| $$  | $$
+     * | $$      | $$__/ $$| $$ \$$$$| $$__/  \     | $$__| $$| $$__/ $$| $$  | $$| $$  | $$| $$__/ $$
+     * | $$       \$$    $$| $$  \$$$ \$$    $$______\$$    $$ \$$    $$| $$  | $$| $$  | $$| $$    $$
+     *  \$$        \$$$$$$  \$$   \$$  \$$$$$$|      \\$$$$$$   \$$$$$$  \$$   \$$ \$$   \$$ \$$$$$$$
+     *                                         \$$$$$$
+     */
+    printf(" ________  __    __  __    __   ______         ______   __    __   ______   _______   _______\r\n");
+    printf("|        \\|  \\  |  \\|  \\  |  \\ /      \\       /      \\ |  \\  |  \\ /      \\ |       \\ |       \\\r\n");
+    printf("| $$$$$$$$| $$  | $$| $$\\ | $$|  $$$$$$\\     |  $$$$$$\\| $$  | $$|  $$$$$$\\| $$$$$$$\\| $$$$$$$\\\r\n");
+    printf("| $$__    | $$  | $$| $$$\\| $$| $$   \\$$     | $$ __\\$$| $$  | $$| $$__| $$| $$__| $$| $$  | $$\r\n");
+    printf("| $$  \\   | $$  | $$| $$$$\\ $$| $$           | $$|    \\| $$  | $$| $$    $$| $$    $$| $$  | $$\r\n");
+    printf("| $$$$$   | $$  | $$| $$\\$$ $$| $$   __      | $$ \\$$$$| $$  | $$| $$$$$$$$| $$$$$$$\\| $$  | $$\r\n");
+    printf("| $$      | $$__/ $$| $$ \\$$$$| $$__/  \\     | $$__| $$| $$__/ $$| $$  | $$| $$  | $$| $$__/ $$\r\n");
+    printf("| $$       \\$$    $$| $$  \\$$$ \\$$    $$______\\$$    $$ \\$$    $$| $$  | $$| $$  | $$| $$    $$\r\n");
+    printf(" \\$$        \\$$$$$$  \\$$   \\$$  \\$$$$$$|      \\\\$$$$$$   \\$$$$$$  \\$$   \\$$ \\$$   \\$$ \\$$$$$$$\r\n");
+    printf("                                        \\$$$$$$\r\n");
+    unity_run_menu();
+}
@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <algorithm>
+#include <vector>
+#include "esp_timer.h"
+#include "unity.h"
+#include "brookesia/lib_utils/describe_helpers.hpp"
+#include "brookesia/lib_utils/log.hpp"
+#include "brookesia/lib_utils/pixel_convert.hpp"
+
+using namespace esp_brookesia::lib_utils;
+
+namespace {
+
+// A 320x240 frame, the size of the most common panels driven by the Display service
+constexpr uint32_t FRAME_WIDTH = 320;
+constexpr uint32_t FRAME_HEIGHT = 240;
+constexpr size_t FRAME_PIXELS = static_cast<size_t>(FRAME_WIDTH) * FRAME_HEIGHT;
+constexpr size_t ITERATIONS = 20;
+
+struct ThroughputResult {
+    PixelFormat src_format = PixelFormat::RGB565;
+    PixelFormat dst_format = PixelFormat::RGB565;
+    PixelRotation rotation = PixelRotation::None;
+    int64_t elapsed_us = 0;
+};
+
+ThroughputResult run_throughput_benchmark(PixelFormat src_format, PixelFormat dst_format, PixelRotation rotation)
+{
+    std::vector<uint8_t> src(FRAME_PIXELS * get_pixel_bytes(src_format));
+    std::vector<uint8_t> dst(FRAME_PIXELS * get_pixel_bytes(dst_format));
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<uint8_t>(i * 7);
+    }
+    const PixelRect src_rect = {
+        .width = FRAME_WIDTH,
+        .height = FRAME_HEIGHT,
+        .stride_bytes = 0,
+        .format = src_format,
+    };
+
+    auto start_us = esp_timer_get_time();
+    for (size_t i = 0; i < ITERATIONS; i++) {
+        TEST_ASSERT_TRUE(convert_pixel_rect(src.data(), src_rect, dst.data(), 0, dst_format, rotation));
+    }
+    return {
+        .src_format = src_format,
+        .dst_format = dst_format,
+        .rotation = rotation,
+        .elapsed_us = esp_timer_get_time() - start_us,
+    };
+}
+
+} // namespace
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+
+TEST_CASE("Test benchmark - format pairs", "[utils][pixel_convert][benchmark][format]")
+{
+    BROOKESIA_LOGI("=== Pixel Convert Format Pair Benchmark (%1%) ===", get_pixel_convert_kernel_name());
+
+    const std::vector<PixelFormat> formats = {
+        PixelFormat::RGB565, PixelFormat::RGB565Swapped, PixelFormat::RGB888, PixelFormat::ARGB8888,
+    };
+    std::vector<ThroughputResult> results;
+    for (auto src_format : formats) {
+        for (auto dst_format : formats) {
+            results.push_back(run_throughput_benchmark(src_format, dst_format, PixelRotation::None));
+        }
+    }
+
+    for (const auto &result : results) {
+        BROOKESIA_LOGI(
+            "%1% -> %2%: elapsed(%3% us), throughput(%4% Mpixel/s)", BROOKESIA_DESCRIBE_TO_STR(result.src_format),
+            BROOKESIA_DESCRIBE_TO_STR(result.dst_format), result.elapsed_us,
+            static_cast<double>(FRAME_PIXELS * ITERATIONS) / std::max<int64_t>(result.elapsed_us, 1)
+        );
+    }
+}
+
+TEST_CASE("Test benchmark - rotation", "[utils][pixel_convert][benchmark][rotation]")
+{
+    BROOKESIA_LOGI("=== Pixel Convert Rotation Benchmark (%1%) ===", get_pixel_convert_kernel_name());
+
+    const std::vector<PixelRotation> rotations = {
+        PixelRotation::None, PixelRotation::Rotate90, PixelRotation::Rotate180, PixelRotation::Rotate270,
+    };
+    std::vector<ThroughputResult> results;
+    for (auto rotation : rotations) {
+        results.push_back(run_throughput_benchmark(PixelFormat::RGB565, PixelFormat::RGB565Swapped, rotation));
+    }
+
+    for (const auto &result : results) {
+        BROOKESIA_LOGI(
+            "RGB565 -> RGB565Swapped %1%: elapsed(%2% us), throughput(%3% Mpixel/s)",
+            BROOKESIA_DESCRIBE_TO_STR(result.rotation), result.elapsed_us,
+            static_cast<double>(FRAME_PIXELS * ITERATIONS) / std::max<int64_t>(result.elapsed_us, 1)
+        );
+    }
+}
@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "unity.h"
+#include "brookesia/lib_utils/log.hpp"
+#include "brookesia/lib_utils/pixel_convert.hpp"
+
+using namespace esp_brookesia::lib_utils;
+
+namespace {
+
+// Every RGB565 value once, the odd count also exercises the scalar tail of the vector kernels
+constexpr size_t PIXEL_NUM = 65535;
+
+std::vector<uint8_t> make_rgb565_ramp()
+{
+    std::vector<uint8_t> data(PIXEL_NUM * 2);
+    for (size_t i = 0; i < PIXEL_NUM; i++) {
+        data[2 * i] = static_cast<uint8_t>(i & 0xFF);
+        data[2 * i + 1] = static_cast<uint8_t>(i >> 8);
+    }
+    return data;
+}
+
+void expand_rgb565(uint16_t pixel, uint8_t *argb)
+{
+    const uint8_t r = (pixel >> 11) & 0x1F;
+    const uint8_t g = (pixel >> 5) & 0x3F;
+    const uint8_t b = pixel & 0x1F;
+    argb[0] = static_cast<uint8_t>((b << 3) | (b >> 2));
+    argb[1] = static_cast<uint8_t>((g << 2) | (g >> 4));
+    argb[2] = static_cast<uint8_t>((r << 3) | (r >> 2));
+    argb[3] = 0xFF;
+}
+
+} // namespace
+
+TEST_CASE("Test pixel convert - rgb565 to argb8888", "[utils][pixel_convert][argb8888]")
+{
+    BROOKESIA_LOGI("Pixel convert kernels: %1%", get_pixel_convert_kernel_name());
+
+    auto rgb565 = make_rgb565_ramp();
+    std::vector<uint8_t> swapped(PIXEL_NUM * 2);
+    std::vector<uint8_t> argb(PIXEL_NUM * 4);
+    std::vector<uint8_t> expected(PIXEL_NUM * 4);
+    for (size_t i = 0; i < PIXEL_NUM; i++) {
+        expand_rgb565(static_cast<uint16_t>(i), expected.data() + i * 4);
+    }
+
+    TEST_ASSERT_TRUE(convert_pixels(rgb565.data(), PixelFormat::RGB565, argb.data(), PixelFormat::ARGB8888, PIXEL_NUM));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), argb.data(), argb.size());
+
+    TEST_ASSERT_TRUE(convert_pixels(
+                         rgb565.data(), PixelFormat::RGB565, swapped.data(), PixelFormat::RGB565Swapped, PIXEL_NUM
+                     ));
+    TEST_ASSERT_EQUAL_UINT8(rgb565[1], swapped[0]);
+    TEST_ASSERT_EQUAL_UINT8(rgb565[0], swapped[1]);
+    std::fill(argb.begin(), argb.end(), 0);
+    TEST_ASSERT_TRUE(convert_pixels(
+                         swapped.data(), PixelFormat::RGB565Swapped, argb.data(), PixelFormat::ARGB8888, PIXEL_NUM
+                     ));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), argb.data(), argb.size());
+}
+
+TEST_CASE("Test pixel convert - unaligned buffers", "[utils][pixel_convert][alignment]")
+{
+    // Vector kernels with aligned loads and stores peel a scalar prefix, cover every pixel offset of both buffers
+    constexpr size_t BUFFER_ALIGN = 16;
+    constexpr size_t COUNT = 100;
+    auto rgb565 = make_rgb565_ramp();
+    alignas(BUFFER_ALIGN) uint8_t src[(COUNT + BUFFER_ALIGN) * 2];
+    alignas(BUFFER_ALIGN) uint8_t argb[(COUNT + BUFFER_ALIGN) * 4];
+    alignas(BUFFER_ALIGN) uint8_t swapped[(COUNT + BUFFER_ALIGN) * 2];
+    uint8_t expected[COUNT * 4];
+
+    for (size_t src_offset = 0; src_offset < BUFFER_ALIGN; src_offset += 2) {
+        // Start the ramp at a different value for every source offset
+        const size_t first = src_offset * 0x811;
+        std::copy_n(rgb565.data() + first * 2, COUNT * 2, src + src_offset);
+        for (size_t i = 0; i < COUNT; i++) {
+            expand_rgb565(static_cast<uint16_t>(first + i), expected + i * 4);
+        }
+        for (size_t dst_offset = 0; dst_offset < BUFFER_ALIGN; dst_offset += 2) {
+            TEST_ASSERT_TRUE(convert_pixels(
+                                 src + src_offset, PixelFormat::RGB565, argb + dst_offset * 2, PixelFormat::ARGB8888,
+                                 COUNT
+                             ));
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, argb + dst_offset * 2, COUNT * 4);
+
+            TEST_ASSERT_TRUE(convert_pixels(
+                                 src + src_offset, PixelFormat::RGB565, swapped + dst_offset, PixelFormat::RGB565Swapped,
+                                 COUNT
+                             ));
+            for (size_t i = 0; i < COUNT; i++) {
+                TEST_ASSERT_EQUAL_UINT8(src[src_offset + 2 * i + 1], swapped[dst_offset + 2 * i]);
+                TEST_ASSERT_EQUAL_UINT8(src[src_offset + 2 * i], swapped[dst_offset + 2 * i + 1]);
+            }
+
+            std::fill(argb, argb + sizeof(argb), 0);
+            TEST_ASSERT_TRUE(convert_pixels(
+                                 swapped + dst_offset, PixelFormat::RGB565Swapped, argb + src_offset * 2,
+                                 PixelFormat::ARGB8888, COUNT
+                             ));
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, argb + src_offset * 2, COUNT * 4);
+        }
+    }
+}
+
+TEST_CASE("Test pixel convert - round trip", "[utils][pixel_convert][round_trip]")
+{
+    auto rgb565 = make_rgb565_ramp();
+    const std::vector<PixelFormat> formats = {
+        PixelFormat::RGB565Swapped, PixelFormat::RGB888, PixelFormat::ARGB8888,
+    };
+
+    for (auto format : formats) {
+        std::vector<uint8_t> converted(PIXEL_NUM * get_pixel_bytes(format));
+        std::vector<uint8_t> back(PIXEL_NUM * 2);
+        TEST_ASSERT_TRUE(convert_pixels(rgb565.data(), PixelFormat::RGB565, converted.data(), format, PIXEL_NUM));
+        TEST_ASSERT_TRUE(convert_pixels(converted.data(), format, back.data(), PixelFormat::RGB565, PIXEL_NUM));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(rgb565.data(), back.data(), back.size());
+    }
+
+    // Swapping bytes is the only conversion allowed to run in place
+    auto in_place = rgb565;
+    TEST_ASSERT_TRUE(convert_pixels(
+                         in_place.data(), PixelFormat::RGB565, in_place.data(), PixelFormat::RGB565Swapped, PIXEL_NUM
+                     ));
+    TEST_ASSERT_TRUE(convert_pixels(
+                         in_place.data(), PixelFormat::RGB565Swapped, in_place.data(), PixelFormat::RGB565, PIXEL_NUM
+                     ));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(rgb565.data(), in_place.data(), in_place.size());
+
+    TEST_ASSERT_FALSE(convert_pixels(nullptr, PixelFormat::RGB565, in_place.data(), PixelFormat::RGB888, 1));
+    TEST_ASSERT_FALSE(convert_pixels(rgb565.data(), PixelFormat::Max, in_place.data(), PixelFormat::RGB888, 1));
+}
+
+TEST_CASE("Test pixel convert - rect rotation", "[utils][pixel_convert][rotation]")
+{
+    // 3x2 image, each pixel holds its index
+    const std::vector<uint16_t> src = {0, 1, 2, 3, 4, 5};
+    const PixelRect src_rect = {
+        .width = 3,
+        .height = 2,
+        .stride_bytes = 0,
+        .format = PixelFormat::RGB565,
+    };
+    auto convert = [&](PixelRotation rotation) {
+        std::vector<uint16_t> dst(src.size());
+        TEST_ASSERT_TRUE(convert_pixel_rect(
+                             reinterpret_cast<const uint8_t *>(src.data()), src_rect,
+                             reinterpret_cast<uint8_t *>(dst.data()), 0, PixelFormat::RGB565, rotation
+                         ));
+        return dst;
+    };
+
+    const std::vector<uint16_t> rotate_90 = {3, 0, 4, 1, 5, 2};
+    const std::vector<uint16_t> rotate_180 = {5, 4, 3, 2, 1, 0};
+    const std::vector<uint16_t> rotate_270 = {2, 5, 1, 4, 0, 3};
+    TEST_ASSERT_TRUE(convert(PixelRotation::None) == src);
+    TEST_ASSERT_TRUE(convert(PixelRotation::Rotate90) == rotate_90);
+    TEST_ASSERT_TRUE(convert(PixelRotation::Rotate180) == rotate_180);
+    TEST_ASSERT_TRUE(convert(PixelRotation::Rotate270) == rotate_270);
+
+    // Write the top-left 2x2 of the source into a wider destination, the padding must stay untouched
+    const PixelRect sub_rect = {
+        .width = 2,
+        .height = 2,
+        .stride_bytes = 3 * sizeof(uint16_t),
+        .format = PixelFormat::RGB565,
+    };
+    std::vector<uint16_t> padded(8, 0xFFFF);
+    TEST_ASSERT_TRUE(convert_pixel_rect(
+                         reinterpret_cast<const uint8_t *>(src.data()), sub_rect,
+                         reinterpret_cast<uint8_t *>(padded.data()), 4 * sizeof(uint16_t), PixelFormat::RGB565
+                     ));
+    const std::vector<uint16_t> expected_padded = {0, 1, 0xFFFF, 0xFFFF, 3, 4, 0xFFFF, 0xFFFF};
+    TEST_ASSERT_TRUE(padded == expected_padded);
+}
@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "unity.h"
+#include "unity_test_utils.h"
+
+// Some resources are lazy allocated in the driver, the threadhold is left for that case
+#define TEST_MEMORY_LEAK_THRESHOLD (0)
+
+void setUp(void)
+{
+    unity_utils_record_free_mem();
+}
+
+void tearDown(void)
+{
+    esp_reent_cleanup();    //clean up some of the newlib's lazy allocations
+    unity_utils_evaluate_leaks_direct(TEST_MEMORY_LEAK_THRESHOLD);
+}
+
+extern "C" void app_main(void)
+{
+    /**
+     *   ______   ______   ______   __    __   ______   __
+     *  /      \ |      \ /      \ |  \  |  \ /      \ |  \
+     * |  $$$$$$\ \$$$$$$|  $$$$$$\| $$\ | $$|  $$$$$$\| $$
+     * | $$___\$$  | $$  | $$ __\$$| $$$\| $$| $$__| $$| $$
+     *  \$$    \   | $$  | $$|    \| $$$$\ $$| $$    $$| $$
+     *  _\$$$$$$\  | $$  | $$ \$$$$| $$\$$ $$| $$$$$$$$| $$
+     * |  \__| $$ _| $$_ | $$__| $$| $$ \$$$$| $$  | $$| $$_____
+     *  \$$    $$|   $$ \ \$$    $$| $$  \$$$| $$  | $$| $$     \
+     *   \$$$$$$  \$$$$$$  \$$$$$$  \$$   \$$ \$$   \$$ \$$$$$$$$
+     */
+    printf("  ______   ______   ______   __    __   ______   __\r\n");
+    printf(" /      \\ |      \\ /      \\ |  \\  |  \\ /      \\ |  \\\r\n");
+    printf("|  $$$$$$\\ \\$$$$$$|  $$$$$$\\| $$\\ | $$|  $$$$$$\\| $$\r\n");
+    printf("| $$___\\$$  | $$  | $$ __\\$$| $$$\\| $$| $$__| $$| $$\r\n");
+    printf(" \\$$    \\   | $$  | $$|    \\| $$$$\\ $$| $$    $$| $$\r\n");
+    printf(" _\\$$$$$$\\  | $$  | $$ \\$$$$| $$\\$$ $$| $$$$$$$$| $$\r\n");
+    printf("|  \\__| $$ _| $$_ | $$__| $$| $$ \\$$$$| $$  | $$| $$_____\r\n");
+    printf(" \\$$    $$|   $$ \\ \\$$    $$| $$  \\$$$| $$  | $$| $$     \\\r\n");
+    printf("  \\$$$$$$  \\$$$$$$  \\$$$$$$  \\$$   \\$$ \\$$   \\$$ \\$$$$$$$$\r\n");
+    unity_run_menu();
+}
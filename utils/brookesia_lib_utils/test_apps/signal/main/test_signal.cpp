@@ -0,0 +1,215 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "esp_timer.h"
+#include "unity.h"
+#include "brookesia/lib_utils/log.hpp"
+#include "brookesia/lib_utils/signal.hpp"
+
+using namespace esp_brookesia::lib_utils;
+
+namespace {
+
+constexpr int BENCHMARK_EMIT_NUM = 10000;
+
+/**
+ * Emission as done before the copy-on-write slot list: lock, copy the slot vector and touch every slot's refcount.
+ * Only used as the benchmark reference.
+ */
+class LockedSnapshotSignal {
+public:
+    void connect(std::function<void(int)> slot)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        slots_.push_back(std::make_shared<std::function<void(int)>>(std::move(slot)));
+    }
+
+    void operator()(int value) const
+    {
+        std::vector<std::shared_ptr<std::function<void(int)>>> snapshot;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            snapshot = slots_;
+        }
+        for (const auto &slot : snapshot) {
+            (*slot)(value);
+        }
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<std::function<void(int)>>> slots_;
+};
+
+template <typename Signal>
+int64_t measure_emit_ns(Signal &sig)
+{
+    // Warm up caches and the allocator before timing
+    for (int i = 0; i < 100; i++) {
+        sig(i);
+    }
+
+    auto start_us = esp_timer_get_time();
+    for (int i = 0; i < BENCHMARK_EMIT_NUM; i++) {
+        sig(i);
+    }
+    return (esp_timer_get_time() - start_us) * 1000 / BENCHMARK_EMIT_NUM;
+}
+
+} // namespace
+
+TEST_CASE("Test signal connect, emit and disconnect", "[utils][signal][basic]")
+{
+    BROOKESIA_LOGI("=== Signal Basic Test ===");
+
+    signal<void(int)> sig;
+    int sum = 0;
+    TEST_ASSERT_TRUE(sig.empty());
+
+    auto conn1 = sig.connect([&sum](int value) {
+        sum += value;
+    });
+    {
+        scoped_connection conn2 = sig.connect([&sum](int value) {
+            sum += value * 10;
+        });
+        TEST_ASSERT_EQUAL(2, sig.num_slots());
+        sig(1);
+        TEST_ASSERT_EQUAL(11, sum);
+    }
+
+    // The scoped connection is gone, only the first slot remains
+    TEST_ASSERT_EQUAL(1, sig.num_slots());
+    sig(1);
+    TEST_ASSERT_EQUAL(12, sum);
+
+    TEST_ASSERT_TRUE(conn1.connected());
+    conn1.disconnect();
+    TEST_ASSERT_FALSE(conn1.connected());
+    sig(1);
+    TEST_ASSERT_EQUAL(12, sum);
+    TEST_ASSERT_TRUE(sig.empty());
+}
+
+TEST_CASE("Test signal reentrant connect and disconnect", "[utils][signal][reentrant]")
+{
+    BROOKESIA_LOGI("=== Signal Reentrant Test ===");
+
+    signal<void()> sig;
+    int self_calls = 0;
+    int late_calls = 0;
+    int other_calls = 0;
+
+    connection self_conn;
+    self_conn = sig.connect([&]() {
+        self_calls++;
+        // Disconnect itself and connect a new slot while the signal is being emitted
+        self_conn.disconnect();
+        sig.connect([&late_calls]() {
+            late_calls++;
+        });
+    });
+    auto other_conn = sig.connect([&other_calls]() {
+        other_calls++;
+    });
+
+    sig();
+    // The slot connected during emission is only invoked by the next emission
+    TEST_ASSERT_EQUAL(1, self_calls);
+    TEST_ASSERT_EQUAL(0, late_calls);
+    TEST_ASSERT_EQUAL(1, other_calls);
+
+    sig();
+    TEST_ASSERT_EQUAL(1, self_calls);
+    TEST_ASSERT_EQUAL(1, late_calls);
+    TEST_ASSERT_EQUAL(2, other_calls);
+    TEST_ASSERT_EQUAL(2, sig.num_slots());
+
+    // Moved signals keep their connections
+    signal<void()> moved = std::move(sig);
+    moved();
+    TEST_ASSERT_EQUAL(3, other_calls);
+    TEST_ASSERT_TRUE(other_conn.connected());
+
+    moved.disconnect_all_slots();
+    TEST_ASSERT_FALSE(other_conn.connected());
+    moved();
+    TEST_ASSERT_EQUAL(3, other_calls);
+}
+
+TEST_CASE("Test signal concurrent emit and connect", "[utils][signal][concurrent]")
+{
+    BROOKESIA_LOGI("=== Signal Concurrent Test ===");
+
+    constexpr int EMIT_NUM = 2000;
+    constexpr int CONNECT_NUM = 200;
+
+    signal<void(int)> sig;
+    std::atomic<int> base_calls{0};
+    auto base_conn = sig.connect([&base_calls](int) {
+        base_calls++;
+    });
+
+    std::atomic<bool> is_running{true};
+    std::thread emitter([&]() {
+        for (int i = 0; i < EMIT_NUM; i++) {
+            sig(i);
+        }
+        is_running = false;
+    });
+
+    // Connect and disconnect slots while the other thread keeps emitting
+    std::atomic<int> churn_calls{0};
+    int connect_count = 0;
+    while (is_running.load() || (connect_count < CONNECT_NUM)) {
+        scoped_connection conn = sig.connect([&churn_calls](int) {
+            churn_calls++;
+        });
+        connect_count++;
+        std::this_thread::yield();
+    }
+    emitter.join();
+
+    // The long-lived slot saw every emission, the churned ones were all released
+    TEST_ASSERT_EQUAL(EMIT_NUM, base_calls.load());
+    TEST_ASSERT_EQUAL(1, sig.num_slots());
+    BROOKESIA_LOGI("%1% connections churned, %2% churn calls", connect_count, churn_calls.load());
+}
+
+TEST_CASE("Test benchmark - signal emit", "[utils][signal][benchmark]")
+{
+    BROOKESIA_LOGI("=== Signal Emit Benchmark ===");
+
+    for (int slot_num : {
+                1, 8, 64
+            }) {
+        volatile int sink = 0;
+        auto slot = [&sink](int value) {
+            sink = value;
+        };
+
+        signal<void(int)> sig;
+        std::vector<scoped_connection> connections;
+        LockedSnapshotSignal reference;
+        for (int i = 0; i < slot_num; i++) {
+            connections.emplace_back(sig.connect(slot));
+            reference.connect(slot);
+        }
+        TEST_ASSERT_EQUAL(slot_num, sig.num_slots());
+
+        auto emit_ns = measure_emit_ns(sig);
+        auto reference_ns = measure_emit_ns(reference);
+        BROOKESIA_LOGI(
+            "%1% slots: emit %2% ns (%3% ns/slot), locked snapshot reference %4% ns", slot_num, emit_ns,
+            emit_ns / slot_num, reference_ns
+        );
+    }
+}
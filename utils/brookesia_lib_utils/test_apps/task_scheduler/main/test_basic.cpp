@@ -3,9 +3,11 @@
  *
  * SPDX-License-Identifier: CC0-1.0
  */
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <future>
+#include <memory>
 #include <vector>
 #include "boost/chrono.hpp"
 #include "boost/thread/thread.hpp"
@@ -431,6 +433,166 @@ TEST_CASE("Test reset statistics", "[utils][task_scheduler][statistics][reset]")
     scheduler.stop();
 }
 
+TEST_CASE("Test handle pool reuse", "[utils][task_scheduler][statistics][handle_pool]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Handle Pool Reuse Test ===");
+
+    constexpr int task_count = 20;
+
+    auto run_sequential_tasks = [](size_t handle_pool_size) {
+        reset_counters();
+        TaskScheduler scheduler;
+        auto config = TaskScheduler::StartConfig{};
+        config.handle_pool_size = handle_pool_size;
+        TEST_ASSERT_TRUE(scheduler.start(config));
+
+        for (int i = 0; i < task_count; i++) {
+            TaskScheduler::TaskId task_id = 0;
+            TEST_ASSERT_TRUE(scheduler.post(simple_task, &task_id));
+            TEST_ASSERT_TRUE(scheduler.wait(task_id, 1000));
+            // Let the worker release the handle before the next post
+            vTaskDelay(pdMS_TO_TICKS(5));
+        }
+
+        auto stats = scheduler.get_statistics();
+        scheduler.stop();
+        BROOKESIA_LOGI("Statistics (pool size: %1%): %2%", handle_pool_size, BROOKESIA_DESCRIBE_TO_STR(stats));
+
+        return stats;
+    };
+
+    auto pooled_stats = run_sequential_tasks(4);
+    TEST_ASSERT_EQUAL(task_count, pooled_stats.handle_allocations + pooled_stats.handle_reuses);
+    TEST_ASSERT_TRUE(pooled_stats.handle_reuses > 0);
+    TEST_ASSERT_TRUE(pooled_stats.handle_allocations < task_count);
+
+    auto unpooled_stats = run_sequential_tasks(0);
+    TEST_ASSERT_EQUAL(task_count, unpooled_stats.handle_allocations);
+    TEST_ASSERT_EQUAL(0, unpooled_stats.handle_reuses);
+}
+
+TEST_CASE("Test closure storage in task handles", "[utils][task_scheduler][statistics][handle_pool]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Closure Storage Test ===");
+
+    TaskScheduler scheduler;
+    TEST_ASSERT_TRUE(scheduler.start());
+
+    std::atomic<int> sum{0};
+    TaskScheduler::TaskId task_id = 0;
+
+    // Small closures and `OnceTask` objects are stored in the task handle
+    TEST_ASSERT_TRUE(scheduler.post([&sum]() {
+        sum += 1;
+    }, &task_id));
+    TEST_ASSERT_TRUE(scheduler.wait(task_id, 1000));
+    TEST_ASSERT_TRUE(scheduler.post(TaskScheduler::OnceTask([&sum]() {
+        sum += 2;
+    }), &task_id));
+    TEST_ASSERT_TRUE(scheduler.wait(task_id, 1000));
+    TEST_ASSERT_EQUAL(0, scheduler.get_statistics().closure_heap_fallbacks);
+
+    // Move-only closures are accepted as well
+    auto value = std::make_unique<int>(4);
+    TEST_ASSERT_TRUE(scheduler.dispatch([&sum, value = std::move(value)]() {
+        sum += *value;
+    }, &task_id));
+    TEST_ASSERT_TRUE(scheduler.wait(task_id, 1000));
+    TEST_ASSERT_EQUAL(0, scheduler.get_statistics().closure_heap_fallbacks);
+
+    // Closures larger than the inline storage fall back to the heap
+    std::array<uint8_t, 128> payload{};
+    payload.back() = 8;
+    TEST_ASSERT_TRUE(scheduler.post([&sum, payload]() {
+        sum += payload.back();
+    }, &task_id));
+    TEST_ASSERT_TRUE(scheduler.wait(task_id, 1000));
+    TEST_ASSERT_EQUAL(1, scheduler.get_statistics().closure_heap_fallbacks);
+    TEST_ASSERT_EQUAL(15, sum.load());
+
+    scheduler.stop();
+}
+
+TEST_CASE("Test group statistics", "[utils][task_scheduler][statistics][group]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Group Statistics Test ===");
+
+    TaskScheduler scheduler;
+    TEST_ASSERT_TRUE(scheduler.start(TEST_SCHEDULER_CONFIG_GENERIC));
+    // Statistics of configured groups outlive their tasks
+    TEST_ASSERT_TRUE(scheduler.configure_group("slow", TaskScheduler::GroupConfig{}));
+    TEST_ASSERT_TRUE(scheduler.configure_group("periodic", TaskScheduler::GroupConfig{}));
+
+    // Slow immediate tasks, the later ones also wait behind the earlier ones on the single worker
+    constexpr int slow_task_count = 3;
+    for (int i = 0; i < slow_task_count; i++) {
+        TEST_ASSERT_TRUE(scheduler.post([]() {
+            vTaskDelay(pdMS_TO_TICKS(20));
+        }, nullptr, "slow"));
+    }
+
+    // Periodic task whose execution exceeds its interval
+    constexpr int periodic_run_count = 3;
+    std::atomic<int> periodic_runs{0};
+    TaskScheduler::TaskId periodic_id = 0;
+    TEST_ASSERT_TRUE(scheduler.post_periodic([&periodic_runs]() {
+        vTaskDelay(pdMS_TO_TICKS(15));
+        return ++periodic_runs < periodic_run_count;
+    }, 10, &periodic_id, "periodic"));
+
+    TaskScheduler::TaskId quick_id = 0;
+    TEST_ASSERT_TRUE(scheduler.post(simple_task, &quick_id));
+    // Statistics of an unconfigured group are dropped once the group is removed
+    TEST_ASSERT_TRUE(scheduler.post(simple_task, nullptr, "ad_hoc"));
+
+    TEST_ASSERT_TRUE(scheduler.wait_all(2000));
+    // Statistics of the last execution are recorded right after its completion is signaled
+    vTaskDelay(pdMS_TO_TICKS(20));
+
+    auto all_stats = scheduler.get_group_statistics();
+    BROOKESIA_LOGI("Group statistics: %1%", BROOKESIA_DESCRIBE_TO_STR(all_stats));
+    TEST_ASSERT_EQUAL(3, all_stats.size());
+
+    auto sum_histogram = [](const std::vector<size_t> &histogram) {
+        size_t sum = 0;
+        for (auto count : histogram) {
+            sum += count;
+        }
+        return sum;
+    };
+
+    auto slow_stats = scheduler.get_group_statistics("slow");
+    TEST_ASSERT_TRUE(slow_stats.has_value());
+    TEST_ASSERT_EQUAL(slow_task_count, slow_stats->executed_tasks);
+    TEST_ASSERT_EQUAL(TaskScheduler::LATENCY_HISTOGRAM_BUCKET_NUM, slow_stats->execution_histogram.size());
+    TEST_ASSERT_EQUAL(slow_task_count, sum_histogram(slow_stats->execution_histogram));
+    TEST_ASSERT_EQUAL(slow_task_count, sum_histogram(slow_stats->queue_wait_histogram));
+    TEST_ASSERT_TRUE(slow_stats->max_execution_us >= 15000);
+    TEST_ASSERT_TRUE(slow_stats->max_queue_wait_us >= 15000);
+    TEST_ASSERT_EQUAL(0, slow_stats->periodic_overruns);
+
+    auto periodic_stats = scheduler.get_group_statistics("periodic");
+    TEST_ASSERT_TRUE(periodic_stats.has_value());
+    TEST_ASSERT_EQUAL(periodic_run_count, periodic_stats->executed_tasks);
+    TEST_ASSERT_EQUAL(periodic_run_count, periodic_stats->periodic_overruns);
+
+    auto ungrouped_stats = scheduler.get_group_statistics("");
+    TEST_ASSERT_TRUE(ungrouped_stats.has_value());
+    TEST_ASSERT_EQUAL(1, ungrouped_stats->executed_tasks);
+
+    TEST_ASSERT_FALSE(scheduler.get_group_statistics("unknown").has_value());
+    TEST_ASSERT_FALSE(scheduler.get_group_statistics("ad_hoc").has_value());
+
+    scheduler.reset_statistics();
+    slow_stats = scheduler.get_group_statistics("slow");
+    TEST_ASSERT_TRUE(slow_stats.has_value());
+    TEST_ASSERT_EQUAL(0, slow_stats->executed_tasks);
+    TEST_ASSERT_EQUAL(0, sum_histogram(slow_stats->execution_histogram));
+    TEST_ASSERT_EQUAL(0, slow_stats->max_execution_us);
+
+    scheduler.stop();
+}
+
 // ============================================================================
 // Thread config tests
 // ============================================================================
@@ -717,6 +879,69 @@ TEST_CASE("Test performance", "[utils][task_scheduler][performance][basic]")
 }
 #endif
 
+TEST_CASE("Test blocking worker mode latency", "[utils][task_scheduler][performance][worker_mode]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Blocking Worker Mode Latency Test ===");
+
+    const int task_count = 20;
+    auto measure = [task_count](TaskScheduler::WorkerMode mode) {
+        TaskScheduler scheduler;
+        TaskScheduler::StartConfig config{
+            .worker_poll_interval_ms = 10,
+            .worker_mode = mode,
+        };
+        TEST_ASSERT_TRUE(scheduler.start(config));
+
+        for (int i = 0; i < task_count; i++) {
+            TaskScheduler::TaskId task_id = 0;
+            TEST_ASSERT_TRUE(scheduler.post(simple_task, &task_id));
+            TEST_ASSERT_TRUE(scheduler.wait(task_id, 1000));
+            // Let the worker go idle so every post has to wake it up again
+            vTaskDelay(pdMS_TO_TICKS(2));
+        }
+
+        auto stats = scheduler.get_statistics();
+        scheduler.stop();
+
+        TEST_ASSERT_EQUAL(task_count, stats.latency_samples);
+        return stats;
+    };
+
+    reset_counters();
+    auto polling_stats = measure(TaskScheduler::WorkerMode::Polling);
+    auto blocking_stats = measure(TaskScheduler::WorkerMode::Blocking);
+    TEST_ASSERT_EQUAL(task_count * 2, g_counter.load());
+
+    auto polling_avg_us = polling_stats.total_latency_us / polling_stats.latency_samples;
+    auto blocking_avg_us = blocking_stats.total_latency_us / blocking_stats.latency_samples;
+    BROOKESIA_LOGI(
+        "Post-to-execute latency: polling avg(%1% us) max(%2% us), blocking avg(%3% us) max(%4% us)",
+        polling_avg_us, polling_stats.max_latency_us, blocking_avg_us, blocking_stats.max_latency_us
+    );
+    TEST_ASSERT_TRUE(blocking_avg_us < polling_avg_us);
+}
+
+TEST_CASE("Test blocking worker mode stop", "[utils][task_scheduler][worker_mode][start_stop]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Blocking Worker Mode Stop Test ===");
+
+    reset_counters();
+    TaskScheduler scheduler;
+    TaskScheduler::StartConfig config = TEST_SCHEDULER_CONFIG_TWO_THREADS;
+    config.worker_mode = TaskScheduler::WorkerMode::Blocking;
+    TEST_ASSERT_TRUE(scheduler.start(config));
+
+    TaskScheduler::TaskId delayed_id = 0;
+    TEST_ASSERT_TRUE(scheduler.post_delayed(simple_task, 50, &delayed_id));
+    TEST_ASSERT_TRUE(scheduler.wait(delayed_id, 1000));
+    TEST_ASSERT_EQUAL(1, g_counter.load());
+
+    // Idle workers are blocked in `run_one()` and must still be released by `stop()`
+    vTaskDelay(pdMS_TO_TICKS(50));
+    scheduler.stop();
+    TEST_ASSERT_FALSE(scheduler.is_running());
+}
+
 // ============================================================================
 // Multiple schedulers coexistence tests
 // ============================================================================
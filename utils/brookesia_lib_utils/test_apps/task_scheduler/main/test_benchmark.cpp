@@ -0,0 +1,294 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <string>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "unity.h"
+#include "brookesia/lib_utils/describe_helpers.hpp"
+#include "brookesia/lib_utils/log.hpp"
+#include "brookesia/lib_utils/task_scheduler.hpp"
+
+using namespace esp_brookesia::lib_utils;
+
+namespace {
+
+struct TimerResult {
+    TaskScheduler::TimerBackend backend = TaskScheduler::TimerBackend::Asio;
+    size_t timer_num = 0;
+    int64_t post_us = 0;
+    int64_t cancel_us = 0;
+    size_t executions = 0;
+    TaskScheduler::Statistics probe_stats;
+};
+
+struct WorkerModeResult {
+    TaskScheduler::WorkerMode mode = TaskScheduler::WorkerMode::Blocking;
+    int64_t elapsed_us = 0;
+    size_t executed = 0;
+    int64_t p50_latency_us = 0;
+    int64_t p99_latency_us = 0;
+    int64_t max_latency_us = 0;
+    size_t stolen_tasks = 0;
+};
+
+struct ContentionResult {
+    size_t worker_num = 0;
+    int64_t elapsed_us = 0;
+    size_t executed = 0;
+};
+
+TaskScheduler::StartConfig make_benchmark_config(size_t worker_num)
+{
+    TaskScheduler::StartConfig config{
+        .worker_configs = {},
+        .worker_mode = TaskScheduler::WorkerMode::Blocking,
+    };
+    for (size_t i = 0; i < worker_num; i++) {
+        config.worker_configs.push_back(ThreadConfig{
+            .name = "TS_Bench" + std::to_string(i),
+            .core_id = static_cast<int>(i % 2),
+            .stack_size = 8192,
+        });
+    }
+    return config;
+}
+
+/**
+ * Several producer threads post short tasks while the workers execute and retire them, so `post()`, the worker's
+ * task lookup and `mark_finished()` all hit the task table at the same time.
+ */
+ContentionResult run_contention_benchmark(size_t worker_num, size_t producer_num, size_t tasks_per_producer)
+{
+    TaskScheduler scheduler;
+    TEST_ASSERT_TRUE(scheduler.start(make_benchmark_config(worker_num)));
+    TEST_ASSERT_TRUE(scheduler.configure_group("bench_group", {}));
+
+    std::atomic<size_t> executed{0};
+    std::vector<std::future<void>> producers;
+    auto start_us = esp_timer_get_time();
+    for (size_t producer = 0; producer < producer_num; producer++) {
+        producers.push_back(std::async(std::launch::async, [&scheduler, &executed, producer, tasks_per_producer]() {
+            // Half of the producers use a group to also exercise the group index
+            const TaskScheduler::Group group = (producer % 2) ? "bench_group" : "";
+            for (size_t i = 0; i < tasks_per_producer; i++) {
+                scheduler.post([&executed]() {
+                    executed.fetch_add(1, std::memory_order_relaxed);
+                }, nullptr, group);
+            }
+        }));
+    }
+    for (auto &producer : producers) {
+        producer.get();
+    }
+    TEST_ASSERT_TRUE(scheduler.wait_all(10000));
+    auto elapsed_us = esp_timer_get_time() - start_us;
+
+    scheduler.stop();
+
+    return {
+        .worker_num = worker_num,
+        .elapsed_us = elapsed_us,
+        .executed = executed.load(),
+    };
+}
+
+/**
+ * Producers post short tasks of uneven cost, each task records its own post-to-execute latency so that the tail of
+ * the distribution can be compared between the shared io_context queue and the work stealing deques.
+ */
+WorkerModeResult run_worker_mode_benchmark(
+    TaskScheduler::WorkerMode mode, size_t worker_num, size_t producer_num, size_t tasks_per_producer
+)
+{
+    TaskScheduler scheduler;
+    auto config = make_benchmark_config(worker_num);
+    config.worker_mode = mode;
+    TEST_ASSERT_TRUE(scheduler.start(config));
+
+    const size_t task_num = producer_num * tasks_per_producer;
+    std::vector<int64_t> latencies_us(task_num, 0);
+    std::atomic<size_t> executed{0};
+    std::vector<std::future<void>> producers;
+    auto start_us = esp_timer_get_time();
+    for (size_t producer = 0; producer < producer_num; producer++) {
+        producers.push_back(std::async(std::launch::async, [&, producer]() {
+            for (size_t i = 0; i < tasks_per_producer; i++) {
+                const auto index = producer * tasks_per_producer + i;
+                const auto post_us = esp_timer_get_time();
+                scheduler.post([&latencies_us, &executed, index, post_us]() {
+                    latencies_us[index] = esp_timer_get_time() - post_us;
+                    // Every 16th task is heavier, so some workers fall behind and the others have to catch up
+                    if ((index % 16) == 0) {
+                        volatile uint32_t sum = 0;
+                        for (uint32_t j = 0; j < 20000; j++) {
+                            sum = sum + j;
+                        }
+                    }
+                    executed.fetch_add(1, std::memory_order_relaxed);
+                });
+            }
+        }));
+    }
+    for (auto &producer : producers) {
+        producer.get();
+    }
+    TEST_ASSERT_TRUE(scheduler.wait_all(10000));
+    auto elapsed_us = esp_timer_get_time() - start_us;
+    auto stats = scheduler.get_statistics();
+
+    scheduler.stop();
+
+    std::sort(latencies_us.begin(), latencies_us.end());
+
+    return {
+        .mode = mode,
+        .elapsed_us = elapsed_us,
+        .executed = executed.load(),
+        .p50_latency_us = latencies_us[task_num / 2],
+        .p99_latency_us = latencies_us[task_num * 99 / 100],
+        .max_latency_us = latencies_us.back(),
+        .stolen_tasks = stats.stolen_tasks,
+    };
+}
+
+/**
+ * Many periodic timers run while a probe posts immediate tasks, so the timer backend cost shows up as setup time,
+ * cancel time and post-to-execute latency of the probe tasks.
+ */
+TimerResult run_timer_benchmark(TaskScheduler::TimerBackend backend, size_t timer_num)
+{
+    constexpr int timer_interval_ms = 50;
+    constexpr int run_time_ms = 1000;
+    constexpr int probe_interval_ms = 10;
+
+    TaskScheduler scheduler;
+    auto config = make_benchmark_config(2);
+    config.timer_backend = backend;
+    TEST_ASSERT_TRUE(scheduler.start(config));
+
+    std::atomic<size_t> executions{0};
+    auto start_us = esp_timer_get_time();
+    for (size_t i = 0; i < timer_num; i++) {
+        TEST_ASSERT_TRUE(scheduler.post_periodic([&executions]() {
+            executions.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }, timer_interval_ms));
+    }
+    auto post_us = esp_timer_get_time() - start_us;
+
+    scheduler.reset_statistics();
+    for (int elapsed_ms = 0; elapsed_ms < run_time_ms; elapsed_ms += probe_interval_ms) {
+        scheduler.post([]() {});
+        vTaskDelay(pdMS_TO_TICKS(probe_interval_ms));
+    }
+    auto probe_stats = scheduler.get_statistics();
+
+    start_us = esp_timer_get_time();
+    scheduler.cancel_all();
+    auto cancel_us = esp_timer_get_time() - start_us;
+
+    scheduler.stop();
+
+    return {
+        .backend = backend,
+        .timer_num = timer_num,
+        .post_us = post_us,
+        .cancel_us = cancel_us,
+        .executions = executions.load(),
+        .probe_stats = probe_stats,
+    };
+}
+
+} // namespace
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+
+TEST_CASE("Test benchmark - task table contention", "[utils][task_scheduler][benchmark][contention]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Task Table Contention Benchmark ===");
+
+    constexpr size_t producer_num = 4;
+    constexpr size_t tasks_per_producer = 500;
+    const std::vector<size_t> worker_nums = {1, 2, 4};
+
+    std::vector<ContentionResult> results;
+    for (auto worker_num : worker_nums) {
+        auto result = run_contention_benchmark(worker_num, producer_num, tasks_per_producer);
+        TEST_ASSERT_EQUAL(producer_num * tasks_per_producer, result.executed);
+        results.push_back(result);
+    }
+
+    for (const auto &result : results) {
+        BROOKESIA_LOGI(
+            "workers(%1%) producers(%2%) tasks(%3%): elapsed(%4% us), throughput(%5% tasks/s)", result.worker_num,
+            producer_num, result.executed, result.elapsed_us,
+            static_cast<int64_t>(result.executed * 1000000LL / std::max<int64_t>(result.elapsed_us, 1))
+        );
+    }
+}
+
+TEST_CASE("Test benchmark - timer backends", "[utils][task_scheduler][benchmark][timer_wheel]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Timer Backend Benchmark ===");
+
+    const std::vector<size_t> timer_nums = {10, 100, 1000};
+    const std::vector<TaskScheduler::TimerBackend> backends = {
+        TaskScheduler::TimerBackend::Asio, TaskScheduler::TimerBackend::Wheel
+    };
+
+    std::vector<TimerResult> results;
+    for (auto timer_num : timer_nums) {
+        for (auto backend : backends) {
+            auto result = run_timer_benchmark(backend, timer_num);
+            TEST_ASSERT_TRUE(result.executions > 0);
+            results.push_back(result);
+        }
+    }
+
+    for (const auto &result : results) {
+        const auto &stats = result.probe_stats;
+        BROOKESIA_LOGI(
+            "%1%: timers(%2%) post(%3% us) cancel(%4% us) executions(%5%), probe latency: avg(%6% us), max(%7% us)",
+            BROOKESIA_DESCRIBE_TO_STR(result.backend), result.timer_num, result.post_us, result.cancel_us,
+            result.executions, stats.total_latency_us / std::max<size_t>(stats.latency_samples, 1), stats.max_latency_us
+        );
+    }
+}
+
+TEST_CASE("Test benchmark - work stealing", "[utils][task_scheduler][benchmark][work_stealing]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Work Stealing Benchmark ===");
+
+    constexpr size_t worker_num = 4;
+    constexpr size_t producer_num = 4;
+    constexpr size_t tasks_per_producer = 500;
+    const std::vector<TaskScheduler::WorkerMode> modes = {
+        TaskScheduler::WorkerMode::Blocking, TaskScheduler::WorkerMode::WorkStealing
+    };
+
+    std::vector<WorkerModeResult> results;
+    for (auto mode : modes) {
+        auto result = run_worker_mode_benchmark(mode, worker_num, producer_num, tasks_per_producer);
+        TEST_ASSERT_EQUAL(producer_num * tasks_per_producer, result.executed);
+        results.push_back(result);
+    }
+
+    for (const auto &result : results) {
+        BROOKESIA_LOGI(
+            "%1%: tasks(%2%) elapsed(%3% us) throughput(%4% tasks/s), latency: p50(%5% us), p99(%6% us), "
+            "max(%7% us), stolen(%8%)", BROOKESIA_DESCRIBE_TO_STR(result.mode), result.executed, result.elapsed_us,
+            static_cast<int64_t>(result.executed * 1000000LL / std::max<int64_t>(result.elapsed_us, 1)),
+            result.p50_latency_us, result.p99_latency_us, result.max_latency_us, result.stolen_tasks
+        );
+    }
+}
@@ -0,0 +1,236 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <atomic>
+#include <stdexcept>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "unity.h"
+#include "brookesia/lib_utils/coroutine.hpp"
+#include "brookesia/lib_utils/log.hpp"
+#include "brookesia/lib_utils/task_scheduler.hpp"
+
+using namespace esp_brookesia::lib_utils;
+
+#define TEST_SCHEDULER_CONFIG_SINGLE_WORKER TaskScheduler::StartConfig{ \
+    .worker_configs = {                                                 \
+        {.name = "TS_Worker", .stack_size = 8192},                      \
+    },                                                                  \
+    .worker_poll_interval_ms = 1                                        \
+}
+
+#define TEST_SCHEDULER_CONFIG_DUAL_WORKER TaskScheduler::StartConfig{ \
+    .worker_configs = {                                               \
+        {.name = "TS_Worker0", .stack_size = 8192},                   \
+        {.name = "TS_Worker1", .stack_size = 8192},                   \
+    },                                                                \
+    .worker_poll_interval_ms = 1                                      \
+}
+
+static bool wait_for_count(const std::atomic<int> &counter, int expected, int timeout_ms)
+{
+    auto deadline = esp_timer_get_time() + timeout_ms * 1000;
+    while (counter.load() < expected) {
+        if (esp_timer_get_time() > deadline) {
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    return true;
+}
+
+static Coroutine<> sleep_and_count(TaskScheduler &scheduler, int delay_ms, std::atomic<int> &counter)
+{
+    bool slept = co_await scheduler.sleep(delay_ms);
+    if (slept) {
+        counter++;
+    }
+}
+
+static Coroutine<int> delayed_value(TaskScheduler &scheduler, int value)
+{
+    co_await scheduler.sleep(20);
+    co_return value * 2;
+}
+
+static Coroutine<int> delayed_throw(TaskScheduler &scheduler)
+{
+    co_await scheduler.sleep(20);
+    throw std::runtime_error("expected failure");
+    co_return 0;
+}
+
+TEST_CASE("Test coroutine sleep does not block workers", "[utils][task_scheduler][coroutine][sleep]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Coroutine Sleep Test ===");
+
+    TaskScheduler scheduler;
+    TEST_ASSERT_TRUE(scheduler.start(TEST_SCHEDULER_CONFIG_SINGLE_WORKER));
+
+    constexpr int COROUTINE_NUM = 8;
+    constexpr int SLEEP_MS = 200;
+    std::atomic<int> counter{0};
+
+    auto start = esp_timer_get_time();
+    for (int i = 0; i < COROUTINE_NUM; i++) {
+        TEST_ASSERT_TRUE(scheduler.co_spawn(sleep_and_count(scheduler, SLEEP_MS, counter)));
+    }
+
+    // A single worker serves every coroutine, so they only finish together if sleeping never blocks it
+    TEST_ASSERT_TRUE(wait_for_count(counter, COROUTINE_NUM, SLEEP_MS * 3));
+    auto elapsed_ms = (esp_timer_get_time() - start) / 1000;
+    BROOKESIA_LOGI("%1% coroutines slept %2% ms in %3% ms", COROUTINE_NUM, SLEEP_MS, elapsed_ms);
+    TEST_ASSERT_GREATER_OR_EQUAL(SLEEP_MS - 10, elapsed_ms);
+    TEST_ASSERT_LESS_THAN(SLEEP_MS * 2, elapsed_ms);
+
+    scheduler.stop();
+}
+
+TEST_CASE("Test coroutine switch_to group", "[utils][task_scheduler][coroutine][group]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Coroutine Switch Group Test ===");
+
+    TaskScheduler scheduler;
+    TEST_ASSERT_TRUE(scheduler.start(TEST_SCHEDULER_CONFIG_DUAL_WORKER));
+    TEST_ASSERT_TRUE(scheduler.configure_group("co_serial", {.enable_serial_execution = true}));
+
+    std::atomic<int> in_group_count{0};
+    std::atomic<int> done_count{0};
+    auto coroutine = [&]() -> Coroutine<> {
+        if (co_await scheduler.switch_to("co_serial")) {
+            in_group_count += scheduler.is_current_thread_in_group("co_serial") ? 1 : 0;
+        }
+        // Already in the group, no suspension is needed
+        if (co_await scheduler.switch_to("co_serial")) {
+            in_group_count += scheduler.is_current_thread_in_group("co_serial") ? 1 : 0;
+        }
+        if (co_await scheduler.sleep(10, "co_serial")) {
+            in_group_count += scheduler.is_current_thread_in_group("co_serial") ? 1 : 0;
+        }
+        done_count++;
+    };
+    TEST_ASSERT_TRUE(scheduler.co_spawn(coroutine()));
+
+    TEST_ASSERT_TRUE(wait_for_count(done_count, 1, 1000));
+    TEST_ASSERT_EQUAL(3, in_group_count.load());
+
+    scheduler.stop();
+}
+
+TEST_CASE("Test coroutine nested results and exceptions", "[utils][task_scheduler][coroutine][nested]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Coroutine Nested Test ===");
+
+    TaskScheduler scheduler;
+    TEST_ASSERT_TRUE(scheduler.start(TEST_SCHEDULER_CONFIG_SINGLE_WORKER));
+
+    std::atomic<int> value{0};
+    std::atomic<int> caught_count{0};
+    std::atomic<int> done_count{0};
+    auto coroutine = [&]() -> Coroutine<> {
+        value = co_await delayed_value(scheduler, 21);
+        try {
+            co_await delayed_throw(scheduler);
+        } catch (const std::runtime_error &) {
+            caught_count++;
+        }
+        done_count++;
+    };
+    TEST_ASSERT_TRUE(scheduler.co_spawn(coroutine()));
+
+    // An exception escaping a spawned coroutine is logged instead of terminating the worker
+    auto throwing = [&]() -> Coroutine<> {
+        co_await delayed_throw(scheduler);
+        value = -1;
+    };
+    TEST_ASSERT_TRUE(scheduler.co_spawn(throwing()));
+
+    TEST_ASSERT_TRUE(wait_for_count(done_count, 1, 1000));
+    TEST_ASSERT_TRUE(scheduler.wait_all(1000));
+    TEST_ASSERT_EQUAL(42, value.load());
+    TEST_ASSERT_EQUAL(1, caught_count.load());
+
+    scheduler.stop();
+}
+
+TEST_CASE("Test coroutine callback awaiter", "[utils][task_scheduler][coroutine][callback]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Coroutine Callback Awaiter Test ===");
+
+    TaskScheduler scheduler;
+    TEST_ASSERT_TRUE(scheduler.start(TEST_SCHEDULER_CONFIG_SINGLE_WORKER));
+
+    std::atomic<int> sum{0};
+    std::atomic<int> done_count{0};
+    auto coroutine = [&]() -> Coroutine<> {
+        // Completed later from a delayed task
+        sum += co_await CallbackAwaiter<int>([&](CallbackAwaiter<int>::Completion completion) {
+            return scheduler.post_delayed([completion]() {
+                completion(1);
+            }, 20);
+        }, -100);
+        // Completed inline before the starter returns
+        sum += co_await CallbackAwaiter<int>([](CallbackAwaiter<int>::Completion completion) {
+            completion(10);
+            return true;
+        }, -100);
+        // Rejected, the fallback is yielded without suspending
+        sum += co_await CallbackAwaiter<int>([](CallbackAwaiter<int>::Completion) {
+            return false;
+        }, 100);
+        done_count++;
+    };
+    TEST_ASSERT_TRUE(scheduler.co_spawn(coroutine()));
+
+    TEST_ASSERT_TRUE(wait_for_count(done_count, 1, 1000));
+    TEST_ASSERT_EQUAL(111, sum.load());
+
+    scheduler.stop();
+}
+
+TEST_CASE("Test coroutine release on scheduler stop", "[utils][task_scheduler][coroutine][stop]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Coroutine Stop Test ===");
+
+    struct DestroyCounter {
+        ~DestroyCounter()
+        {
+            counter++;
+        }
+        std::atomic<int> &counter;
+    };
+
+    TaskScheduler scheduler;
+    std::atomic<int> destroy_count{0};
+    std::atomic<int> resume_count{0};
+    auto coroutine = [&]() -> Coroutine<> {
+        DestroyCounter guard{destroy_count};
+        co_await scheduler.sleep(1000);
+        resume_count++;
+    };
+
+    // Not running, the coroutine is released without running
+    TEST_ASSERT_FALSE(scheduler.co_spawn(coroutine()));
+    TEST_ASSERT_EQUAL(0, destroy_count.load());
+
+    TEST_ASSERT_TRUE(scheduler.start(TEST_SCHEDULER_CONFIG_SINGLE_WORKER));
+    TEST_ASSERT_TRUE(scheduler.co_spawn(coroutine()));
+    vTaskDelay(pdMS_TO_TICKS(50));
+    TEST_ASSERT_EQUAL(0, destroy_count.load());
+
+    scheduler.stop();
+    TEST_ASSERT_EQUAL(0, resume_count.load());
+    TEST_ASSERT_EQUAL(1, destroy_count.load());
+
+    // Awaiting on a stopped scheduler yields `false` without suspending
+    bool slept = true;
+    auto stopped = [&]() -> Coroutine<> {
+        slept = co_await scheduler.sleep(10);
+    };
+    // Resumed directly on this thread, the detached frame releases itself once finished
+    stopped().detach().resume();
+    TEST_ASSERT_FALSE(slept);
+}
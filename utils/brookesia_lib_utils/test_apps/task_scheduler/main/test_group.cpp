@@ -6,6 +6,9 @@
 #include <atomic>
 #include <chrono>
 #include <future>
+#include <mutex>
+#include <set>
+#include <string>
 #include <vector>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -467,3 +470,260 @@ TEST_CASE("Test group strand with mixed task types", "[utils][task_scheduler][gr
 
     scheduler.stop();
 }
+
+TEST_CASE("Test work stealing serial group affinity", "[utils][task_scheduler][group][work_stealing]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Work Stealing Serial Group Affinity Test ===");
+
+    TaskScheduler scheduler;
+    auto config = TEST_SCHEDULER_CONFIG_FOUR_THREADS;
+    config.worker_mode = TaskScheduler::WorkerMode::WorkStealing;
+    TEST_ASSERT_TRUE(scheduler.start(config));
+    TEST_ASSERT_TRUE(scheduler.configure_group("serial_group", {.enable_serial_execution = true}));
+
+    constexpr int task_count = 50;
+    std::mutex mutex;
+    std::vector<int> execution_order;
+    std::set<boost::thread::id> serial_threads;
+    std::atomic<int> concurrent_count{0};
+    std::atomic<int> max_concurrent{0};
+    std::atomic<bool> in_group_mismatch{false};
+    for (int i = 0; i < task_count; i++) {
+        TEST_ASSERT_TRUE(scheduler.post([&, i]() {
+            int current = concurrent_count.fetch_add(1) + 1;
+            int max = max_concurrent.load();
+            while ((current > max) && !max_concurrent.compare_exchange_weak(max, current)) {
+            }
+            if (!scheduler.is_current_thread_in_group("serial_group")) {
+                in_group_mismatch = true;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                execution_order.push_back(i);
+                serial_threads.insert(boost::this_thread::get_id());
+            }
+            concurrent_count.fetch_sub(1);
+        }, nullptr, "serial_group"));
+    }
+
+    // Slow non-serial tasks posted from one thread must be spread over the workers by stealing
+    std::atomic<int> parallel_count{0};
+    std::vector<TaskScheduler::TaskId> parallel_ids(8, 0);
+    for (auto &task_id : parallel_ids) {
+        TEST_ASSERT_TRUE(scheduler.post([&parallel_count]() {
+            vTaskDelay(pdMS_TO_TICKS(20));
+            parallel_count++;
+        }, &task_id));
+    }
+
+    TEST_ASSERT_TRUE(scheduler.wait_all(2000));
+
+    // Serial tasks keep their order and never run concurrently, on a single worker
+    TEST_ASSERT_EQUAL(task_count, execution_order.size());
+    for (int i = 0; i < task_count; i++) {
+        TEST_ASSERT_EQUAL(i, execution_order[i]);
+    }
+    TEST_ASSERT_EQUAL(1, max_concurrent.load());
+    TEST_ASSERT_EQUAL(1, serial_threads.size());
+    TEST_ASSERT_EQUAL(static_cast<int>(parallel_ids.size()), parallel_count.load());
+    TEST_ASSERT_FALSE(in_group_mismatch.load());
+    TEST_ASSERT_FALSE(scheduler.is_current_thread_in_group("serial_group"));
+
+    auto stats = scheduler.get_statistics();
+    BROOKESIA_LOGI("Statistics: %1%", BROOKESIA_DESCRIBE_TO_STR(stats));
+
+    scheduler.stop();
+}
+
+TEST_CASE("Test work stealing timer tasks wake idle workers", "[utils][task_scheduler][group][work_stealing]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Work Stealing Timer Wake Test ===");
+
+    // Idle workers must not wait for the poll interval before running due timer tasks or tasks pushed to them
+    constexpr size_t poll_interval_ms = 500;
+    constexpr int delay_ms = 20;
+    constexpr int64_t max_latency_us = 200 * 1000;
+
+    TaskScheduler scheduler;
+    auto config = TEST_SCHEDULER_CONFIG_FOUR_THREADS;
+    config.worker_mode = TaskScheduler::WorkerMode::WorkStealing;
+    config.worker_poll_interval_ms = poll_interval_ms;
+    TEST_ASSERT_TRUE(scheduler.start(config));
+
+    for (int i = 0; i < 8; i++) {
+        // Let every worker go idle first
+        vTaskDelay(pdMS_TO_TICKS(50));
+
+        std::promise<int64_t> delayed_promise;
+        auto delayed_future = delayed_promise.get_future();
+        const auto delayed_posted_at = esp_timer_get_time();
+        TEST_ASSERT_TRUE(scheduler.post_delayed([&delayed_promise]() {
+            delayed_promise.set_value(esp_timer_get_time());
+        }, delay_ms));
+        TEST_ASSERT_TRUE(delayed_future.wait_for(std::chrono::milliseconds(poll_interval_ms * 2)) ==
+                         std::future_status::ready);
+        const auto delayed_latency_us = delayed_future.get() - delayed_posted_at - delay_ms * 1000;
+        BROOKESIA_LOGI("Delayed task %1% latency: %2% us", i, delayed_latency_us);
+        TEST_ASSERT_LESS_THAN(max_latency_us, delayed_latency_us);
+
+        vTaskDelay(pdMS_TO_TICKS(50));
+
+        std::promise<int64_t> post_promise;
+        auto post_future = post_promise.get_future();
+        const auto posted_at = esp_timer_get_time();
+        TEST_ASSERT_TRUE(scheduler.post([&post_promise]() {
+            post_promise.set_value(esp_timer_get_time());
+        }));
+        TEST_ASSERT_TRUE(post_future.wait_for(std::chrono::milliseconds(poll_interval_ms * 2)) ==
+                         std::future_status::ready);
+        const auto post_latency_us = post_future.get() - posted_at;
+        BROOKESIA_LOGI("Posted task %1% latency: %2% us", i, post_latency_us);
+        TEST_ASSERT_LESS_THAN(max_latency_us, post_latency_us);
+    }
+
+    scheduler.stop();
+}
+
+TEST_CASE("Test group priority classes", "[utils][task_scheduler][group][priority]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Group Priority Classes Test ===");
+
+    for (auto worker_mode : {
+                TaskScheduler::WorkerMode::Polling, TaskScheduler::WorkerMode::Blocking,
+                TaskScheduler::WorkerMode::WorkStealing
+            }) {
+        BROOKESIA_LOGI("Worker mode: %1%", BROOKESIA_DESCRIBE_TO_STR(worker_mode));
+
+        TaskScheduler scheduler;
+        TEST_ASSERT_TRUE(scheduler.start({
+            .worker_configs = {{.name = "TS_Worker", .stack_size = 8192}},
+            .worker_poll_interval_ms = 1,
+            .worker_mode = worker_mode,
+            .priority_starvation_timeout_ms = 10000,
+        }));
+        TEST_ASSERT_TRUE(scheduler.configure_group("render", {
+            .enable_serial_execution = true,
+            .priority = TaskScheduler::Priority::Realtime,
+        }));
+        TEST_ASSERT_TRUE(scheduler.configure_group("touch", {.priority = TaskScheduler::Priority::Interactive}));
+        TEST_ASSERT_TRUE(scheduler.configure_group("storage", {.priority = TaskScheduler::Priority::Background}));
+
+        // Occupy the only worker so that the following tasks queue up
+        std::atomic<bool> is_gate_running{false};
+        std::atomic<bool> is_gate_released{false};
+        TEST_ASSERT_TRUE(scheduler.post([&]() {
+            is_gate_running = true;
+            while (!is_gate_released) {
+                vTaskDelay(pdMS_TO_TICKS(1));
+            }
+        }));
+        while (!is_gate_running) {
+            vTaskDelay(pdMS_TO_TICKS(1));
+        }
+
+        std::mutex mutex;
+        std::vector<std::string> execution_order;
+        auto post_task = [&](const std::string & group, int index) {
+            TEST_ASSERT_TRUE(scheduler.post([&, group, index]() {
+                std::lock_guard<std::mutex> lock(mutex);
+                execution_order.push_back(group + std::to_string(index));
+            }, nullptr, group));
+        };
+        constexpr int background_count = 10;
+        for (int i = 0; i < background_count; i++) {
+            post_task("storage", i);
+        }
+        post_task("touch", 0);
+        post_task("touch", 1);
+        post_task("render", 0);
+        post_task("render", 1);
+
+        auto stats = scheduler.get_statistics();
+        const auto &background_stats = stats.priority_stats[static_cast<size_t>(TaskScheduler::Priority::Background)];
+        TEST_ASSERT_EQUAL(background_count, background_stats.queue_depth);
+
+        is_gate_released = true;
+        TEST_ASSERT_TRUE(scheduler.wait_all(2000));
+
+        // Higher classes jump ahead of the queued background burst, each class keeps its FIFO order
+        const std::vector<std::string> expected_head = {"render0", "render1", "touch0", "touch1", "storage0"};
+        TEST_ASSERT_EQUAL(background_count + 4, execution_order.size());
+        for (size_t i = 0; i < expected_head.size(); i++) {
+            TEST_ASSERT_EQUAL_STRING(expected_head[i].c_str(), execution_order[i].c_str());
+        }
+        TEST_ASSERT_EQUAL_STRING("storage9", execution_order.back().c_str());
+
+        stats = scheduler.get_statistics();
+        BROOKESIA_LOGI("Statistics: %1%", BROOKESIA_DESCRIBE_TO_STR(stats));
+        for (const auto &priority_stats : stats.priority_stats) {
+            TEST_ASSERT_EQUAL(0, priority_stats.queue_depth);
+            TEST_ASSERT_EQUAL(0, priority_stats.promoted_tasks);
+        }
+        TEST_ASSERT_EQUAL(
+            background_count,
+            stats.priority_stats[static_cast<size_t>(TaskScheduler::Priority::Background)].max_queue_depth
+        );
+
+        scheduler.stop();
+    }
+}
+
+TEST_CASE("Test group priority starvation protection", "[utils][task_scheduler][group][priority]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Group Priority Starvation Protection Test ===");
+
+    for (auto worker_mode : {
+                TaskScheduler::WorkerMode::Blocking, TaskScheduler::WorkerMode::WorkStealing
+            }) {
+        BROOKESIA_LOGI("Worker mode: %1%", BROOKESIA_DESCRIBE_TO_STR(worker_mode));
+
+        TaskScheduler scheduler;
+        TEST_ASSERT_TRUE(scheduler.start({
+            .worker_configs = {{.name = "TS_Worker", .stack_size = 8192}},
+            .worker_mode = worker_mode,
+            .priority_starvation_timeout_ms = 20,
+        }));
+        TEST_ASSERT_TRUE(scheduler.configure_group("render", {.priority = TaskScheduler::Priority::Realtime}));
+        TEST_ASSERT_TRUE(scheduler.configure_group("storage", {.priority = TaskScheduler::Priority::Background}));
+
+        std::atomic<bool> is_gate_running{false};
+        std::atomic<bool> is_gate_released{false};
+        TEST_ASSERT_TRUE(scheduler.post([&]() {
+            is_gate_running = true;
+            while (!is_gate_released) {
+                vTaskDelay(pdMS_TO_TICKS(1));
+            }
+        }));
+        while (!is_gate_running) {
+            vTaskDelay(pdMS_TO_TICKS(1));
+        }
+
+        // A steady stream of realtime work must not hold back the background task for longer than the timeout
+        std::atomic<int> realtime_done{0};
+        std::atomic<int> background_position{-1};
+        TEST_ASSERT_TRUE(scheduler.post([&]() {
+            background_position = realtime_done.load();
+        }, nullptr, "storage"));
+        constexpr int realtime_count = 30;
+        for (int i = 0; i < realtime_count; i++) {
+            TEST_ASSERT_TRUE(scheduler.post([&]() {
+                vTaskDelay(pdMS_TO_TICKS(5));
+                realtime_done++;
+            }, nullptr, "render"));
+        }
+
+        is_gate_released = true;
+        TEST_ASSERT_TRUE(scheduler.wait_all(2000));
+
+        auto stats = scheduler.get_statistics();
+        BROOKESIA_LOGI(
+            "Background task ran after %1% realtime tasks, statistics: %2%", background_position.load(),
+            BROOKESIA_DESCRIBE_TO_STR(stats)
+        );
+        TEST_ASSERT_TRUE(background_position.load() >= 0);
+        TEST_ASSERT_TRUE(background_position.load() < realtime_count);
+        TEST_ASSERT_EQUAL(1, stats.priority_stats[static_cast<size_t>(TaskScheduler::Priority::Background)].promoted_tasks);
+
+        scheduler.stop();
+    }
+}
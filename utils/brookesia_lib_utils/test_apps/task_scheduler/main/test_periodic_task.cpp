@@ -289,3 +289,128 @@ TEST_CASE("Test periodic task is_executing prevents parallel execution without s
 
     scheduler.stop();
 }
+
+// ============================================================================
+// Timer wheel tests
+// ============================================================================
+
+TEST_CASE("Test timer wheel delayed tasks across wheel levels", "[utils][task_scheduler][timer_wheel][delayed]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Timer Wheel Delayed Tasks Test ===");
+
+    TaskScheduler scheduler;
+    // A 1 ms tick makes the longer delays cascade from the upper wheel levels
+    TEST_ASSERT_TRUE(scheduler.start(TaskScheduler::StartConfig{
+        .timer_backend = TaskScheduler::TimerBackend::Wheel,
+        .timer_wheel_tick_ms = 1,
+    }));
+
+    const std::vector<int> delays_ms = {300, 30, 100, 5};
+    std::vector<int64_t> elapsed_us(delays_ms.size(), 0);
+    std::vector<TaskScheduler::TaskId> task_ids(delays_ms.size(), 0);
+    auto start_us = esp_timer_get_time();
+    for (size_t i = 0; i < delays_ms.size(); i++) {
+        TEST_ASSERT_TRUE(scheduler.post_delayed([&elapsed_us, i, start_us]() {
+            elapsed_us[i] = esp_timer_get_time() - start_us;
+        }, delays_ms[i], &task_ids[i]));
+    }
+
+    TEST_ASSERT_TRUE(scheduler.wait_all(2000));
+
+    for (size_t i = 0; i < delays_ms.size(); i++) {
+        BROOKESIA_LOGI("Delay %1% ms fired after %2% us", delays_ms[i], elapsed_us[i]);
+        // Deadlines are rounded up to the next tick, so a timer never fires early
+        TEST_ASSERT_TRUE(elapsed_us[i] >= delays_ms[i] * 1000);
+        TEST_ASSERT_TRUE(elapsed_us[i] < (delays_ms[i] + 200) * 1000);
+    }
+
+    scheduler.stop();
+}
+
+TEST_CASE("Test timer wheel re-arms for an earlier timer", "[utils][task_scheduler][timer_wheel][delayed]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Timer Wheel Re-arm Test ===");
+
+    TaskScheduler scheduler;
+    TEST_ASSERT_TRUE(scheduler.start(TaskScheduler::StartConfig{
+        .timer_backend = TaskScheduler::TimerBackend::Wheel,
+        .timer_wheel_tick_ms = 1,
+    }));
+
+    // The driver sleeps until the long timer first, the short one must pull the wake-up forward
+    std::atomic<int64_t> long_elapsed_us{0};
+    std::atomic<int64_t> short_elapsed_us{0};
+    auto start_us = esp_timer_get_time();
+    TEST_ASSERT_TRUE(scheduler.post_delayed([&long_elapsed_us, start_us]() {
+        long_elapsed_us = esp_timer_get_time() - start_us;
+    }, 1000));
+    TEST_ASSERT_TRUE(scheduler.post_delayed([&short_elapsed_us, start_us]() {
+        short_elapsed_us = esp_timer_get_time() - start_us;
+    }, 20));
+
+    TEST_ASSERT_TRUE(scheduler.wait_all(3000));
+
+    BROOKESIA_LOGI("Short timer fired after %1% us, long timer after %2% us", short_elapsed_us.load(),
+                   long_elapsed_us.load());
+    TEST_ASSERT_TRUE(short_elapsed_us >= 20 * 1000);
+    TEST_ASSERT_TRUE(short_elapsed_us < 220 * 1000);
+    TEST_ASSERT_TRUE(long_elapsed_us >= 1000 * 1000);
+    TEST_ASSERT_TRUE(long_elapsed_us < 1200 * 1000);
+
+    scheduler.stop();
+}
+
+TEST_CASE("Test timer wheel periodic, suspend, resume and restart", "[utils][task_scheduler][timer_wheel][periodic]")
+{
+    BROOKESIA_LOGI("=== TaskScheduler Timer Wheel Periodic Task Test ===");
+
+    TaskScheduler scheduler;
+    TEST_ASSERT_TRUE(scheduler.start(TaskScheduler::StartConfig{
+        .timer_backend = TaskScheduler::TimerBackend::Wheel,
+    }));
+
+    std::atomic<int> periodic_counter{0};
+    TaskScheduler::TaskId periodic_id = 0;
+    TEST_ASSERT_TRUE(scheduler.post_periodic([&periodic_counter]() -> bool {
+        periodic_counter++;
+        return periodic_counter < 5;
+    }, 50, &periodic_id));
+
+    // Suspend in the middle of the run and make sure nothing fires while suspended
+    vTaskDelay(pdMS_TO_TICKS(120));
+    TEST_ASSERT_TRUE(scheduler.suspend(periodic_id));
+    auto suspended_count = periodic_counter.load();
+    vTaskDelay(pdMS_TO_TICKS(200));
+    TEST_ASSERT_EQUAL(suspended_count, periodic_counter.load());
+    TEST_ASSERT_TRUE(scheduler.resume(periodic_id));
+    TEST_ASSERT_TRUE(scheduler.wait(periodic_id, 1000));
+    TEST_ASSERT_EQUAL(5, periodic_counter.load());
+
+    // Restarting a delayed task pushes its deadline back
+    std::atomic<bool> delayed_executed{false};
+    TaskScheduler::TaskId delayed_id = 0;
+    TEST_ASSERT_TRUE(scheduler.post_delayed([&delayed_executed]() {
+        delayed_executed = true;
+    }, 150, &delayed_id));
+    vTaskDelay(pdMS_TO_TICKS(100));
+    TEST_ASSERT_TRUE(scheduler.restart_timer(delayed_id));
+    vTaskDelay(pdMS_TO_TICKS(100));
+    TEST_ASSERT_FALSE(delayed_executed.load());
+    TEST_ASSERT_TRUE(scheduler.wait(delayed_id, 1000));
+    TEST_ASSERT_TRUE(delayed_executed.load());
+
+    // Canceled timers never fire
+    std::atomic<bool> canceled_executed{false};
+    TaskScheduler::TaskId canceled_id = 0;
+    TEST_ASSERT_TRUE(scheduler.post_delayed([&canceled_executed]() {
+        canceled_executed = true;
+    }, 50, &canceled_id));
+    scheduler.cancel(canceled_id);
+    vTaskDelay(pdMS_TO_TICKS(150));
+    TEST_ASSERT_FALSE(canceled_executed.load());
+
+    // Pending timers are dropped on stop
+    TEST_ASSERT_TRUE(scheduler.post_delayed([]() {}, 10000));
+    scheduler.stop();
+    TEST_ASSERT_FALSE(scheduler.is_running());
+}
@@ -34,9 +34,9 @@ void schedule_async_call(void (*callback)(void *), void *arg, int delay_ms)
 #endif
 }
 
-void set_promise_value(const std::shared_ptr<boost::promise<bool>> &promise, bool value)
+void set_promise_value(std::optional<boost::promise<bool>> &promise, bool value)
 {
-    if (promise == nullptr) {
+    if (!promise) {
         return;
     }
     try {
@@ -55,6 +55,8 @@ struct WasmTimerContext {
     uint64_t generation = 0;
 };
 
+TaskScheduler::TaskScheduler() = default;
+
 TaskScheduler::~TaskScheduler()
 {
     stop();
@@ -111,10 +113,10 @@ bool TaskScheduler::configure_group(const Group &group, const GroupConfig &confi
     return true;
 }
 
-bool TaskScheduler::post_internal(OnceTask task, TaskId *id, const Group &group, bool enable_immediate)
+bool TaskScheduler::post_internal(TaskClosure task, TaskId *id, const Group &group, bool enable_immediate)
 {
     (void)enable_immediate;
-    BROOKESIA_CHECK_FALSE_RETURN(task != nullptr, false, "Invalid task");
+    BROOKESIA_CHECK_FALSE_RETURN(static_cast<bool>(task), false, "Invalid task");
     if (!is_running_) {
         BROOKESIA_LOGW("TaskScheduler is not running, executing task inline");
     }
@@ -141,12 +143,14 @@ bool TaskScheduler::post_internal(OnceTask task, TaskId *id, const Group &group,
 
 bool TaskScheduler::dispatch(OnceTask task, TaskId *id, const Group &group)
 {
-    return post_internal(std::move(task), id, group, true);
+    BROOKESIA_CHECK_FALSE_RETURN(task != nullptr, false, "Invalid task");
+    return post_internal(TaskClosure(std::move(task)), id, group, true);
 }
 
 bool TaskScheduler::post(OnceTask task, TaskId *id, const Group &group)
 {
-    return post_internal(std::move(task), id, group, false);
+    BROOKESIA_CHECK_FALSE_RETURN(task != nullptr, false, "Invalid task");
+    return post_internal(TaskClosure(std::move(task)), id, group, false);
 }
 
 bool TaskScheduler::post_delayed(OnceTask task, int delay_ms, TaskId *id, const Group &group)
@@ -412,6 +416,16 @@ TaskScheduler::Statistics TaskScheduler::get_statistics() const
     };
 }
 
+std::vector<TaskScheduler::GroupStatistics> TaskScheduler::get_group_statistics() const
+{
+    return {};
+}
+
+std::optional<TaskScheduler::GroupStatistics> TaskScheduler::get_group_statistics(const Group &) const
+{
+    return std::nullopt;
+}
+
 void TaskScheduler::reset_statistics()
 {
     total_tasks_ = 0;
@@ -430,7 +444,7 @@ std::shared_ptr<TaskScheduler::TaskHandle> TaskScheduler::create_handle(
     handle->repeat = repeat;
     handle->interval_ms = interval_ms;
     handle->group = group;
-    handle->promise = std::make_shared<boost::promise<bool>>();
+    handle->promise.emplace();
     handle->future = handle->promise->get_future().share();
     {
         boost::lock_guard lock(mutex_);